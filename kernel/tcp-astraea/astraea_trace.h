@@ -0,0 +1,120 @@
+/* Tracepoints of the Astraea TCP CC module.
+ *
+ * Every event sits behind the tracepoint's own static key, so a disabled
+ * event costs a single patched-out branch on the ACK path. Enable them with
+ *   echo 1 > /sys/kernel/debug/tracing/events/tcp_astraea/enable
+ */
+#undef TRACE_SYSTEM
+#define TRACE_SYSTEM tcp_astraea
+
+#if !defined(_TRACE_TCP_ASTRAEA_H) || defined(TRACE_HEADER_MULTI_READ)
+#define _TRACE_TCP_ASTRAEA_H
+
+#include <linux/tracepoint.h>
+#include <net/sock.h>
+
+TRACE_EVENT(astraea_pkts_acked,
+
+  TP_PROTO(const struct sock* sk, u32 snd_cwnd, u8 ca_state, s32 rtt_us),
+
+  TP_ARGS(sk, snd_cwnd, ca_state, rtt_us),
+
+  TP_STRUCT__entry(
+    __field(const void*, skaddr)
+    __field(u32, snd_cwnd)
+    __field(u8, ca_state)
+    __field(s32, rtt_us)
+  ),
+
+  TP_fast_assign(
+    __entry->skaddr = sk;
+    __entry->snd_cwnd = snd_cwnd;
+    __entry->ca_state = ca_state;
+    __entry->rtt_us = rtt_us;
+  ),
+
+  TP_printk("sk=%p cwnd=%u ca_state=%u sampled_rtt=%d", __entry->skaddr,
+            __entry->snd_cwnd, __entry->ca_state, __entry->rtt_us)
+);
+
+TRACE_EVENT(astraea_cong_control,
+
+  TP_PROTO(const struct sock* sk, u32 snd_cwnd, u32 rcv_wnd, u8 ca_state,
+           unsigned long pacing_rate, u64 sampled_rate, s32 delivered,
+           long interval_us, u32 packets_out),
+
+  TP_ARGS(sk, snd_cwnd, rcv_wnd, ca_state, pacing_rate, sampled_rate,
+          delivered, interval_us, packets_out),
+
+  TP_STRUCT__entry(
+    __field(const void*, skaddr)
+    __field(u32, snd_cwnd)
+    __field(u32, rcv_wnd)
+    __field(u8, ca_state)
+    __field(unsigned long, pacing_rate)
+    __field(u64, sampled_rate)
+    __field(s32, delivered)
+    __field(long, interval_us)
+    __field(u32, packets_out)
+  ),
+
+  TP_fast_assign(
+    __entry->skaddr = sk;
+    __entry->snd_cwnd = snd_cwnd;
+    __entry->rcv_wnd = rcv_wnd;
+    __entry->ca_state = ca_state;
+    __entry->pacing_rate = pacing_rate;
+    __entry->sampled_rate = sampled_rate;
+    __entry->delivered = delivered;
+    __entry->interval_us = interval_us;
+    __entry->packets_out = packets_out;
+  ),
+
+  TP_printk("sk=%p snd_cwnd=%u rcv_wnd=%u ca_state=%u pacing_rate=%lu "
+            "sampled_rate=%llu delivered=%d interval_us=%ld packets_out=%u",
+            __entry->skaddr, __entry->snd_cwnd, __entry->rcv_wnd,
+            __entry->ca_state, __entry->pacing_rate, __entry->sampled_rate,
+            __entry->delivered, __entry->interval_us, __entry->packets_out)
+);
+
+/* loss and recovery events share one layout */
+DECLARE_EVENT_CLASS(astraea_ca_transition,
+
+  TP_PROTO(const struct sock* sk, u32 snd_cwnd, u8 ca_state),
+
+  TP_ARGS(sk, snd_cwnd, ca_state),
+
+  TP_STRUCT__entry(
+    __field(const void*, skaddr)
+    __field(u32, snd_cwnd)
+    __field(u8, ca_state)
+  ),
+
+  TP_fast_assign(
+    __entry->skaddr = sk;
+    __entry->snd_cwnd = snd_cwnd;
+    __entry->ca_state = ca_state;
+  ),
+
+  TP_printk("sk=%p cwnd=%u ca_state=%u", __entry->skaddr, __entry->snd_cwnd,
+            __entry->ca_state)
+);
+
+DEFINE_EVENT(astraea_ca_transition, astraea_loss,
+  TP_PROTO(const struct sock* sk, u32 snd_cwnd, u8 ca_state),
+  TP_ARGS(sk, snd_cwnd, ca_state)
+);
+
+DEFINE_EVENT(astraea_ca_transition, astraea_recovery,
+  TP_PROTO(const struct sock* sk, u32 snd_cwnd, u8 ca_state),
+  TP_ARGS(sk, snd_cwnd, ca_state)
+);
+
+#endif /* _TRACE_TCP_ASTRAEA_H */
+
+/* this part must be outside the include guard */
+#undef TRACE_INCLUDE_PATH
+#define TRACE_INCLUDE_PATH .
+#undef TRACE_INCLUDE_FILE
+#define TRACE_INCLUDE_FILE astraea_trace
+#include <trace/define_trace.h>
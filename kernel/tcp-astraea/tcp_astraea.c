@@ -1,11 +1,37 @@
+#include <linux/debugfs.h>
 #include <linux/module.h>
+#include <linux/percpu.h>
 #include <linux/random.h>
+#include <linux/seq_file.h>
+#include <linux/static_key.h>
 #include <net/tcp.h>
 
+#define CREATE_TRACE_POINTS
+#include "astraea_trace.h"
+
 #define THR_SCALE 24
 #define THR_UNIT (1 << THR_SCALE)
 
-const char* prefix = "[Astraea-sat-dbg12]";
+/* per-CPU event counters, exported via debugfs (tcp_astraea/stats) */
+struct astraea_stats {
+  u64 acks;
+  u64 rate_samples;
+  u64 losses;
+  u64 recoveries;
+};
+
+static DEFINE_PER_CPU(struct astraea_stats, astraea_pcpu_stats);
+
+/* counting is off by default; toggled by writing tcp_astraea/enabled */
+static DEFINE_STATIC_KEY_FALSE(astraea_stats_enabled);
+
+#define astraea_stat_inc(field)                           \
+  do {                                                    \
+    if (static_branch_unlikely(&astraea_stats_enabled))   \
+      this_cpu_inc(astraea_pcpu_stats.field);             \
+  } while (0)
+
+static struct dentry* astraea_debugfs_dir;
 
 struct astraea {
   /* CA state on previous ACK */
@@ -78,13 +104,16 @@ static void astraea_cong_control(struct sock* sk,
                                  const struct rate_sample* rs) {
   struct tcp_sock* tp = tcp_sk(sk);
   struct astraea* astraea = inet_csk_ca(sk);
-  // print rate sample
   u64 bw;
 
   // we believe cwnd has been modified by user-space RL-agent
   u32 cwnd = max(tp->prior_cwnd, astraea->prior_cwnd);
   tp->snd_cwnd = max(tp->snd_cwnd, cwnd);
   astraea_update_cwnd(sk);
+  astraea_stat_inc(rate_samples);
+
+  /* the sampled rate is only needed by the tracepoint */
+  if (!trace_astraea_cong_control_enabled()) return;
 
   if (rs->delivered < 0 || rs->interval_us <= 0) {
     bw = 0;
@@ -97,12 +126,10 @@ static void astraea_cong_control(struct sock* sk,
     bw = bw * tp->mss_cache * USEC_PER_SEC >> THR_SCALE;
   }
 
-  printk(KERN_INFO
-         "%s: snd_cwnd: %u, rcv_wnd: %u, current_state: %u, pacing_rate: %lu, "
-         "sampled_rate: %llu, deliverd: %u, interval_us:%lu, packet_out:%u",
-         prefix, tp->snd_cwnd, tp->rcv_wnd, inet_csk(sk)->icsk_ca_state,
-         sk->sk_pacing_rate, bw, rs->delivered, rs->interval_us,
-         tp->packets_out);
+  trace_astraea_cong_control(sk, tp->snd_cwnd, tp->rcv_wnd,
+                             inet_csk(sk)->icsk_ca_state, sk->sk_pacing_rate,
+                             bw, rs->delivered, rs->interval_us,
+                             tp->packets_out);
 }
 
 /**
@@ -129,18 +156,18 @@ static void astraea_cong_avoid(struct sock* sk, u32 ack, u32 acked) {
 }
 
 static void astraea_pkts_acked(struct sock* sk, const struct ack_sample* acks) {
-  struct tcp_sock* tp = tcp_sk(sk);
-  s32 rtt = max(acks->rtt_us, 0);
-  printk(KERN_INFO "%s: cwnd: %u, current_state: %u, sampled_rtt: %u", prefix,
-         tp->snd_cwnd, inet_csk(sk)->icsk_ca_state, rtt);
+  astraea_stat_inc(acks);
+  trace_astraea_pkts_acked(sk, tcp_sk(sk)->snd_cwnd,
+                           inet_csk(sk)->icsk_ca_state,
+                           max(acks->rtt_us, 0));
 }
 
 static void astraea_ack_event(struct sock* sk, u32 flags) {}
 
 static void astraea_cwnd_event(struct sock* sk, enum tcp_ca_event event) {
   if (event == CA_EVENT_LOSS) {
-    printk(KERN_INFO "%s packet loss: cwnd: %u, current_state: %u", prefix,
-           tcp_sk(sk)->snd_cwnd, inet_csk(sk)->icsk_ca_state);
+    astraea_stat_inc(losses);
+    trace_astraea_loss(sk, tcp_sk(sk)->snd_cwnd, inet_csk(sk)->icsk_ca_state);
   }
 }
 
@@ -150,8 +177,9 @@ static void astraea_set_state(struct sock* sk, u8 new_state) {
   if (new_state == TCP_CA_Loss) {
     astraea->prev_ca_state = TCP_CA_Loss;
   } else if (new_state == TCP_CA_Recovery) {
-    printk(KERN_INFO "%s recovery: cwnd: %u, current_state: %u", prefix,
-           tcp_sk(sk)->snd_cwnd, inet_csk(sk)->icsk_ca_state);
+    astraea_stat_inc(recoveries);
+    trace_astraea_recovery(sk, tcp_sk(sk)->snd_cwnd,
+                           inet_csk(sk)->icsk_ca_state);
   }
 }
 
@@ -170,17 +198,74 @@ static struct tcp_congestion_ops tcp_astraea_ops __read_mostly = {
     .cwnd_event = astraea_cwnd_event,
 };
 
+/* Debugfs section */
+static int astraea_stats_show(struct seq_file* m, void* v) {
+  struct astraea_stats sum = {0};
+  int cpu;
+
+  for_each_possible_cpu(cpu) {
+    const struct astraea_stats* s = per_cpu_ptr(&astraea_pcpu_stats, cpu);
+    sum.acks += READ_ONCE(s->acks);
+    sum.rate_samples += READ_ONCE(s->rate_samples);
+    sum.losses += READ_ONCE(s->losses);
+    sum.recoveries += READ_ONCE(s->recoveries);
+  }
+
+  seq_printf(m, "acks %llu\nrate_samples %llu\nlosses %llu\nrecoveries %llu\n",
+             sum.acks, sum.rate_samples, sum.losses, sum.recoveries);
+  return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(astraea_stats);
+
+static ssize_t astraea_enabled_read(struct file* file, char __user* buf,
+                                    size_t count, loff_t* ppos) {
+  char val[2] = {static_key_enabled(&astraea_stats_enabled) ? '1' : '0', '\n'};
+  return simple_read_from_buffer(buf, count, ppos, val, sizeof(val));
+}
+
+static ssize_t astraea_enabled_write(struct file* file, const char __user* buf,
+                                     size_t count, loff_t* ppos) {
+  bool enable;
+  int ret = kstrtobool_from_user(buf, count, &enable);
+  if (ret) return ret;
+
+  if (enable)
+    static_branch_enable(&astraea_stats_enabled);
+  else
+    static_branch_disable(&astraea_stats_enabled);
+  return count;
+}
+
+static const struct file_operations astraea_enabled_fops = {
+    .owner = THIS_MODULE,
+    .read = astraea_enabled_read,
+    .write = astraea_enabled_write,
+    .llseek = default_llseek,
+};
+
 /* Kernel module section */
 static int __init astraea_register(void) {
+  int ret;
+
   BUILD_BUG_ON(sizeof(struct astraea) > ICSK_CA_PRIV_SIZE);
-  printk(KERN_INFO
-         "[TCP Astraea] Astraea init clean tcp congestion control logic\n");
-  return tcp_register_congestion_control(&tcp_astraea_ops);
+  ret = tcp_register_congestion_control(&tcp_astraea_ops);
+  if (ret) return ret;
+
+  /* debugfs is best effort; the module works without it */
+  astraea_debugfs_dir = debugfs_create_dir("tcp_astraea", NULL);
+  debugfs_create_file("stats", 0444, astraea_debugfs_dir, NULL,
+                      &astraea_stats_fops);
+  debugfs_create_file("enabled", 0644, astraea_debugfs_dir, NULL,
+                      &astraea_enabled_fops);
+
+  pr_info("[TCP Astraea] Astraea init clean tcp congestion control logic\n");
+  return 0;
 }
 
 static void __exit astraea_unregister(void) {
-  printk(KERN_INFO "[TCP Astraea] Astraea unregistered");
+  debugfs_remove_recursive(astraea_debugfs_dir);
   tcp_unregister_congestion_control(&tcp_astraea_ops);
+  pr_info("[TCP Astraea] Astraea unregistered\n");
 }
 
 module_init(astraea_register);
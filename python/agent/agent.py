@@ -14,7 +14,7 @@ STDDEV = 0.1
 NSTEP = 0.3
 
 from . import context
-from helpers.buffer import ReplayBuffer, Prioritized_ReplayBuffer
+from helpers.buffer import create_replay_buffer
 from helpers.noise import OU_Noise, G_Noise,Random_Noise
 from helpers.utils import create_input_op_shape
 
@@ -203,14 +203,9 @@ class Agent:
         self.h2_shape = h2_shape
         self.stddev = stddev
         self.learn = True
-        if not self.PER:
-            self.rp_buffer = ReplayBuffer(
-                int(mem_size), s_dim, a_dim, s_dim_global, batch_size=batch_size
-            )
-        else:
-            self.rp_buffer = Prioritized_ReplayBuffer(
-                int(mem_size), s_dim, a_dim, s_dim_global, batch_size=batch_size
-            )
+        self.rp_buffer = create_replay_buffer(
+            int(mem_size), s_dim, a_dim, s_dim_global, batch_size, prioritized=self.PER
+        )
 
         if noise_type == 0:
             self.actor_noise = Random_Noise(
@@ -491,8 +486,7 @@ class Agent:
         ]
 
         if self.PER == True:
-            idxes, batch_sample, weights = self.rp_buffer.sample()
-            batch_samples = list(zip(*batch_sample))
+            idxes, batch_samples, weights = self.rp_buffer.sample()
             fd = {
                 self.s0: create_input_op_shape(batch_samples[0], self.s0),
                 self.s0_global: create_input_op_shape(batch_samples[1], self.s0_global),
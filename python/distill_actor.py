@@ -0,0 +1,343 @@
+#!/usr/bin/env python3
+"""Distill the actor into a regression tree compiled into the C++ services.
+
+The actor of an exported checkpoint (the model `infer` loads), run in numpy
+on the variables generate_actor.py reads, so without TensorFlow, labels the
+states of simulated flows (astraea_sim.VecEnv, 10 features x 5 steps, as
+format_state() builds them) and any recorded with --states. A regression tree is fitted to those actions and written as
+constexpr tables to src/inference/distilled_actor_tables.hh, with its error
+against the actor on held-out states. After the first round, the flows are
+driven by the tree itself and the actor relabels the states they reach, so
+the tree also learns the states its own mistakes lead to.
+
+Without astraea_sim, only the recorded states are labelled.
+
+Usage:
+    python3 distill_actor.py --checkpoint ../models/exported/model \
+        [--states states.npy ...]
+Then rebuild and run `infer --backend=tree` or `simulate --policy=tree`.
+"""
+import argparse
+import heapq
+import sys
+from os import path
+
+import numpy as np
+
+import generate_actor
+from helpers import context  # puts the native modules on sys.path
+
+STATE_DIM = 10
+HISTORY = 5
+NUM_FEATURES = STATE_DIM * HISTORY
+# as compiled_actor::kLeakyReluAlpha
+LEAKY_RELU_ALPHA = np.float32(0.2)
+
+default_header = path.join(context.base_dir, "src", "inference",
+                           "distilled_actor_tables.hh")
+
+
+def load_actor(checkpoint, scope, action_scale):
+    """the actor of the checkpoint, as a function of a batch of states; the
+    layers of CompiledActor, batch normalization folded in"""
+    layers = [(np.array(rows, dtype=np.float32),
+               np.array(bias, dtype=np.float32), leaky_relu)
+              for rows, bias, leaky_relu in generate_actor.actor_layers(
+                  generate_actor.read_checkpoint(checkpoint), scope)]
+
+    def actor(states):
+        h = np.asarray(states, dtype=np.float32)
+        for kernel, bias, leaky_relu in layers:
+            h = h @ kernel + bias
+            if leaky_relu:
+                h = np.where(h > 0, h, h * LEAKY_RELU_ALPHA)
+        return (np.tanh(h[:, 0]) * np.float32(action_scale)).astype(np.float32)
+
+    return actor
+
+
+def have_simulator():
+    try:
+        import astraea_sim  # noqa: F401
+    except ImportError:
+        return False
+    return True
+
+
+def collect_states(actor, tree, args, rng):
+    """states of simulated flows driven by the actor (tree is None) or the
+    tree, with exploration noise on the actions"""
+    import astraea_sim
+    config = astraea_sim.VecEnvConfig()
+    config.num_envs = args.envs
+    config.flows_per_env = args.flows_per_env
+    config.history = HISTORY
+    config.seed = int(rng.integers(1 << 31))
+    env = astraea_sim.VecEnv(config)
+    states, _ = env.reset()
+    collected = []
+    for _ in range(args.steps):
+        states = np.array(states, dtype=np.float32)
+        collected.append(states)
+        actions = actor(states) if tree is None else tree.predict(states)
+        actions += rng.normal(0, args.noise, actions.shape)
+        actions = np.clip(actions, -1, 1).astype(np.float32)
+        states, _, _, _, _ = env.step(actions)
+    return np.concatenate(collected)
+
+
+class Tree:
+    """A regression tree grown best first on quantile-binned features.
+
+    The nodes are kept in preorder: a split node's left child follows it,
+    `right` is the index of its right child. A split sends states with
+    state[feature] <= value to the left; a leaf (feature -1) holds the action.
+    """
+
+    def __init__(self, feature, value, right):
+        self.feature = np.asarray(feature, dtype=np.int16)
+        self.value = np.asarray(value, dtype=np.float32)
+        self.right = np.asarray(right, dtype=np.int32)
+
+    def __len__(self):
+        return len(self.feature)
+
+    def depth(self):
+        def walk(node):
+            if self.feature[node] < 0:
+                return 0
+            return 1 + max(walk(node + 1), walk(self.right[node]))
+
+        return walk(0)
+
+    def predict(self, states):
+        node = np.zeros(len(states), dtype=np.int64)
+        rows = np.arange(len(states))
+        while True:
+            feature = self.feature[node]
+            inner = feature >= 0
+            if not inner.any():
+                return self.value[node].copy()
+            # a leaf stays where it is: compare with its own (any) feature
+            x = states[rows, np.maximum(feature, 0)]
+            left = x <= self.value[node]
+            node = np.where(inner, np.where(left, node + 1, self.right[node]),
+                            node)
+
+
+def fit_tree(states, actions, max_leaves, min_leaf, max_depth, bins):
+    """best-first CART on the squared error of the actions"""
+    n, num_features = states.shape
+    # edges[f][b] is the largest value of bin b
+    edges = []
+    binned = np.empty((n, num_features), dtype=np.uint8)
+    for f in range(num_features):
+        # float32, as the C++ side compares them
+        e = np.unique(np.quantile(states[:, f], np.linspace(
+            0, 1, bins + 1)[1:-1]).astype(np.float32))
+        edges.append(e)
+        binned[:, f] = np.searchsorted(e, states[:, f], side="left")
+    offsets = np.arange(num_features) * bins
+
+    def best_split(index):
+        """(gain, feature, bin) of the best split of the samples in `index`"""
+        y = actions[index]
+        keys = (binned[index].astype(np.int64) + offsets).ravel()
+        counts = np.bincount(keys, minlength=num_features * bins)
+        sums = np.bincount(keys, weights=np.repeat(y, num_features),
+                           minlength=num_features * bins)
+        counts = counts.reshape(num_features, bins).cumsum(axis=1)
+        sums = sums.reshape(num_features, bins).cumsum(axis=1)
+        total_n, total_s = len(index), y.sum()
+        right_n = total_n - counts
+        with np.errstate(divide="ignore", invalid="ignore"):
+            gain = (sums ** 2 / counts + (total_s - sums) ** 2 / right_n -
+                    total_s ** 2 / total_n)
+        valid = (counts >= min_leaf) & (right_n >= min_leaf)
+        valid &= np.arange(bins)[None, :] < np.array(
+            [len(e) for e in edges])[:, None]
+        gain = np.where(valid, gain, -np.inf)
+        f, b = np.unravel_index(np.argmax(gain), gain.shape)
+        return gain[f, b], f, b
+
+    # nodes: [feature, threshold or action, left, right]
+    nodes = []
+
+    def leaf(index):
+        nodes.append([-1, float(actions[index].mean()), -1, -1])
+        return len(nodes) - 1
+
+    heap = []
+
+    def push(node, index, depth):
+        if depth >= max_depth or len(index) < 2 * min_leaf:
+            return
+        gain, f, b = best_split(index)
+        if gain > 0:
+            heapq.heappush(heap, (-gain, node, index, depth, f, b))
+
+    root = leaf(np.arange(n))
+    push(root, np.arange(n), 0)
+    leaves = 1
+    while heap and leaves < max_leaves:
+        _, node, index, depth, f, b = heapq.heappop(heap)
+        goes_left = binned[index, f] <= b
+        left, right = index[goes_left], index[~goes_left]
+        nodes[node][0] = f
+        nodes[node][1] = float(edges[f][b])
+        nodes[node][2] = leaf(left)
+        nodes[node][3] = leaf(right)
+        push(nodes[node][2], left, depth + 1)
+        push(nodes[node][3], right, depth + 1)
+        leaves += 1
+
+    # to preorder
+    feature, value, right = [], [], []
+
+    def emit(node):
+        at = len(feature)
+        feature.append(nodes[node][0])
+        value.append(nodes[node][1])
+        right.append(0)
+        if nodes[node][0] >= 0:
+            emit(nodes[node][2])
+            right[at] = len(feature)
+            emit(nodes[node][3])
+
+    sys.setrecursionlimit(max(1000, 4 * max_depth))
+    emit(root)
+    return Tree(feature, value, right)
+
+
+def window_factor(action):
+    """the cwnd multiplier of an action, as map_action() in context.cc"""
+    return np.where(action >= 0, 1 + 0.025 * action, 1 / (1 - 0.025 * action))
+
+
+def error_report(tree, states, actions):
+    predicted = tree.predict(states)
+    error = np.abs(predicted - actions)
+    window = np.abs(window_factor(predicted) / window_factor(actions) - 1)
+    # the direction of the window, on the steps where the actor moves it
+    moving = np.abs(actions) > 0.05
+    agree = np.sign(predicted[moving]) == np.sign(actions[moving])
+    return [
+        "{} nodes, depth {}, against the actor on {} held-out states:".format(
+            len(tree), tree.depth(), len(states)),
+        "  action error: mean {:.4f}, rmse {:.4f}, p99 {:.4f}, max {:.4f}".format(
+            error.mean(), np.sqrt((error ** 2).mean()),
+            np.quantile(error, 0.99), error.max()),
+        "  window error: mean {:.3%}, p99 {:.3%}".format(
+            window.mean(), np.quantile(window, 0.99)),
+        "  direction agrees on {:.2%} of the steps that move the window".format(
+            agree.mean() if len(agree) else 1.0),
+    ]
+
+
+def float_literal(value):
+    """a C++ float literal that reads back as exactly `value`"""
+    text = "{:.9g}".format(value)
+    if not any(c in text for c in ".e"):
+        text += ".0"
+    return text + "f"
+
+
+def write_header(output, tree, report, source):
+    lines = ["// Generated by python/distill_actor.py from {}; do not edit.".format(
+        source), "//"]
+    lines += ["// " + line for line in report]
+    lines += [
+        "#ifndef DISTILLED_ACTOR_TABLES_HH",
+        "#define DISTILLED_ACTOR_TABLES_HH",
+        "",
+        "#include <cstdint>",
+        "",
+        "namespace distilled {",
+        "",
+        "struct Node {",
+        "  // index into the state; -1 for a leaf",
+        "  int16_t feature;",
+        "  // the right child; the left one follows its parent",
+        "  int32_t right;",
+        "  // state[feature] <= value goes left; a leaf's action",
+        "  float value;",
+        "};",
+        "",
+        "constexpr bool kAvailable = true;",
+        "constexpr int kFeatures = {};".format(NUM_FEATURES),
+        "constexpr Node kNodes[] = {",
+    ]
+    for f, v, r in zip(tree.feature, tree.value, tree.right):
+        lines.append("    {{{}, {}, {}}},".format(f, r, float_literal(v)))
+    lines += ["};", "", "}  // namespace distilled", "",
+              "#endif  // DISTILLED_ACTOR_TABLES_HH", ""]
+    with open(output, "w") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--checkpoint", required=True,
+                        help="checkpoint prefix, e.g. models/exported/model")
+    parser.add_argument("--scope", default="actor")
+    parser.add_argument("--action-scale", type=float, default=1.0)
+    parser.add_argument("--output", default=default_header)
+    parser.add_argument("--states", nargs="*", default=[],
+                        help="recorded states (.npy, N x 50) to add")
+    parser.add_argument("--rounds", type=int, default=3,
+                        help="rounds of collection; all but the first drive "
+                        "the flows by the tree")
+    parser.add_argument("--envs", type=int, default=256)
+    parser.add_argument("--flows-per-env", type=int, default=2)
+    parser.add_argument("--steps", type=int, default=200,
+                        help="control steps per round")
+    parser.add_argument("--noise", type=float, default=0.1,
+                        help="std of the exploration noise on the actions")
+    parser.add_argument("--max-leaves", type=int, default=4096)
+    parser.add_argument("--max-depth", type=int, default=16)
+    parser.add_argument("--min-leaf", type=int, default=20)
+    parser.add_argument("--bins", type=int, default=64)
+    parser.add_argument("--holdout", type=float, default=0.1)
+    parser.add_argument("--seed", type=int, default=0)
+    args = parser.parse_args()
+
+    if not 2 <= args.bins <= 256:
+        sys.exit("--bins must be within [2, 256]")
+    rng = np.random.default_rng(args.seed)
+    actor = load_actor(args.checkpoint, args.scope, args.action_scale)
+    states = [np.load(p).astype(np.float32).reshape(-1, NUM_FEATURES)
+              for p in args.states]
+    rounds = args.rounds
+    if rounds > 0 and not have_simulator():
+        sys.stderr.write("astraea_sim is not built (cmake "
+                         "-DCOMPILE_PYTHON_ENV=ON): only --states are used\n")
+        rounds = 0
+    tree = None
+    for r in range(rounds):
+        if r > 0:
+            train = np.concatenate(states)
+            tree = fit_tree(train, actor(train), args.max_leaves, args.min_leaf,
+                            args.max_depth, args.bins)
+        states.append(collect_states(actor, tree, args, rng))
+        sys.stderr.write("round {}: {} states\n".format(
+            r, sum(len(s) for s in states)))
+    if not states:
+        sys.exit("no states: pass --states, or --rounds above 0 with "
+                 "astraea_sim built")
+    train = np.concatenate(states)
+
+    # refit without the held-out states, which the report is on
+    labels = actor(train)
+    order = rng.permutation(len(train))
+    held = order[:int(len(train) * args.holdout)]
+    kept = order[len(held):]
+    tree = fit_tree(train[kept], labels[kept], args.max_leaves, args.min_leaf,
+                    args.max_depth, args.bins)
+    report = error_report(tree, train[held], labels[held])
+    print("\n".join(report))
+    write_header(args.output, tree, report, args.checkpoint)
+    print("wrote", args.output)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,237 @@
+#!/usr/bin/env python3
+"""Generate the C++ actor specialized for the layer shapes of a checkpoint.
+
+Reads the actor's variables straight from a TensorFlow checkpoint (the
+tensor bundle `PREFIX.index` and its data file), so it needs neither
+TensorFlow nor numpy. Each batch normalization is folded into the dense layer
+before it. The translation unit it writes holds the weights as aligned static
+arrays and runs the layers through the templates of
+src/inference/compiled_actor.hh, with every shape a compile-time constant.
+
+The network is the one Actor.build() in python/agent/agent.py makes:
+    dense (fc1, fc2, ...) -> batch normalization -> leaky ReLU, per hidden layer
+    dense -> tanh -> * action scale
+Usage:
+    python3 generate_actor.py --checkpoint ../models/exported/model \
+        --output compiled_actor.cc
+"""
+import argparse
+import math
+import struct
+import sys
+
+# tf.layers.batch_normalization
+BN_EPSILON = 1e-3
+DT_FLOAT = 1
+TABLE_MAGIC = 0xDB4775248B80FB57
+
+
+def varint(buf, i):
+    value = shift = 0
+    while True:
+        byte = buf[i]
+        i += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if byte < 0x80:
+            return value, i
+
+
+def proto_fields(buf):
+    """the fields of a protobuf message, by number; varints and bytes only"""
+    fields, i = {}, 0
+    while i < len(buf):
+        tag, i = varint(buf, i)
+        number, wire = tag >> 3, tag & 7
+        if wire == 0:
+            value, i = varint(buf, i)
+        elif wire == 2:
+            length, i = varint(buf, i)
+            value, i = buf[i:i + length], i + length
+        elif wire == 1:
+            value, i = buf[i:i + 8], i + 8
+        elif wire == 5:
+            value, i = buf[i:i + 4], i + 4
+        else:
+            raise ValueError("unsupported protobuf wire type {}".format(wire))
+        fields.setdefault(number, []).append(value)
+    return fields
+
+
+def block_entries(block):
+    """the (key, value) pairs of a leveldb table block"""
+    num_restarts = struct.unpack_from("<I", block, len(block) - 4)[0]
+    end = len(block) - 4 - 4 * num_restarts
+    i, key = 0, b""
+    while i < end:
+        shared, i = varint(block, i)
+        unshared, i = varint(block, i)
+        length, i = varint(block, i)
+        key = key[:shared] + block[i:i + unshared]
+        i += unshared
+        yield key, block[i:i + length]
+        i += length
+
+
+def block_handle(buf, i=0):
+    offset, i = varint(buf, i)
+    size, i = varint(buf, i)
+    return offset, size, i
+
+
+def read_checkpoint(prefix):
+    """{name: (shape, flat list of floats)} of the float variables"""
+    with open(prefix + ".index", "rb") as f:
+        index = f.read()
+    footer = index[-48:]
+    if struct.unpack_from("<Q", footer, 40)[0] != TABLE_MAGIC:
+        raise ValueError(prefix + ".index is not a checkpoint index")
+    _, _, i = block_handle(footer)
+    offset, size, _ = block_handle(footer, i)
+    entries, num_shards = {}, 1
+    for _, handle in block_entries(index[offset:offset + size]):
+        offset, size, _ = block_handle(handle)
+        if index[offset + size] != 0:
+            raise ValueError("compressed checkpoint index blocks are not supported")
+        for key, value in block_entries(index[offset:offset + size]):
+            if key:
+                entries[key.decode()] = proto_fields(value)
+            else:  # the bundle header
+                num_shards = proto_fields(value).get(1, [1])[0]
+
+    variables, shards = {}, {}
+    for name, entry in entries.items():
+        if entry.get(1, [0])[0] != DT_FLOAT or 7 in entry:
+            continue
+        dims = proto_fields(entry.get(2, [b""])[0]).get(2, [])
+        shape = [proto_fields(d).get(1, [0])[0] for d in dims]
+        shard = entry.get(3, [0])[0]
+        if shard not in shards:
+            with open("{}.data-{:05d}-of-{:05d}".format(
+                    prefix, shard, num_shards), "rb") as f:
+                shards[shard] = f.read()
+        offset, size = entry.get(4, [0])[0], entry.get(5, [0])[0]
+        values = struct.unpack_from("<{}f".format(size // 4), shards[shard], offset)
+        variables[name] = (shape, list(values))
+    return variables
+
+
+def actor_layers(variables, scope):
+    """[(kernel rows, bias, activation)] with the batch norms folded in"""
+    layers = []
+    while True:
+        n = len(layers)
+        dense = "{}/fc{}".format(scope, n + 1)
+        if dense + "/kernel" not in variables:
+            break
+        (fan_in, fan_out), kernel = variables[dense + "/kernel"]
+        bias = variables[dense + "/bias"][1]
+        bn = "{}/batch_normalization{}".format(scope, "_{}".format(n) if n else "")
+        beta = variables[bn + "/beta"][1]
+        mean = variables[bn + "/moving_mean"][1]
+        variance = variables[bn + "/moving_variance"][1]
+        # scale=False: no gamma
+        gamma = variables.get(bn + "/gamma", (None, [1.0] * fan_out))[1]
+        scale = [g / math.sqrt(v + BN_EPSILON) for g, v in zip(gamma, variance)]
+        rows = [[kernel[i * fan_out + o] * scale[o] for o in range(fan_out)]
+                for i in range(fan_in)]
+        folded = [(b - m) * s + t for b, m, s, t in zip(bias, mean, scale, beta)]
+        layers.append((rows, folded, True))
+    if not layers:
+        raise ValueError("no {}/fc1 in the checkpoint".format(scope))
+    (fan_in, fan_out), kernel = variables[scope + "/dense/kernel"]
+    bias = variables[scope + "/dense/bias"][1]
+    if fan_out != 1:
+        raise ValueError("the actor must have one action, not {}".format(fan_out))
+    rows = [kernel[i * fan_out:(i + 1) * fan_out] for i in range(fan_in)]
+    layers.append((rows, bias, False))
+    for (rows, _, _), (next_rows, _, _) in zip(layers, layers[1:]):
+        if len(rows[0]) != len(next_rows):
+            raise ValueError("the layers of the actor do not chain")
+    return layers
+
+
+def float32(value):
+    return struct.unpack("<f", struct.pack("<f", value))[0]
+
+
+def literal(value):
+    """a hex float literal: exact, and shorter than decimal"""
+    mantissa, exponent = float.hex(float32(value)).split("p")
+    return "{}p{}f".format(mantissa.rstrip("0").rstrip("."), exponent)
+
+
+def array(values):
+    return ", ".join(literal(v) for v in values)
+
+
+def write_unit(output, layers, action_scale, source):
+    sizes = [len(layers[0][0])] + [len(bias) for _, bias, _ in layers]
+    lines = [
+        "// Generated by python/generate_actor.py from {}; do not edit.".format(
+            source),
+        "// Layers: {}, batch normalization folded in.".format(
+            " -> ".join(str(s) for s in sizes)),
+        '#include "compiled_actor.hh"',
+        "",
+        "#include <cmath>",
+        "",
+        "namespace {",
+        "",
+    ]
+    for n, size in enumerate(sizes):
+        lines.append("constexpr size_t kSize{} = {};".format(n, size))
+    lines.append("constexpr float kActionScale = {};".format(literal(action_scale)))
+    for n, (rows, bias, _) in enumerate(layers):
+        lines += [
+            "",
+            "alignas(64) const float kKernel{}[kSize{}][kSize{}] = {{".format(
+                n, n, n + 1),
+        ]
+        lines += ["    {{{}}},".format(array(row)) for row in rows]
+        lines += [
+            "};",
+            "alignas(64) const float kBias{}[kSize{}] = {{{}}};".format(
+                n, n + 1, array(bias)),
+        ]
+    lines += [
+        "",
+        "}  // namespace",
+        "",
+        "const size_t CompiledActor::kInputSize = kSize0;",
+        "",
+        "float CompiledActor::act(const float* state) {",
+    ]
+    for n in range(1, len(sizes)):
+        lines.append("  alignas(64) float h{}[kSize{}];".format(n, n))
+    previous = "state"
+    for n, (_, _, activation) in enumerate(layers):
+        lines.append(
+            "  compiled_actor::dense<kSize{}, kSize{}, {}>(kKernel{}, kBias{}, "
+            "{}, h{});".format(n, n + 1, "true" if activation else "false", n, n,
+                               previous, n + 1))
+        previous = "h{}".format(n + 1)
+    lines += [
+        "  return std::tanh({}[0]) * kActionScale;".format(previous),
+        "}",
+        "",
+    ]
+    with open(output, "w") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--checkpoint", required=True,
+                        help="checkpoint prefix, e.g. models/exported/model")
+    parser.add_argument("--output", required=True, help="the .cc to write")
+    parser.add_argument("--scope", default="actor")
+    parser.add_argument("--action-scale", type=float, default=1.0)
+    args = parser.parse_args()
+
+    layers = actor_layers(read_checkpoint(args.checkpoint), args.scope)
+    write_unit(args.output, layers, args.action_scale, args.checkpoint)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -1,6 +1,14 @@
 import numpy as np
 import random
 
+from helpers import context  # puts the native modules on sys.path
+
+try:
+    # src/pyenv/astraea_replay.cc, built with -DCOMPILE_PYTHON_ENV=ON
+    import astraea_replay
+except ImportError:
+    astraea_replay = None
+
 class ReplayBuffer(object):
     def __init__(self, size, s_dim, a_dim, g_dim, batch_size):
         self.size = size
@@ -245,7 +253,8 @@ class Prioritized_ReplayBuffer(object):  # stored as ( s, a, r, s_ ) in SumTree
             ISWeights[i, 0] = np.power(prob/min_prob, -self.beta)
             b_idx[i], b_memory[i] = idx, data
             i += 1
-        return b_idx, b_memory, ISWeights
+        # one sequence per field, as ReplayBuffer.sample()
+        return b_idx, list(zip(*b_memory)), ISWeights
 
     def update_priorities(self, tree_idx, abs_errors):
         abs_errors += self.epsilon  # convert to abs and avoid 0
@@ -254,5 +263,53 @@ class Prioritized_ReplayBuffer(object):  # stored as ( s, a, r, s_ ) in SumTree
         for ti, p in zip(tree_idx, ps):
             self.tree.update(ti, p)
 
-    
-        
\ No newline at end of file
+
+class NativeReplayBuffer(object):
+    """ReplayBuffer on the C++ buffer of astraea_replay"""
+
+    def __init__(self, size, s_dim, a_dim, g_dim, batch_size):
+        self.size = size
+        self.batch_size = batch_size
+        self.buffer = astraea_replay.ReplayBuffer(
+            size, s_dim, a_dim, g_dim, seed=random.getrandbits(63))
+
+    def __len__(self) -> int:
+        return len(self.buffer)
+
+    def store(self, s0, g0, a, r, s1, g1, terminal):
+        self.buffer.store_many(
+            *[np.reshape(x, (1, -1)) for x in (s0, g0, a, r, s1, g1, terminal)])
+
+    def store_many(self, s0, g0, a, r, s1, g1, terminal, length):
+        self.buffer.store_many(
+            *[np.asarray(x)[:length] for x in (s0, g0, a, r, s1, g1, terminal)])
+
+    def sample(self):
+        return self.buffer.sample(self.batch_size)
+
+
+class NativePrioritizedReplayBuffer(NativeReplayBuffer):
+    """Prioritized_ReplayBuffer on the C++ buffer and sum tree of
+    astraea_replay; the indices of sample() are slots, not tree indices"""
+
+    def __init__(self, size, s_dim, a_dim, g_dim, batch_size):
+        self.size = size
+        self.batch_size = batch_size
+        config = astraea_replay.PrioritizedConfig()
+        for name in ("epsilon", "alpha", "beta", "abs_err_upper"):
+            setattr(config, name, getattr(Prioritized_ReplayBuffer, name))
+        config.beta_increment = Prioritized_ReplayBuffer.beta_increment_per_sampling
+        self.buffer = astraea_replay.PrioritizedReplayBuffer(
+            size, s_dim, a_dim, g_dim, config, seed=random.getrandbits(63))
+
+    def update_priorities(self, tree_idx, abs_errors):
+        self.buffer.update_priorities(tree_idx, abs_errors)
+
+
+def create_replay_buffer(size, s_dim, a_dim, g_dim, batch_size, prioritized=False):
+    """The native buffer when astraea_replay is built, else the Python one"""
+    if astraea_replay is not None:
+        cls = NativePrioritizedReplayBuffer if prioritized else NativeReplayBuffer
+    else:
+        cls = Prioritized_ReplayBuffer if prioritized else ReplayBuffer
+    return cls(size, s_dim, a_dim, g_dim, batch_size)
@@ -8,4 +8,7 @@ sys.path.append(helper_dir)
 
 log_dir = path.abspath(path.join(src_dir, os.pardir, 'log'))
 # project dir
-base_dir = path.abspath(path.join(src_dir, os.pardir)) 
\ No newline at end of file
+base_dir = path.abspath(path.join(src_dir, os.pardir)) 
+# native modules built with -DCOMPILE_PYTHON_ENV=ON
+lib_dir = path.join(base_dir, 'src', 'build', 'lib')
+sys.path.append(lib_dir)
@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+"""Decoder of the binary performance log written by src/net/perf_log.cc.
+
+The file is memory-mapped and every column of a segment is returned as a
+numpy view of the mapping, so loading does not parse or copy the data.
+
+Usage:
+    python3 perf_log.py client.bin > client.csv
+"""
+import mmap
+import struct
+import sys
+
+import numpy as np
+
+MAGIC = b"ASTRPERF"
+SEGMENT_MAGIC = 0x4D474553
+NAME_SIZE = 32
+TYPES = {0: np.uint64, 1: np.int64, 2: np.float64}
+
+FILE_HEADER = struct.Struct("<8sII")
+COLUMN_DESC = struct.Struct("<%dsB7x" % NAME_SIZE)
+SEGMENT_HEADER = struct.Struct("<IIQQ")
+
+
+def read_schema(buf):
+    magic, version, num_columns = FILE_HEADER.unpack_from(buf, 0)
+    if magic != MAGIC:
+        raise ValueError("not an Astraea perf log")
+    if version != 1:
+        raise ValueError("unsupported perf log version {}".format(version))
+    offset = FILE_HEADER.size
+    columns = []
+    for _ in range(num_columns):
+        name, type_id = COLUMN_DESC.unpack_from(buf, offset)
+        columns.append((name.rstrip(b"\0").decode(), TYPES[type_id]))
+        offset += COLUMN_DESC.size
+    return columns, offset
+
+
+def map_perf_log(path):
+    """Map a perf log; return (columns, segments).
+
+    columns is a list of (name, dtype); segments is a list of lists holding
+    one zero-copy numpy array per column. The arrays keep the mapping alive.
+    """
+    with open(path, "rb") as f:
+        buf = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+    columns, offset = read_schema(buf)
+    segments = []
+    while offset + SEGMENT_HEADER.size <= len(buf):
+        magic, _, capacity, rows = SEGMENT_HEADER.unpack_from(buf, offset)
+        if magic != SEGMENT_MAGIC:
+            raise ValueError("corrupted segment at offset {}".format(offset))
+        end = offset + SEGMENT_HEADER.size + len(columns) * capacity * 8
+        if end > len(buf):
+            # the writer was stopped while growing the file
+            break
+        offset += SEGMENT_HEADER.size
+        segment = []
+        for _, dtype in columns:
+            segment.append(np.frombuffer(buf, dtype=dtype, count=min(rows, capacity), offset=offset))
+            offset += capacity * 8
+        segments.append(segment)
+    return columns, segments
+
+
+def read_perf_log(path):
+    """Return an ordered dict-like list of (name, numpy column).
+
+    Columns of a single-segment log are views of the file; longer logs are
+    concatenated once.
+    """
+    columns, segments = map_perf_log(path)
+    out = []
+    for i, (name, dtype) in enumerate(columns):
+        chunks = [segment[i] for segment in segments]
+        if not chunks:
+            out.append((name, np.empty(0, dtype=dtype)))
+        elif len(chunks) == 1:
+            out.append((name, chunks[0]))
+        else:
+            out.append((name, np.concatenate(chunks)))
+    return out
+
+
+def to_csv(columns, out=sys.stdout):
+    out.write(",".join(name for name, _ in columns) + "\n")
+    for row in zip(*(col for _, col in columns)):
+        out.write(",".join(str(v) for v in row) + "\n")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2:
+        sys.stderr.write("Usage: {} PERF_LOG\n".format(sys.argv[0]))
+        sys.exit(1)
+    to_csv(read_perf_log(sys.argv[1]))
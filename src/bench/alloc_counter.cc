@@ -0,0 +1,51 @@
+#include "alloc_counter.hh"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+/* replace the global allocation functions to count calls and bytes; the
+ * counters are process-wide so allocations of helper threads are included */
+
+static std::atomic<uint64_t> num_allocations(0);
+static std::atomic<uint64_t> num_bytes(0);
+
+uint64_t allocation_count() {
+  return num_allocations.load(std::memory_order_relaxed);
+}
+
+uint64_t allocated_bytes() { return num_bytes.load(std::memory_order_relaxed); }
+
+static void* counted_malloc(std::size_t size) noexcept {
+  num_allocations.fetch_add(1, std::memory_order_relaxed);
+  num_bytes.fetch_add(size, std::memory_order_relaxed);
+  return std::malloc(size ? size : 1);
+}
+
+void* operator new(std::size_t size) {
+  if (void* ptr = counted_malloc(size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) { return ::operator new(size); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  return counted_malloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+  return counted_malloc(size);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+  std::free(ptr);
+}
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+  std::free(ptr);
+}
@@ -0,0 +1,47 @@
+#ifndef ALLOC_COUNTER_HH
+#define ALLOC_COUNTER_HH
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+/* heap allocations through operator new since the start of the process */
+uint64_t allocation_count();
+uint64_t allocated_bytes();
+
+/**
+ * @brief Reports the heap allocations of a benchmark loop as the "allocs"
+ * and "alloc_bytes" counters, averaged per iteration.
+ *
+ *   AllocationCounter allocs(state);
+ *   for (auto _ : state) { ... }
+ *
+ * Only operator new is counted: buffers that libraries take from malloc
+ * directly (e.g. TensorFlow tensors) do not show up.
+ */
+class AllocationCounter {
+ public:
+  explicit AllocationCounter(benchmark::State& state)
+      : state_(state),
+        count_(allocation_count()),
+        bytes_(allocated_bytes()) {}
+
+  ~AllocationCounter() {
+    state_.counters["allocs"] =
+        benchmark::Counter(double(allocation_count() - count_),
+                           benchmark::Counter::kAvgIterations);
+    state_.counters["alloc_bytes"] =
+        benchmark::Counter(double(allocated_bytes() - bytes_),
+                           benchmark::Counter::kAvgIterations);
+  }
+
+  AllocationCounter(const AllocationCounter&) = delete;
+  AllocationCounter& operator=(const AllocationCounter&) = delete;
+
+ private:
+  benchmark::State& state_;
+  uint64_t count_;
+  uint64_t bytes_;
+};
+
+#endif  // ALLOC_COUNTER_HH
@@ -0,0 +1,309 @@
+/**
+ * Microbenchmarks of the per-decision control path: building and parsing
+ * the state message, the flow context of the inference service, and the
+ * helpers around them. Run with --benchmark_format=json (or
+ * --benchmark_out=FILE) to compare two builds with Google Benchmark's
+ * tools/compare.py.
+ */
+#include <endian.h>
+#include <sys/socket.h>
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "alloc_counter.hh"
+#include "context.hh"
+#include "distilled_actor.hh"
+#include "file_descriptor.hh"
+#include "flow_table.hh"
+#include "serialization.hh"
+#include "tcp_info.hh"
+
+/* ALIVE, as in the clients */
+const int kAliveType = 3;
+
+static TCPDeepCCInfo sample_info() {
+  TCPDeepCCInfo info;
+  info.init();
+  info.min_rtt = 20000;
+  info.avg_urtt = 26000;
+  info.cnt = 12;
+  info.avg_thr = 12500000;
+  info.thr_cnt = 12;
+  info.cwnd = 220;
+  info.pacing_rate = 15000000;
+  info.lost_bytes = 2920;
+  info.srtt_us = 25000 << 3;
+  info.packets_out = 200;
+  info.retrans_out = 2;
+  info.max_packets_out = 210;
+  info.mss = 1448;
+  return info;
+}
+
+/* the state the clients build in get_tcp_deepcc_info_json() */
+static json sample_state() {
+  json state = sample_info().to_json();
+  state["max_tput"] = 12500000;
+  state["loss_ratio"] = 146000.0;
+  state["time_delta"] = 20000;
+  return state;
+}
+
+/* an ALIVE message as the clients frame it: 2-byte length + JSON */
+static std::string encode_json_message(const json& state, int flow_id,
+                                       int step) {
+  json message;
+  message["state"] = state;
+  message["flow_id"] = flow_id;
+  message["type"] = kAliveType;
+  message["step"] = step;
+  const std::string payload = message.dump();
+  return put_field(payload.size()) + payload;
+}
+
+/**
+ * A fixed-layout binary ALIVE message, the reference point for what the
+ * JSON encoding costs: header, flow id and step, then the raw info struct
+ * and the fields the client adds to it.
+ */
+struct BinaryState {
+  int32_t flow_id;
+  int32_t step;
+  TCPDeepCCInfo info;
+  uint64_t max_tput;
+  double loss_ratio;
+  uint64_t time_delta;
+};
+
+static void BM_MapAction(benchmark::State& state) {
+  AllocationCounter allocs(state);
+  float action = -1.0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(map_action(action, 220));
+    action = action > 1.0 ? -1.0 : action + 0.01;
+  }
+}
+BENCHMARK(BM_MapAction);
+
+static void BM_TransformState(benchmark::State& state) {
+  FlowContext context(0);
+  json data = sample_state();
+  AllocationCounter allocs(state);
+  for (auto _ : state) {
+    context.transform_state(data);
+  }
+}
+BENCHMARK(BM_TransformState);
+
+static void BM_FormatState(benchmark::State& state) {
+  FlowContext context(0);
+  json data = sample_state();
+  AllocationCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(context.format_state(data));
+  }
+}
+BENCHMARK(BM_FormatState);
+
+/* one decision of the distilled actor; the states vary, so the walks do not
+ * all take the same branches */
+static void BM_DistilledActor(benchmark::State& state) {
+  std::vector<std::vector<float>> states(1024,
+                                         std::vector<float>(kNNInputSize));
+  uint32_t seed = 1;
+  for (auto& s : states) {
+    for (auto& feature : s) {
+      seed = seed * 1664525 + 1013904223;
+      feature = float(seed >> 8) / (1 << 23);
+    }
+  }
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(DistilledActor::act(states[i++ & 1023].data()));
+  }
+}
+BENCHMARK(BM_DistilledActor);
+
+/* the lookup of every ALIVE message, at range(0) live flows */
+static void BM_FlowTableFind(benchmark::State& state) {
+  FlowTable table;
+  std::vector<int> handles;
+  for (int64_t i = 0; i < state.range(0); i++) {
+    handles.push_back(table.insert(0));
+  }
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(table.find(handles[i]));
+    i = (i + 1) % handles.size();
+  }
+}
+BENCHMARK(BM_FlowTableFind)->Range(1 << 10, 1 << 16);
+
+/* the table it replaces */
+static void BM_FlowMapFind(benchmark::State& state) {
+  std::unordered_map<int, FlowContext*> contexts;
+  std::vector<int> ids;
+  for (int64_t i = 0; i < state.range(0); i++) {
+    ids.push_back(rand());
+    contexts[ids.back()] = new FlowContext(ids.back());
+  }
+  size_t i = 0;
+  for (auto _ : state) {
+    const int id = ids[i];
+    if (contexts.find(id) != contexts.end()) {
+      benchmark::DoNotOptimize(contexts[id]);
+    }
+    i = (i + 1) % ids.size();
+  }
+  for (auto& entry : contexts) {
+    delete entry.second;
+  }
+}
+BENCHMARK(BM_FlowMapFind)->Range(1 << 10, 1 << 16);
+
+static void BM_MergeInfo(benchmark::State& state) {
+  TCPDeepCCInfo dst = sample_info();
+  const TCPDeepCCInfo src = sample_info();
+  AllocationCounter allocs(state);
+  for (auto _ : state) {
+    dst.merge_info(src);
+    benchmark::DoNotOptimize(dst);
+    dst.cnt = 12;
+    dst.thr_cnt = 12;
+  }
+}
+BENCHMARK(BM_MergeInfo);
+
+static void BM_PutField(benchmark::State& state) {
+  AllocationCounter allocs(state);
+  uint16_t n = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(put_field(n++));
+  }
+}
+BENCHMARK(BM_PutField);
+
+static void BM_GetUint16(benchmark::State& state) {
+  const std::string field = put_field(1234);
+  AllocationCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(get_uint16(field.data()));
+  }
+}
+BENCHMARK(BM_GetUint16);
+
+/* both ends of a UNIX stream, as between a client and the service */
+struct SocketPair {
+  SocketPair() : ends(make()) {}
+  static std::pair<FileDescriptor, FileDescriptor> make() {
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+      throw std::runtime_error("socketpair failed");
+    }
+    return {FileDescriptor(fds[0]), FileDescriptor(fds[1])};
+  }
+  std::pair<FileDescriptor, FileDescriptor> ends;
+};
+
+/* one framed message there and back with the string API */
+static void BM_FrameRoundTripString(benchmark::State& state) {
+  const std::string payload = sample_state().dump();
+  SocketPair pair;
+  AllocationCounter allocs(state);
+  for (auto _ : state) {
+    pair.ends.first.write(put_field(payload.size()) + payload);
+    const auto header = pair.ends.second.read_exactly(2);
+    benchmark::DoNotOptimize(
+        pair.ends.second.read_exactly(get_uint16(header.data())));
+  }
+}
+BENCHMARK(BM_FrameRoundTripString);
+
+/* the same with writev and a reused receive buffer */
+static void BM_FrameRoundTripBuffer(benchmark::State& state) {
+  const std::string payload = sample_state().dump();
+  SocketPair pair;
+  std::vector<char> buffer(MAX_MESSAGE_SIZE);
+  AllocationCounter allocs(state);
+  for (auto _ : state) {
+    write_message(pair.ends.first, payload);
+    benchmark::DoNotOptimize(read_message(pair.ends.second, buffer.data()));
+  }
+}
+BENCHMARK(BM_FrameRoundTripBuffer);
+
+static void BM_EncodeJson(benchmark::State& state) {
+  const TCPDeepCCInfo info = sample_info();
+  AllocationCounter allocs(state);
+  int step = 0;
+  for (auto _ : state) {
+    // includes building the state, as the clients do every step
+    json data = info.to_json();
+    data["max_tput"] = 12500000;
+    data["loss_ratio"] = 146000.0;
+    data["time_delta"] = 20000;
+    benchmark::DoNotOptimize(encode_json_message(data, 1, step++));
+  }
+}
+BENCHMARK(BM_EncodeJson);
+
+static void BM_DecodeJson(benchmark::State& state) {
+  const std::string message = encode_json_message(sample_state(), 1, 0);
+  AllocationCounter allocs(state);
+  for (auto _ : state) {
+    // what the servers do before handing the state to the flow context
+    const uint16_t len = get_uint16(message.data());
+    json data = json::parse(message.begin() + 2, message.begin() + 2 + len);
+    int type = data.at("type");
+    int flow_id = data.at("flow_id");
+    uint32_t cwnd = data.at("state").at("cwnd");
+    benchmark::DoNotOptimize(type + flow_id + cwnd);
+  }
+  state.SetBytesProcessed(state.iterations() * message.size());
+}
+BENCHMARK(BM_DecodeJson);
+
+static void BM_EncodeBinary(benchmark::State& state) {
+  const TCPDeepCCInfo info = sample_info();
+  std::string buffer;
+  buffer.reserve(2 + sizeof(BinaryState));
+  AllocationCounter allocs(state);
+  int step = 0;
+  for (auto _ : state) {
+    BinaryState message{1, step++, info, 12500000, 146000.0, 20000};
+    buffer.clear();
+    const uint16_t len = htobe16(sizeof(message));
+    buffer.append(reinterpret_cast<const char*>(&len), sizeof(len));
+    buffer.append(reinterpret_cast<const char*>(&message), sizeof(message));
+    benchmark::DoNotOptimize(buffer.data());
+  }
+}
+BENCHMARK(BM_EncodeBinary);
+
+static void BM_DecodeBinary(benchmark::State& state) {
+  BinaryState sample{1, 0, sample_info(), 12500000, 146000.0, 20000};
+  std::string message = put_field(sizeof(sample));
+  message.append(reinterpret_cast<const char*>(&sample), sizeof(sample));
+  AllocationCounter allocs(state);
+  for (auto _ : state) {
+    if (get_uint16(message.data()) != sizeof(BinaryState)) {
+      state.SkipWithError("bad length");
+      break;
+    }
+    BinaryState decoded;
+    // TCPDeepCCInfo has a user-declared operator=, but is trivially copyable
+    std::memcpy(static_cast<void*>(&decoded), message.data() + 2,
+                sizeof(decoded));
+    benchmark::DoNotOptimize(decoded);
+  }
+  state.SetBytesProcessed(state.iterations() * message.size());
+}
+BENCHMARK(BM_DecodeBinary);
+
+BENCHMARK_MAIN();
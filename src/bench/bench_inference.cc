@@ -0,0 +1,113 @@
+/**
+ * Microbenchmarks of the inference service's model path, at batch sizes
+ * from 1 to 1024, for each InferenceBackend that loads. The TensorFlow
+ * backend needs a trained model:
+ *   bench_inference --graph=models/my-model.meta --checkpoint=models/my-model
+ * --backends=tf,compiled picks the backends (default: all of them).
+ * Google Benchmark's own --benchmark_* flags are accepted as well.
+ */
+#include <getopt.h>
+
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "alloc_counter.hh"
+#include "define.hh"
+#include "inference_backend.hh"
+#include "tf_backend.hh"
+
+/* `batch` states, one after the other */
+static std::vector<float> sample_states(int batch) {
+  std::vector<float> states(batch * kNNInputSize);
+  for (int i = 0; i < batch; ++i) {
+    for (size_t j = 0; j < kNNInputSize; ++j) {
+      states[i * kNNInputSize + j] = float((i + j) % 20) / 10;
+    }
+  }
+  return states;
+}
+
+static void BM_PrepareBatchInput(benchmark::State& state) {
+  const int batch = state.range(0);
+  const auto states = sample_states(batch);
+  AllocationCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        TFSessionBackend::prepare_batch_input(states.data(), batch));
+  }
+  state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_PrepareBatchInput)->RangeMultiplier(2)->Range(1, 1024);
+
+/* what the batch loop runs, for the backend given */
+static void BM_Infer(benchmark::State& state, InferenceBackend* backend) {
+  const int batch = state.range(0);
+  const auto states = sample_states(batch);
+  std::vector<float> actions(batch);
+  AllocationCounter allocs(state);
+  for (auto _ : state) {
+    backend->infer(states.data(), batch, actions.data());
+    benchmark::DoNotOptimize(actions.data());
+  }
+  state.SetItemsProcessed(state.iterations() * batch);
+}
+
+void usage_error(char** argv) {
+  std::cerr << "Usage: " << argv[0] << " [-g|--graph] <graph-file> "
+            << "[-c|--checkpoint] <checkpoint-path> "
+            << "[-k|--backends] tf,tree,compiled [--benchmark_...]\n";
+  exit(1);
+}
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+
+  const option opts[] = {{"graph", required_argument, nullptr, 'g'},
+                         {"checkpoint", required_argument, nullptr, 'c'},
+                         {"backends", required_argument, nullptr, 'k'},
+                         {0, 0, nullptr, 0}};
+  std::string backend_names = "tf,tree,compiled";
+  int opt;
+  while ((opt = getopt_long(argc, argv, "g:c:k:", opts, nullptr)) != -1) {
+    switch (opt) {
+    case 'g':
+      graphPath = optarg;
+      break;
+    case 'c':
+      checkpointPath = optarg;
+      break;
+    case 'k':
+      backend_names = optarg;
+      break;
+    default:
+      usage_error(argv);
+    }
+  }
+  // load the models before any timing starts; one that does not load is
+  // skipped
+  std::vector<std::unique_ptr<InferenceBackend>> backends;
+  std::istringstream names(backend_names);
+  std::string name;
+  while (std::getline(names, name, ',')) {
+    try {
+      backends.push_back(InferenceBackend::create(name));
+    } catch (const std::exception& e) {
+      std::cerr << "Skipping backend " << name << ": " << e.what()
+                << std::endl;
+      continue;
+    }
+    benchmark::RegisterBenchmark(("BM_Infer/" + name).c_str(), BM_Infer,
+                                 backends.back().get())
+        ->RangeMultiplier(2)
+        ->Range(1, 1024)
+        ->Unit(benchmark::kMicrosecond);
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,113 @@
+/**
+ * Microbenchmarks of the native replay buffers at the training settings of
+ * astraea.json: 400000 transitions, batches of 192, 5-step states.
+ */
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "alloc_counter.hh"
+#include "replay_buffer.hh"
+
+const size_t kMemSize = 400000;
+const size_t kBatchSize = 192;
+const size_t kStateDim = 50;
+const size_t kGlobalDim = 12;
+const size_t kActionDim = 1;
+
+/* `n` rows of every field */
+struct Columns {
+  explicit Columns(size_t n)
+      : s0(n * kStateDim), g0(n * kGlobalDim), a(n * kActionDim), r(n),
+        s1(n * kStateDim), g1(n * kGlobalDim), terminal(n) {}
+
+  TransitionRows rows() const {
+    return {s0.data(), g0.data(), a.data(),       r.data(),
+            s1.data(), g1.data(), terminal.data()};
+  }
+  TransitionBatch batch() {
+    return {s0.data(), g0.data(), a.data(),       r.data(),
+            s1.data(), g1.data(), terminal.data()};
+  }
+
+  std::vector<float> s0, g0, a, r, s1, g1, terminal;
+};
+
+template <typename Buffer>
+static void fill(Buffer& buffer) {
+  const Columns chunk(1000);
+  for (size_t i = 0; i < kMemSize; i += 1000) {
+    buffer.store(chunk.rows(), 1000);
+  }
+}
+
+static void BM_StoreMany(benchmark::State& state) {
+  // shared by the threads, which store concurrently
+  static ReplayBuffer buffer(kMemSize, kStateDim, kActionDim, kGlobalDim);
+  const Columns chunk(state.range(0));
+  AllocationCounter allocs(state);
+  for (auto _ : state) {
+    buffer.store(chunk.rows(), state.range(0));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StoreMany)->Arg(1)->Arg(64)->Arg(1024)->ThreadRange(1, 4);
+
+static void BM_Sample(benchmark::State& state) {
+  ReplayBuffer buffer(kMemSize, kStateDim, kActionDim, kGlobalDim);
+  fill(buffer);
+  Columns out(kBatchSize);
+  AllocationCounter allocs(state);
+  for (auto _ : state) {
+    buffer.sample(kBatchSize, out.batch(), nullptr);
+    benchmark::DoNotOptimize(out.s0.data());
+  }
+}
+BENCHMARK(BM_Sample);
+
+static void BM_PrioritizedStoreMany(benchmark::State& state) {
+  PrioritizedReplayBuffer buffer(kMemSize, kStateDim, kActionDim, kGlobalDim);
+  const Columns chunk(state.range(0));
+  AllocationCounter allocs(state);
+  for (auto _ : state) {
+    buffer.store(chunk.rows(), state.range(0));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PrioritizedStoreMany)->Arg(1)->Arg(64)->Arg(1024);
+
+/* one learner step: sample a batch, then update its priorities */
+static void BM_PrioritizedSampleUpdate(benchmark::State& state) {
+  PrioritizedReplayBuffer buffer(kMemSize, kStateDim, kActionDim, kGlobalDim);
+  fill(buffer);
+  Columns out(kBatchSize);
+  std::vector<int64_t> indices(kBatchSize);
+  std::vector<float> weights(kBatchSize), errors(kBatchSize);
+  AllocationCounter allocs(state);
+  float error = 0;
+  for (auto _ : state) {
+    buffer.sample(kBatchSize, out.batch(), indices.data(), weights.data());
+    for (float& e : errors) {
+      e = error = error > 1 ? 0 : error + 0.01;
+    }
+    buffer.update_priorities(indices.data(), errors.data(), kBatchSize);
+  }
+}
+BENCHMARK(BM_PrioritizedSampleUpdate);
+
+static void BM_SumTreeFind(benchmark::State& state) {
+  SumTree tree(kMemSize);
+  for (size_t i = 0; i < kMemSize; i++) {
+    tree.update(i, 0.01 + i % 100 * 0.01);
+  }
+  const double step = tree.total() / 9973;
+  double value = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(tree.find(value));
+    value = value + step < tree.total() ? value + step : 0;
+  }
+}
+BENCHMARK(BM_SumTreeFind);
+
+BENCHMARK_MAIN();
@@ -1,4 +1,5 @@
 #include <getopt.h>
+#include <poll.h>
 #include <signal.h>
 #include <stdio.h>
 
@@ -15,19 +16,28 @@
 #include "address.hh"
 #include "child_process.hh"
 #include "common.hh"
+#include "config.h"
+#include "control_interval.hh"
 #include "current_time.hh"
 #include "deepcc_socket.hh"
 #include "exception.hh"
+#include "fallback_controller.hh"
 #include "filesystem.hh"
 #include "ipc_socket.hh"
 #include "json.hpp"
 #include "logging.hh"
+#include "perf_log.hh"
 #include "pid.hh"
 #include "poller.hh"
 #include "serialization.hh"
+#include "sim_backend.hh"
 #include "socket.hh"
 #include "system_runner.hh"
 #include "tcp_info.hh"
+#ifdef HAVE_IO_URING
+#include "bulk_sender.hh"
+#include "io_uring.hh"
+#endif
 
 using namespace std;
 using namespace std::literals;
@@ -41,12 +51,22 @@ using IPC_ptr = std::unique_ptr<IPCSocket>;
 
 // send_traffic should be atomic
 std::atomic<bool> send_traffic(true);
+#ifdef HAVE_IO_URING
+/* send the traffic with io_uring zero-copy sends */
+bool use_io_uring = false;
+#endif
 int global_flow_id = -1;
 std::unique_ptr<ChildProcess> astraea_pyhelper = nullptr;
 std::unique_ptr<IPCSocket> ipc = nullptr;
 std::chrono::_V2::system_clock::time_point ts_now = clock_type::now();
-std::unique_ptr<std::ofstream> perf_log;
+std::unique_ptr<PerfLog> perf_log;
 bool terminal_out = false;
+/* how long a step waits for its action; 0: until the next control tick */
+std::chrono::microseconds inference_deadline(0);
+/* sets the window of the steps whose action is late */
+FallbackController fallback;
+/* actions the helper still owes for steps that gave up on them */
+size_t owed_replies = 0;
 /* define message type */
 enum class MessageType { INIT = 0, START = 1, END = 2, ALIVE = 3, OBSERVE = 4 };
 
@@ -73,23 +93,22 @@ void ipc_send_message(IPC_ptr& ipc_sock, const MessageType& type,
     message["type"] = to_underlying(type);
   }
 
-  uint16_t len = message.dump().length();
   if (ipc_sock) {
-    ipc_sock->write(put_field(len) + message.dump());
+    write_message(*ipc_sock, message.dump());
   }
 }
 
 void signal_handler(int sig) {
   if (sig == SIGINT or sig == SIGKILL or sig == SIGTERM) {
     LOG(INFO) << "Caught signal, Client " << global_flow_id << " exiting...";
+    LOG(INFO) << "Client " << global_flow_id
+              << " fallback steps: " << fallback.steps();
     // first disable read from fd
     // disable write to IPC
     send_traffic = false;
     // terminate pyhelper
-    // close iperf
-    if (perf_log) {
-      perf_log->close();
-    }
+    // no close: other threads may still append, and the rows of a shared
+    // mapping reach the file without one
     if (astraea_pyhelper) {
       astraea_pyhelper->signal(SIGKILL);
     }
@@ -99,17 +118,48 @@ void signal_handler(int sig) {
   }
 }
 
-void do_congestion_control(DeepCCSocket& sock, IPC_ptr& ipc_sock) {
+/* wait for the action of the step until the deadline. The helper answers in
+ * order, so the actions of earlier steps that gave up on theirs come first
+ * and are dropped */
+bool ipc_recv_action(IPC_ptr& ipc_sock, const clock_type::time_point deadline,
+                     int& cwnd) {
+  static char reply_buffer[MAX_MESSAGE_SIZE];
+  while (true) {
+    // rounded up, so a wait under 1 ms is not cut short; once the deadline
+    // has passed, a reply already received is still read
+    const auto left = std::chrono::ceil<std::chrono::milliseconds>(
+                          deadline - clock_type::now())
+                          .count();
+    pollfd pfd = {ipc_sock->fd_num(), POLLIN, 0};
+    if (SystemCall("poll", ::poll(&pfd, 1, left > 0 ? left : 0)) == 0) {
+      return false;
+    }
+    const auto data = read_message(*ipc_sock, reply_buffer);
+    if (owed_replies == 0) {
+      cwnd = json::parse(data.begin(), data.end()).at("cwnd");
+      return true;
+    }
+    owed_replies--;
+  }
+}
+
+/* returns the smoothed RTT of the step, which sets the next interval */
+uint64_t do_congestion_control(DeepCCSocket& sock, IPC_ptr& ipc_sock,
+                               const clock_type::time_point deadline) {
   auto state = sock.get_tcp_deepcc_info_json(RequestType::REQUEST_ACTION);
+  const uint64_t srtt_us = ControlInterval::srtt_us(state);
   LOG(TRACE) << "Client " << global_flow_id << " send state: " << state.dump();
   ipc_send_message(ipc_sock, MessageType::ALIVE, state);
   // set timestamp
   ts_now = clock_type::now();
-  // wait for action
-  auto header = ipc->read_exactly(2);
-  auto data_len = get_uint16(header.data());
-  auto data = ipc->read_exactly(data_len);
-  int cwnd = json::parse(data).at("cwnd");
+  // wait for action, at most until the deadline
+  int cwnd = 0;
+  if (not ipc_recv_action(ipc_sock, deadline, cwnd)) {
+    owed_replies++;
+    LOG(DEBUG) << "Client " << global_flow_id << " got no action in time";
+    // the window keeps moving without the helper
+    cwnd = fallback.cwnd(state);
+  }
   sock.set_tcp_cwnd(cwnd);
   auto elapsed = clock_type::now() - ts_now;
   LOG(DEBUG)
@@ -117,28 +167,27 @@ void do_congestion_control(DeepCCSocket& sock, IPC_ptr& ipc_sock) {
       << std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()
       << "us";
   
-  if (perf_log ) {
+  if (perf_log) {
     // change srtt to us
     unsigned int srtt = state["srtt_us"];
     srtt = srtt >> 3;
     unsigned int avg_thr_mbps = static_cast<unsigned int>(state["avg_thr"]) / 1e6 * 8 ;
     unsigned int pacing = static_cast<unsigned int>(state["pacing_rate"]) / 1e6 * 8 ;
     auto millis_since_epoch = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
-    *perf_log << millis_since_epoch << ","
-              << state["min_rtt"] << "," 
-              << state["avg_urtt"] << ","
-              << state["cnt"] << "," 
-              << srtt << "," 
-              << avg_thr_mbps << "," 
-              << state["thr_cnt"] << ","  
-              << pacing << ","  
-              << state["loss_bytes"] << ","  
-              << state["packets_out"] << ","  
-              << state["retrans_out"] << "," 
-              << state["max_packets_out"] << ","  
-              << state["cwnd"] << "," 
-              << cwnd << endl;
-
+    perf_log->append({millis_since_epoch,
+                      state["min_rtt"].get<uint32_t>(),
+                      state["avg_urtt"].get<uint32_t>(),
+                      state["cnt"].get<uint32_t>(),
+                      srtt,
+                      avg_thr_mbps,
+                      state["thr_cnt"].get<uint32_t>(),
+                      pacing,
+                      state["loss_bytes"].get<uint32_t>(),
+                      state["packets_out"].get<uint32_t>(),
+                      state["retrans_out"].get<uint32_t>(),
+                      state["max_packets_out"].get<uint32_t>(),
+                      state["cwnd"].get<uint32_t>(),
+                      cwnd});
   }
   if (terminal_out) {
   // change srtt to us
@@ -160,9 +209,10 @@ void do_congestion_control(DeepCCSocket& sock, IPC_ptr& ipc_sock) {
             << state["retrans_out"] << "," 
             << state["max_packets_out"] << ","  
             << state["cwnd"] << "," 
-            << cwnd << endl;
+            << cwnd << "\n";
 
   }
+  return srtt_us;
 }
 
 void do_monitor(DeepCCSocket& sock) {
@@ -172,41 +222,73 @@ void do_monitor(DeepCCSocket& sock) {
       unsigned int srtt = state["srtt_us"];
       // change srtt to us
       srtt = srtt >> 3;
-      *perf_log << state["min_rtt"] << "\t" 
-                << state["avg_urtt"] << "\t"
-                << state["cnt"] << "\t" 
-                << srtt << "\t" 
-                << state["avg_thr"] << "\t" 
-                << state["thr_cnt"] << "\t" 
-                << state["pacing_rate"] << "\t" 
-                << state["loss_bytes"] << "\t" 
-                << state["packets_out"] << "\t" 
-                << state["retrans_out"] << "\t"
-                << state["max_packets_out"] << "\t" 
-                << state["cwnd"] << "\t"
-                << 0 << endl;
+      auto millis_since_epoch = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+      perf_log->append({millis_since_epoch,
+                        state["min_rtt"].get<uint32_t>(),
+                        state["avg_urtt"].get<uint32_t>(),
+                        state["cnt"].get<uint32_t>(),
+                        srtt,
+                        state["avg_thr"].get<uint64_t>(),
+                        state["thr_cnt"].get<uint32_t>(),
+                        state["pacing_rate"].get<uint32_t>(),
+                        state["loss_bytes"].get<uint32_t>(),
+                        state["packets_out"].get<uint32_t>(),
+                        state["retrans_out"].get<uint32_t>(),
+                        state["max_packets_out"].get<uint32_t>(),
+                        state["cwnd"].get<uint32_t>(),
+                        0});
     }
     std::this_thread::sleep_for(std::chrono::milliseconds(30));
   }
 }
 
 void control_thread(DeepCCSocket& sock, IPC_ptr& ipc,
-                    const std::chrono::milliseconds interval) {
+                    const ControlInterval interval) {
   // start regular congestion control parttern
   auto when_started = clock_type::now();
-  auto target_time = when_started + interval;
+  auto target_time =
+      when_started + std::chrono::microseconds(interval.fixed_us());
   while (send_traffic.load()) {
-    do_congestion_control(sock, ipc);
+    auto deadline = target_time;
+    if (inference_deadline.count() > 0) {
+      deadline = min(deadline, clock_type::now() + inference_deadline);
+    }
+    const uint64_t srtt_us = do_congestion_control(sock, ipc, deadline);
     std::this_thread::sleep_until(target_time);
-    target_time += interval;
+    target_time += std::chrono::microseconds(interval.next_us(srtt_us));
+  }
+}
+
+#ifdef HAVE_IO_URING
+/* returns once send_traffic is cleared, or early if io_uring cannot send */
+void io_uring_send(TCPSocket& sock) {
+  if (not IOUring::available()) {
+    LOG(WARNING) << "io_uring is not available, sending with write()";
+    return;
   }
+  BulkSender sender(sock);
+  const uint64_t bytes = sender.run(send_traffic);
+  LOG(INFO) << "Sent " << bytes << " bytes with io_uring";
 }
+#endif
 
 void data_thread(TCPSocket& sock, int duration_seconds) {
   // Store the start and end time
   auto start_time = clock_type::now();
   auto end_time   = start_time + std::chrono::seconds(duration_seconds);
 
+#ifdef HAVE_IO_URING
+  if (use_io_uring) {
+    if (duration_seconds > 0) {
+      // the sender only watches send_traffic
+      thread([end_time]() {
+        this_thread::sleep_until(end_time);
+        send_traffic = false;
+      }).detach();
+    }
+    io_uring_send(sock);
+  }
+#endif
   string data(BUFSIZ, 'a');
   while (send_traffic.load()) {
     // If we have a nonzero duration, check if we've hit the time limit
@@ -226,18 +308,36 @@ void usage_error(const string& program_name) {
   cerr << "Usage: " << program_name << " [OPTION]... [COMMAND]" << endl;
   cerr << endl;
   cerr << "Options = --ip=IP_ADDR --port=PORT --cong=ALGORITHM"
-          "--interval=INTERVAL (Milliseconds) --pyhelper=PYTHON_PATH "
-          "--model=MODEL_PATH --id=None --perf-log=None --duration=None"
+          "--interval=INTERVAL (Milliseconds) "
+          "--adaptive-interval=MULTIPLIER[:MIN_MS:MAX_MS] "
+          "--inference-deadline=MS --pyhelper=PYTHON_PATH "
+          "--model=MODEL_PATH --id=None --perf-log=None --duration=None "
+          "--deepcc-backend=kernel"
+#ifdef HAVE_IO_URING
+          " --io-uring"
+#endif
        << endl;
   cerr << endl;
   cerr << "Default congestion control algorithms for incoming TCP is CUBIC; "
        << endl
        << "Default control interval is 10ms; " << endl
+       << "--adaptive-interval steps every MULTIPLIER smoothed RTTs, within "
+          "[MIN_MS, MAX_MS] (default 5 and 200); "
+       << endl
+       << "--inference-deadline bounds the wait for an action (default: the "
+          "next control step), after which a native AIMD window is used; "
+       << endl
        << "Default flow id is None; " << endl
        << "pyhelper specifies the path of Python-inference script; " << endl
        << "model-path specifies the pre-trained model, and will be passed to "
-          "python inference module"
+          "python inference module; " << endl
+       << "--deepcc-backend=link:MBPS:RTT_MS[:QUEUE], "
+          "trace:MAHIMAHI_TRACE:RTT_MS[:QUEUE] or replay:PERF_LOG runs "
+          "without the patched kernel; "
        << endl;
+#ifdef HAVE_IO_URING
+  cerr << "--io-uring sends with batched zero-copy io_uring sends; " << endl;
+#endif
 
   throw runtime_error("invalid arguments");
 }
@@ -263,15 +363,23 @@ int main(int argc, char** argv) {
       {"model", required_argument, nullptr, 'm'},
       {"cong", optional_argument, nullptr, 'c'},
       {"interval", optional_argument, nullptr, 't'},
+      {"adaptive-interval", required_argument, nullptr, 'v'},
+      {"inference-deadline", required_argument, nullptr, 'e'},
       {"id", optional_argument, nullptr, 'f'},
       {"perf-log", optional_argument, nullptr, 'l'},
       {"terminal-out", no_argument, nullptr, 's'},
       {"duration", optional_argument, nullptr, 'd'}, 
+      {"deepcc-backend", required_argument, nullptr, 'k'},
+#ifdef HAVE_IO_URING
+      {"io-uring", no_argument, nullptr, 'u'},
+#endif
       {0, 0, nullptr, 0}};
   int duration_seconds = 0;  // default = 0 means "run indefinitely"
   /* use RL inference or not */
   bool use_RL = false;
-  string ip, service, pyhelper, model, cong_ctl, interval, id, perf_log_path;
+  string ip, service, pyhelper, model, cong_ctl, interval, adaptive_interval,
+      id, perf_log_path;
+  string backend_spec = "kernel";
   while (true) {
     const int opt = getopt_long(argc, argv, "", command_line_options, nullptr);
     if (opt == -1) { /* end of options */
@@ -302,12 +410,26 @@ int main(int argc, char** argv) {
     case 't':
       interval = optarg;
       break;
+    case 'v':
+      adaptive_interval = optarg;
+      break;
+    case 'e':
+      inference_deadline = std::chrono::milliseconds(stoi(optarg));
+      break;
     case 's':
       terminal_out = true;
       break;
     case 'd':
       duration_seconds = stoi(optarg);
     break;
+    case 'k':
+      backend_spec = optarg;
+      break;
+#ifdef HAVE_IO_URING
+    case 'u':
+      use_io_uring = true;
+      break;
+#endif
     case '?':
       usage_error(argv[0]);
       break;
@@ -385,8 +507,15 @@ int main(int argc, char** argv) {
   DeepCCSocket client;
   client.set_reuseaddr();
   client.connect(address);
-
-  client.set_congestion_control(cong_ctl);
+  client.set_backend(make_deepcc_backend(
+      backend_spec, client.fd_num(),
+      std::chrono::duration_cast<std::chrono::microseconds>(control_interval)
+          .count()));
+
+  /* a simulated backend runs the window itself; keep the default module */
+  if (client.backend().in_kernel()) {
+    client.set_congestion_control(cong_ctl);
+  }
   client.set_nodelay();
   LOG(DEBUG) << "Client " << global_flow_id << " set congestion control to "
              << cong_ctl;
@@ -398,34 +527,37 @@ int main(int argc, char** argv) {
 
   /* setup performance log */
   if (not perf_log_path.empty()) {
-    perf_log.reset(new std::ofstream(perf_log_path));
-    if (not perf_log->good()) {
-      throw runtime_error(perf_log_path + ": error opening for writing");
-    }
-    // write header
-    *perf_log << "time,"
-              << "min_rtt,"
-              << "avg_urtt,"
-              << "cnt,"
-              << "srtt_us,"
-              << "avg_thr,"
-              << "thr_cnt,"
-              << "pacing_rate,"
-              << "loss_bytes,"
-              << "packets_out,"
-              << "retrans_out,"
-              << "max_packets_out,"
-              << "CWND in Kernel,"
-              << "CWND to Assign" << "\n";
-
+    perf_log.reset(new PerfLog(perf_log_path, {{"time", PerfType::U64},
+                                               {"min_rtt", PerfType::U64},
+                                               {"avg_urtt", PerfType::U64},
+                                               {"cnt", PerfType::U64},
+                                               {"srtt_us", PerfType::U64},
+                                               {"avg_thr", PerfType::U64},
+                                               {"thr_cnt", PerfType::U64},
+                                               {"pacing_rate", PerfType::U64},
+                                               {"loss_bytes", PerfType::U64},
+                                               {"packets_out", PerfType::U64},
+                                               {"retrans_out", PerfType::U64},
+                                               {"max_packets_out", PerfType::U64},
+                                               {"CWND in Kernel", PerfType::U64},
+                                               {"CWND to Assign", PerfType::U64}}));
   }
   cout << "----START----" << "\n";
 
+  /* adaptive, the interval of each step follows the RTT */
+  ControlInterval intervals(
+      std::chrono::duration_cast<std::chrono::microseconds>(control_interval)
+          .count());
+  if (not adaptive_interval.empty()) {
+    intervals.set_adaptive(adaptive_interval);
+    LOG(INFO) << "Client " << global_flow_id << " control interval is "
+              << intervals.to_string();
+  }
   /* start data thread and control thread */
   thread ct;
   if (use_RL and ipc != nullptr) {
     ct = std::move(thread(control_thread, std::ref(client), std::ref(ipc),
-                          control_interval));
+                          intervals));
     LOG(DEBUG) << "Client " << global_flow_id << " Started control thread ... ";
   } else if (cong_ctl != "astraea" and perf_log != nullptr) {
     // launch control threads
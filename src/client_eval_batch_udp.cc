@@ -1,4 +1,5 @@
 #include <getopt.h>
+#include <poll.h>
 #include <signal.h>
 #include <stdio.h>
 
@@ -14,20 +15,31 @@
 
 #include "address.hh"
 #include "child_process.hh"
+#include "chrome_trace.hh"
 #include "common.hh"
+#include "config.h"
+#include "control_interval.hh"
 #include "current_time.hh"
 #include "deepcc_socket.hh"
 #include "exception.hh"
+#include "fallback_controller.hh"
 #include "filesystem.hh"
 #include "ipc_socket.hh"
 #include "json.hpp"
 #include "logging.hh"
+#include "perf_log.hh"
 #include "pid.hh"
 #include "poller.hh"
 #include "serialization.hh"
+#include "sim_backend.hh"
 #include "socket.hh"
+#include "step_trace.hh"
 #include "system_runner.hh"
 #include "tcp_info.hh"
+#ifdef HAVE_IO_URING
+#include "bulk_sender.hh"
+#include "io_uring.hh"
+#endif
 
 using namespace std;
 using namespace std::literals;
@@ -40,12 +52,26 @@ using json = nlohmann::json;
 
 // send_traffic should be atomic
 std::atomic<bool> send_traffic(true);
+#ifdef HAVE_IO_URING
+/* send the traffic with io_uring zero-copy sends */
+bool use_io_uring = false;
+#endif
 int global_flow_id = 0;
 std::unique_ptr<UDPSocket> inference_server = nullptr;
 
 Address inference_server_addr;
 std::chrono::_V2::system_clock::time_point ts_now = clock_type::now();
-std::unique_ptr<std::ofstream> perf_log;
+std::unique_ptr<PerfLog> perf_log;
+std::unique_ptr<ChromeTrace> trace;
+/* control step id, echoed back by the inference service */
+int control_step = 0;
+/* replies that missed their deadline / arrived after it */
+size_t late_replies = 0;
+size_t stale_replies = 0;
+/* how long a step waits for its action; 0: until the next control tick */
+std::chrono::microseconds inference_deadline(0);
+/* sets the window of the steps whose action is late */
+FallbackController fallback;
 
 /* define message type */
 enum class MessageType { INIT = 0, START = 1, END = 2, ALIVE = 3, OBSERVE = 4 };
@@ -60,7 +86,8 @@ const char* ALG = "Astraea";
 
 void udp_send_message(std::unique_ptr<UDPSocket>& ipc_sock,
                       const MessageType& type, const json& state,
-                      const int observer_id = -1, const int step = -1) {
+                      const int observer_id = -1, const int step = -1,
+                      const uint64_t send_us = 0) {
   json message;
   if (!state.empty()) {
     message["state"] = state;
@@ -74,37 +101,77 @@ void udp_send_message(std::unique_ptr<UDPSocket>& ipc_sock,
   } else {
     // we just need to copy the type
     message["type"] = to_underlying(type);
+    if (type == MessageType::ALIVE and step >= 0) {
+      message["step"] = step;
+    }
+  }
+  // asks the inference service to return its hop timestamps
+  if (send_us != 0) {
+    message["t_send"] = send_us;
   }
 
-  uint16_t len = message.dump().length();
   if (ipc_sock) {
-    ipc_sock->sendto(inference_server_addr, put_field(len) + message.dump());
+    const std::string payload = message.dump();
+    char header[2];
+    put_field(payload.length(), header);
+    const iovec iov[2] = {
+        {header, 2}, {const_cast<char*>(payload.data()), payload.length()}};
+    ipc_sock->sendtov(inference_server_addr, iov, 2);
   }
 }
 
-std::string udp_recv_message(std::unique_ptr<UDPSocket>& ipc_sock) {
-  auto msg = ipc_sock->recvfrom().second;
+/* one reply, received into a buffer that is reused by every call */
+json udp_recv_message(std::unique_ptr<UDPSocket>& ipc_sock) {
+  static char buffer[MAX_MESSAGE_SIZE];
   // first two bytes is the length of the message
-  auto header = msg.substr(0, 2);
-  auto data_len = get_uint16(header.data());
+  char header[2];
+  const iovec iov[2] = {{header, 2}, {buffer, sizeof(buffer)}};
+  const size_t length = ipc_sock->recvv(iov, 2);
 
-  if (data_len != msg.length() - 2) {
+  if (length < 2 or get_uint16(header) != length - 2) {
     throw runtime_error("Incomplete message received");
   }
-  auto data = msg.substr(2, data_len);
-  return data;
+  return json::parse(buffer, buffer + length - 2);
+}
+
+/* wait for the reply to `step` until the deadline; replies to earlier steps
+ * missed their control tick and are dropped */
+bool udp_recv_reply(std::unique_ptr<UDPSocket>& ipc_sock, const int step,
+                    const clock_type::time_point deadline, json& reply) {
+  while (true) {
+    // rounded up, so a wait under 1 ms is not cut short; once the deadline
+    // has passed, a reply already received is still read
+    const auto left = std::chrono::ceil<std::chrono::milliseconds>(
+                          deadline - clock_type::now())
+                          .count();
+    pollfd pfd = {ipc_sock->fd_num(), POLLIN, 0};
+    if (SystemCall("poll", ::poll(&pfd, 1, left > 0 ? left : 0)) == 0) {
+      return false;
+    }
+    reply = udp_recv_message(ipc_sock);
+    if (reply.value("step", step) >= step) {
+      return true;
+    }
+    stale_replies++;
+    LOG(DEBUG) << "Client " << global_flow_id << " drops stale reply of step "
+               << reply["step"];
+  }
 }
 
 void signal_handler(int sig) {
   if (sig == SIGINT or sig == SIGKILL or sig == SIGTERM) {
     LOG(INFO) << "Caught signal, Client " << global_flow_id << " exiting...";
+    LOG(INFO) << "Client " << global_flow_id << " late replies: " << late_replies
+              << ", stale replies: " << stale_replies
+              << ", fallback steps: " << fallback.steps();
     // first disable read from fd
     // disable write to IPC
     send_traffic = false;
     // terminate pyhelper
-    // close iperf
-    if (perf_log) {
-      perf_log->close();
+    // no close: other threads may still append, and the rows of a shared
+    // mapping reach the file without one
+    if (trace) {
+      trace->close();
     }
     if (inference_server) {
       udp_send_message(inference_server, MessageType::END, json());
@@ -114,57 +181,115 @@ void signal_handler(int sig) {
   }
 }
 
-void do_congestion_control(DeepCCSocket& sock,
-                           std::unique_ptr<UDPSocket>& ipc_sock) {
+/* returns the smoothed RTT of the step, which sets the next interval */
+uint64_t do_congestion_control(DeepCCSocket& sock,
+                           std::unique_ptr<UDPSocket>& ipc_sock,
+                           const clock_type::time_point deadline) {
+  ControlStep step = {++control_step, 0, steadyTime_microseconds(), 0, 0, 0};
   auto state = sock.get_tcp_deepcc_info_json(RequestType::REQUEST_ACTION);
+  const uint64_t srtt_us = ControlInterval::srtt_us(state);
   LOG(TRACE) << "Client " << global_flow_id << " send state: " << state.dump();
-  udp_send_message(ipc_sock, MessageType::ALIVE, state);
+  step.send_us = steadyTime_microseconds();
+  udp_send_message(ipc_sock, MessageType::ALIVE, state, -1, step.step,
+                   trace ? step.send_us : 0);
   // set timestamp
   ts_now = clock_type::now();
-  // wait for action
-  auto data = udp_recv_message(ipc_sock);
-  int cwnd = 0;
+  // wait for action, at most until the deadline
+  json reply;
+  bool in_time = false;
   try {
-    cwnd = json::parse(data).at("cwnd");
-  } catch (json::exception& e) {
-    LOG(WARNING) << "Client " << global_flow_id << " "
-                 << "Error parsing json: " << e.what();
-    return;
+    in_time = udp_recv_reply(ipc_sock, step.step, deadline, reply);
+    if (in_time) {
+      step.cwnd = reply.at("cwnd");
+    } else {
+      late_replies++;
+      LOG(DEBUG) << "Client " << global_flow_id << " got no action for step "
+                 << step.step << " in time";
+      if (trace) {
+        trace->instant("late_reply", "client", getpid(), global_flow_id,
+                       steadyTime_microseconds(),
+                       "{\"step\":" + to_string(step.step) + "}");
+      }
+    }
+  } catch (const std::exception& e) {
+    LOG(WARNING) << "Client " << global_flow_id
+                 << " failed to parse action: " << e.what();
+    in_time = false;
+  }
+  if (not in_time) {
+    // the window keeps moving without the inference service
+    step.cwnd = fallback.cwnd(state);
   }
+  const int cwnd = step.cwnd;
+  step.recv_us = steadyTime_microseconds();
   sock.set_tcp_cwnd(cwnd);
+  step.done_us = steadyTime_microseconds();
+  if (trace and in_time) {
+    trace_control_step(*trace, getpid(), global_flow_id, step,
+                       reply.value("trace", json()));
+  }
   auto elapsed = clock_type::now() - ts_now;
   LOG(DEBUG)
-      << "Client GET cwnd: " << cwnd << ", elapsed time is "
+      << "Client " << global_flow_id << " GET cwnd: " << cwnd
+      << ", elapsed time is "
       << std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()
       << "us";
   if (perf_log) {
     unsigned int srtt = state["srtt_us"];
     // change srtt to us
     srtt = srtt >> 3;
-    *perf_log << state["min_rtt"] << "\t" << state["avg_urtt"] << "\t"
-              << state["cnt"] << "\t" << srtt << "\t" << state["avg_thr"]
-              << "\t" << state["thr_cnt"] << "\t" << state["pacing_rate"]
-              << "\t" << state["loss_bytes"] << "\t" << state["packets_out"]
-              << "\t" << state["retrans_out"] << "\t"
-              << state["max_packets_out"] << "\t" << state["cwnd"] << "\t"
-              << cwnd << endl;
+    perf_log->append({state["min_rtt"].get<uint32_t>(),
+                      state["avg_urtt"].get<uint32_t>(),
+                      state["cnt"].get<uint32_t>(), srtt,
+                      state["avg_thr"].get<uint64_t>(),
+                      state["thr_cnt"].get<uint32_t>(),
+                      state["pacing_rate"].get<uint32_t>(),
+                      state["loss_bytes"].get<uint32_t>(),
+                      state["packets_out"].get<uint32_t>(),
+                      state["retrans_out"].get<uint32_t>(),
+                      state["max_packets_out"].get<uint32_t>(),
+                      state["cwnd"].get<uint32_t>(), cwnd});
   }
+  return srtt_us;
 }
 
 void control_thread(DeepCCSocket& sock, std::unique_ptr<UDPSocket>& ipc,
-                    const std::chrono::milliseconds interval) {
+                    const ControlInterval interval) {
   // start regular congestion control parttern
   auto when_started = clock_type::now();
-  auto target_time = when_started + interval;
+  auto target_time =
+      when_started + std::chrono::microseconds(interval.fixed_us());
   while (send_traffic.load()) {
-    do_congestion_control(sock, ipc);
+    auto deadline = target_time;
+    if (inference_deadline.count() > 0) {
+      deadline = min(deadline, clock_type::now() + inference_deadline);
+    }
+    const uint64_t srtt_us = do_congestion_control(sock, ipc, deadline);
     std::this_thread::sleep_until(target_time);
-    target_time += interval;
+    target_time += std::chrono::microseconds(interval.next_us(srtt_us));
   }
 }
 
+#ifdef HAVE_IO_URING
+/* returns once send_traffic is cleared, or early if io_uring cannot send */
+void io_uring_send(TCPSocket& sock) {
+  if (not IOUring::available()) {
+    LOG(WARNING) << "io_uring is not available, sending with write()";
+    return;
+  }
+  BulkSender sender(sock);
+  const uint64_t bytes = sender.run(send_traffic);
+  LOG(INFO) << "Sent " << bytes << " bytes with io_uring";
+}
+#endif
+
 void data_thread(TCPSocket& sock) {
   std::this_thread::sleep_for(std::chrono::seconds(3));
+#ifdef HAVE_IO_URING
+  if (use_io_uring) {
+    io_uring_send(sock);
+  }
+#endif
   string data(BUFSIZ, 'a');
   while (send_traffic.load()) {
     sock.write(data, true);
@@ -176,13 +301,34 @@ void usage_error(const string& program_name) {
   cerr << "Usage: " << program_name << " [OPTION]... [COMMAND]" << endl;
   cerr << endl;
   cerr << "Options = --ip=IP_ADDR --port=PORT --cong=ALGORITHM"
-          "--interval=INTERVAL (Milliseconds) --id=None --perf-log=None"
+          "--interval=INTERVAL (Milliseconds) "
+          "--adaptive-interval=MULTIPLIER[:MIN_MS:MAX_MS] "
+          "--inference-deadline=MS --id=None "
+          "--perf-log=None "
+          "--trace=None --deepcc-backend=kernel"
+#ifdef HAVE_IO_URING
+          " --io-uring"
+#endif
        << endl;
   cerr << endl;
   cerr << "Default congestion control algorithms for incoming TCP is CUBIC; "
        << endl
        << "Default control interval is 10ms; " << endl
-       << "Default flow id is None; " << endl;
+       << "--adaptive-interval steps every MULTIPLIER smoothed RTTs, within "
+          "[MIN_MS, MAX_MS] (default 5 and 200); "
+       << endl
+       << "--inference-deadline bounds the wait for an action (default: the "
+          "next control step), after which a native AIMD window is used; "
+       << endl
+       << "Default flow id is None; " << endl
+       << "--trace writes per-step latency in Chrome trace format; " << endl
+       << "--deepcc-backend=link:MBPS:RTT_MS[:QUEUE], "
+          "trace:MAHIMAHI_TRACE:RTT_MS[:QUEUE] or replay:PERF_LOG runs "
+          "without the patched kernel; "
+       << endl;
+#ifdef HAVE_IO_URING
+  cerr << "--io-uring sends with batched zero-copy io_uring sends; " << endl;
+#endif
 
   throw runtime_error("invalid arguments");
 }
@@ -205,13 +351,22 @@ int main(int argc, char** argv) {
       {"port", required_argument, nullptr, 'p'},
       {"cong", optional_argument, nullptr, 'c'},
       {"interval", optional_argument, nullptr, 't'},
+      {"adaptive-interval", required_argument, nullptr, 'v'},
+      {"inference-deadline", required_argument, nullptr, 'e'},
       {"id", optional_argument, nullptr, 'f'},
       {"perf-log", optional_argument, nullptr, 'l'},
+      {"trace", required_argument, nullptr, 'r'},
+      {"deepcc-backend", required_argument, nullptr, 'k'},
+#ifdef HAVE_IO_URING
+      {"io-uring", no_argument, nullptr, 'u'},
+#endif
       {0, 0, nullptr, 0}};
 
   /* use RL inference or not */
   bool use_RL = false;
-  string ip, service, pyhelper, model, cong_ctl, interval, id, perf_log_path;
+  string ip, service, pyhelper, model, cong_ctl, interval, adaptive_interval,
+      id, perf_log_path, trace_path;
+  string backend_spec = "kernel";
   while (true) {
     const int opt = getopt_long(argc, argv, "", command_line_options, nullptr);
     if (opt == -1) { /* end of options */
@@ -233,9 +388,26 @@ int main(int argc, char** argv) {
     case 'p':
       service = optarg;
       break;
+    case 'r':
+      trace_path = optarg;
+      break;
     case 't':
       interval = optarg;
       break;
+    case 'v':
+      adaptive_interval = optarg;
+      break;
+    case 'e':
+      inference_deadline = std::chrono::milliseconds(stoi(optarg));
+      break;
+    case 'k':
+      backend_spec = optarg;
+      break;
+#ifdef HAVE_IO_URING
+    case 'u':
+      use_io_uring = true;
+      break;
+#endif
     case '?':
       usage_error(argv[0]);
       break;
@@ -279,8 +451,7 @@ int main(int argc, char** argv) {
     json init_message;
     udp_send_message(inference_server, MessageType::START, init_message);
     LOG(INFO) << "Sent init message to inference server ...";
-    auto data = udp_recv_message(inference_server);
-    json reply = json::parse(data);
+    json reply = udp_recv_message(inference_server);
     global_flow_id = reply["flow_id"];
     LOG(INFO) << "Client " << global_flow_id
               << " IPC with env has been established, control interval is "
@@ -307,8 +478,15 @@ int main(int argc, char** argv) {
              sizeof(timeout));
   client.set_reuseaddr();
   client.connect(address);
+  client.set_backend(make_deepcc_backend(
+      backend_spec, client.fd_num(),
+      std::chrono::duration_cast<std::chrono::microseconds>(control_interval)
+          .count()));
 
-  client.set_congestion_control(cong_ctl);
+  /* a simulated backend runs the window itself; keep the default module */
+  if (client.backend().in_kernel()) {
+    client.set_congestion_control(cong_ctl);
+  }
   client.set_nodelay();
   LOG(DEBUG) << "Client " << global_flow_id << " set congestion control to "
              << cong_ctl;
@@ -320,30 +498,39 @@ int main(int argc, char** argv) {
 
   /* setup performance log */
   if (not perf_log_path.empty()) {
-    perf_log.reset(new std::ofstream(perf_log_path));
-    if (not perf_log->good()) {
-      throw runtime_error(perf_log_path + ": error opening for writing");
-    }
-    // write header
-    *perf_log << "min_rtt\t"
-              << "avg_urtt\t"
-              << "cnt\t"
-              << "srtt_us\t"
-              << "avg_thr\t"
-              << "thr_cnt\t"
-              << "pacing_rate\t"
-              << "loss_bytes\t"
-              << "packets_out\t"
-              << "retrans_out\t"
-              << "max_packets_out\t"
-              << "CWND in Kernel\t"
-              << "CWND to Assign" << endl;
+    perf_log.reset(new PerfLog(perf_log_path, {{"min_rtt", PerfType::U64},
+                                               {"avg_urtt", PerfType::U64},
+                                               {"cnt", PerfType::U64},
+                                               {"srtt_us", PerfType::U64},
+                                               {"avg_thr", PerfType::U64},
+                                               {"thr_cnt", PerfType::U64},
+                                               {"pacing_rate", PerfType::U64},
+                                               {"loss_bytes", PerfType::U64},
+                                               {"packets_out", PerfType::U64},
+                                               {"retrans_out", PerfType::U64},
+                                               {"max_packets_out", PerfType::U64},
+                                               {"CWND in Kernel", PerfType::U64},
+                                               {"CWND to Assign", PerfType::U64}}));
+  }
+  if (not trace_path.empty()) {
+    trace.reset(new ChromeTrace(trace_path));
+    trace->name_thread(getpid(), global_flow_id,
+                       "flow " + to_string(global_flow_id));
+  }
+  /* adaptive, the interval of each step follows the RTT */
+  ControlInterval intervals(
+      std::chrono::duration_cast<std::chrono::microseconds>(control_interval)
+          .count());
+  if (not adaptive_interval.empty()) {
+    intervals.set_adaptive(adaptive_interval);
+    LOG(INFO) << "Client " << global_flow_id << " control interval is "
+              << intervals.to_string();
   }
   /* start data thread and control thread */
   thread ct;
   if (use_RL and inference_server != nullptr) {
     ct = thread(control_thread, std::ref(client), std::ref(inference_server),
-                control_interval);
+                intervals);
     LOG(DEBUG) << "Client " << global_flow_id << " Started control thread ... ";
   }
   thread dt(data_thread, std::ref(client));
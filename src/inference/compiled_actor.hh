@@ -0,0 +1,63 @@
+#ifndef COMPILED_ACTOR_HH
+#define COMPILED_ACTOR_HH
+
+#include <cstddef>
+
+namespace compiled_actor {
+
+const float kLeakyReluAlpha = 0.2f;
+
+/**
+ * @brief One dense layer, out = activation(in * kernel + bias).
+ *
+ * The shapes are template arguments, so the compiler sees the trip counts and
+ * unrolls and vectorizes both loops. The inner loop runs along the outputs,
+ * over a contiguous row of the kernel, which vectorizes without reassociating
+ * floating point sums (no -ffast-math needed).
+ */
+template <size_t In, size_t Out, bool LeakyRelu>
+inline void dense(const float (&kernel)[In][Out], const float (&bias)[Out],
+                  const float* __restrict__ in, float* __restrict__ out) {
+  for (size_t o = 0; o < Out; o++) {
+    out[o] = bias[o];
+  }
+  for (size_t i = 0; i < In; i++) {
+    const float x = in[i];
+    for (size_t o = 0; o < Out; o++) {
+      out[o] += x * kernel[i][o];
+    }
+  }
+  if (LeakyRelu) {
+    for (size_t o = 0; o < Out; o++) {
+      out[o] = out[o] > 0.0f ? out[o] : out[o] * kLeakyReluAlpha;
+    }
+  }
+}
+
+}  // namespace compiled_actor
+
+/**
+ * @brief The actor, generated as C++ for the layer shapes of its checkpoint.
+ *
+ * python/generate_actor.py reads the exported checkpoint at build time, folds
+ * each batch normalization into its dense layer and writes act() with the
+ * weights as aligned static arrays. It computes what the TensorFlow actor does
+ * in inference mode, on one thread with no session and no batching.
+ */
+class CompiledActor {
+ public:
+  /* the features of a state; kNNInputSize unless the model was changed */
+  static const size_t kInputSize;
+
+  /* the action, within [-action scale, action scale], for one state */
+  static float act(const float* state);
+
+  /* the actions of `batch` states, one after the other in `states` */
+  static void act(const float* states, size_t batch, float* actions) {
+    for (size_t i = 0; i < batch; i++) {
+      actions[i] = act(states + i * kInputSize);
+    }
+  }
+};
+
+#endif  // COMPILED_ACTOR_HH
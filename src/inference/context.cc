@@ -1,5 +1,9 @@
 #include "context.hh"
 
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
 int map_action(float action, float cwnd) {
   int out;
   float tmp;
@@ -13,7 +17,14 @@ int map_action(float action, float cwnd) {
   return out;
 }
 
-FlowContext::FlowContext(int flow_id) : flow_id_(flow_id) {
+FlowContext::FlowContext(int flow_id)
+    : flow_id_(flow_id),
+      decided_(false),
+      decided_us_(0),
+      decided_rtt_(0),
+      decided_thr_(0),
+      current_(),
+      state_() {
   state_.resize(kStateSize * kRecurrentNum);
   std::fill(state_.begin(), state_.end(), 0);
   current_.resize(kStateSize);
@@ -95,4 +106,27 @@ void FlowContext::transform_state(json& state_dict) {
     current_[8] = 2;
   }
   assert(current_.size() == kStateSize);
-}
\ No newline at end of file
+}
+
+/* whether `value` moved by more than a fraction `epsilon` of `reference` */
+static bool moved(double value, double reference, double epsilon) {
+  return std::abs(value - reference) > epsilon * reference;
+}
+
+bool FlowContext::needs_decision(const json& state_dict, uint64_t now_us) {
+  const double rtt = state_dict.value("avg_urtt", 0.0);
+  const double thr = state_dict.value("avg_thr", 0.0);
+  const bool needed =
+      gateEpsilon <= 0 or not decided_ or
+      state_dict.value("loss_bytes", 0) > 0 or
+      moved(rtt, decided_rtt_, gateEpsilon) or
+      moved(thr, decided_thr_, gateEpsilon) or
+      now_us - decided_us_ >= static_cast<uint64_t>(gateMaxStale) * 1000;
+  if (needed) {
+    decided_ = true;
+    decided_us_ = now_us;
+    decided_rtt_ = rtt;
+    decided_thr_ = thr;
+  }
+  return needed;
+}
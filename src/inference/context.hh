@@ -1,8 +1,10 @@
 #ifndef CONTEXT_HH
 #define CONTEXT_HH
 
+#include <cstdint>
+#include <vector>
+
 #include "define.hh"
-#include "tf_inference.hh"
 
 int map_action(float action, float cwnd);
 
@@ -13,11 +15,26 @@ class FlowContext {
   // get new cwnd from model
   std::vector<float> format_state(json& data);
 
- private:
+  // normalize one state message into current_
   void transform_state(json& state_dict);
 
+  /**
+   * @brief The event gate: whether the state calls for a new decision.
+   *
+   * Always true unless gateEpsilon > 0. Then only a loss, an RTT or a
+   * throughput that moved by more than gateEpsilon since the last decided
+   * step, or gateMaxStale ms without a decision run the model; on other
+   * steps the flow keeps its window.
+   */
+  bool needs_decision(const json& state_dict, uint64_t now_us);
+
  private:
   int flow_id_;
+  // what the last decision saw
+  bool decided_;
+  uint64_t decided_us_;
+  double decided_rtt_;
+  double decided_thr_;
   // 1 * 10
   std::vector<float> current_;
   // 1 * 50
@@ -3,7 +3,12 @@
 std::string graphPath = "models/my-model.meta";
 std::string checkpointPath = "models/my-model";
 int batchMode = false;
+std::string backendName = "tf";
 std::string channel = "unix";
+int flowIdleTimeout = 60;
+int maxFlows = 65536;
+double gateEpsilon = 0;
+int gateMaxStale = 100;
 
 std::string print_state(const std::vector<float>& state) {
   std::string str = "[";
@@ -1,8 +1,10 @@
 #ifndef DEFINE_HH
 #define DEFINE_HH
 
+#include <functional>
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include "json.hpp"
 
@@ -13,7 +15,19 @@ using json = nlohmann::json;
 #define likely(x) __builtin_expect(!!(x), 1)
 #define unlikely(x) __builtin_expect(!!(x), 0)
 
-typedef std::function<void(float, const std::string&)> ResponseCallback;
+/**
+ * Timestamps of one control step inside the inference service, taken with
+ * steadyTime_microseconds(). Zero means the hop was not taken (e.g. no
+ * batch queue in immediate mode).
+ */
+struct StepTiming {
+  uint64_t enqueued_us = 0;
+  uint64_t infer_start_us = 0;
+  uint64_t infer_end_us = 0;
+};
+
+typedef std::function<void(float, const std::string&, const StepTiming&)>
+    ResponseCallback;
 
 const size_t kStateSize = 10;
 const size_t kRecurrentNum = 5;
@@ -29,6 +43,20 @@ extern std::string checkpointPath;
 extern std::string channel;
 
 extern int batchMode;
+
+// the InferenceBackend that decides the steps: tf, tree or compiled
+extern std::string backendName;
+
+// seconds without a message before a flow is reaped (0: never)
+extern int flowIdleTimeout;
+// flows tracked at once; a new one evicts the least recently seen
+extern int maxFlows;
+
+// event gate (FlowContext::needs_decision): relative change of RTT or
+// throughput that calls for a decision (0: decide every step), and the
+// longest a flow goes without one, in ms
+extern double gateEpsilon;
+extern int gateMaxStale;
 std::string print_state(const std::vector<float>& state);
 
 #endif  // DEFINE_HH
\ No newline at end of file
@@ -0,0 +1,38 @@
+#ifndef DISTILLED_ACTOR_HH
+#define DISTILLED_ACTOR_HH
+
+#include "define.hh"
+#include "distilled_actor_tables.hh"
+
+static_assert(distilled::kFeatures == kNNInputSize,
+              "the distilled tree was fitted to another state size");
+
+/**
+ * @brief The actor, distilled offline into a regression tree.
+ *
+ * python/distill_actor.py fits the tree to the actions of the exported actor
+ * on the states of simulated flows and compiles it in as constexpr tables
+ * (distilled_actor_tables.hh, which also records its error against the
+ * actor). A decision is one walk from the root, a compare per level on the
+ * state format_state() builds: tens of nanoseconds, with no model session
+ * and no batching.
+ */
+class DistilledActor {
+ public:
+  /* whether a tree has been generated */
+  static constexpr bool available() { return distilled::kAvailable; }
+
+  /* the action, within [-1, 1], for a state of kNNInputSize features */
+  static constexpr float act(const float* state) {
+    int node = 0;
+    while (distilled::kNodes[node].feature >= 0) {
+      const distilled::Node& split = distilled::kNodes[node];
+      // arithmetic, not a branch: the direction is hard to predict
+      const int left = state[split.feature] <= split.value;
+      node = split.right + left * (node + 1 - split.right);
+    }
+    return distilled::kNodes[node].value;
+  }
+};
+
+#endif  // DISTILLED_ACTOR_HH
@@ -0,0 +1,5459 @@
+// Generated by python/distill_actor.py from models/exported/model; do not edit.
+//
+// 5429 nodes, depth 16, against the actor on 30720 held-out states:
+//   action error: mean 0.0776, rmse 0.1319, p99 0.4672, max 1.7140
+//   window error: mean 0.193%, p99 1.161%
+//   direction agrees on 91.93% of the steps that move the window
+#ifndef DISTILLED_ACTOR_TABLES_HH
+#define DISTILLED_ACTOR_TABLES_HH
+
+#include <cstdint>
+
+namespace distilled {
+
+struct Node {
+  // index into the state; -1 for a leaf
+  int16_t feature;
+  // the right child; the left one follows its parent
+  int32_t right;
+  // state[feature] <= value goes left; a leaf's action
+  float value;
+};
+
+constexpr bool kAvailable = true;
+constexpr int kFeatures = 50;
+constexpr Node kNodes[] = {
+    {2, 678, 1.07029605f},
+    {4, 571, 0.499599695f},
+    {41, 300, 1.07642698f},
+    {40, 49, 0.995660186f},
+    {31, 42, 1.10197699f},
+    {1, 37, 1.04110479f},
+    {33, 36, 1.06438231f},
+    {41, 35, 1.04594278f},
+    {30, 12, 0.990193546f},
+    {33, 11, 0.970540404f},
+    {-1, 0, 0.999968708f},
+    {-1, 0, 0.999899983f},
+    {23, 26, 1.10617995f},
+    {33, 23, 1.00121045f},
+    {38, 18, 1.17258012f},
+    {3, 17, 0.962109208f},
+    {-1, 0, 0.999990284f},
+    {-1, 0, 0.999993443f},
+    {3, 22, 1.01391888f},
+    {14, 21, 0.0269364994f},
+    {-1, 0, 0.9999668f},
+    {-1, 0, 0.999977946f},
+    {-1, 0, 0.99998796f},
+    {11, 25, 1.0039072f},
+    {-1, 0, 0.999965906f},
+    {-1, 0, 0.999944866f},
+    {20, 34, 0.871244848f},
+    {31, 33, 1.009009f},
+    {40, 32, 0.976887703f},
+    {31, 31, 1.00357401f},
+    {-1, 0, 0.999997199f},
+    {-1, 0, 0.999996543f},
+    {-1, 0, 0.999997616f},
+    {-1, 0, 0.999996185f},
+    {-1, 0, 0.999999702f},
+    {-1, 0, 0.999892831f},
+    {-1, 0, 0.999469459f},
+    {31, 41, 1.01010144f},
+    {10, 40, 0.988072872f},
+    {-1, 0, 0.984030962f},
+    {-1, 0, 0.996968985f},
+    {-1, 0, 0.954794407f},
+    {0, 48, 0.931889594f},
+    {34, 47, 0.0229318999f},
+    {43, 46, 1.09922838f},
+    {-1, 0, 0.73843348f},
+    {-1, 0, 0.448842704f},
+    {-1, 0, 0.37411806f},
+    {-1, 0, 0.999303222f},
+    {42, 283, 1.07913935f},
+    {4, 264, 0.474941611f},
+    {31, 233, 1.21020007f},
+    {14, 184, 0.434532404f},
+    {42, 145, 1.04866946f},
+    {1, 140, 1.12920785f},
+    {4, 107, 0.350952208f},
+    {4, 86, 0.261460006f},
+    {45, 71, 0.156230003f},
+    {15, 64, 0.127900004f},
+    {1, 63, 1.06712174f},
+    {31, 62, 1.06470525f},
+    {-1, 0, 0.999998748f},
+    {-1, 0, 0.999992132f},
+    {-1, 0, 0.999999225f},
+    {41, 68, 1.0251435f},
+    {4, 67, 0.200259298f},
+    {-1, 0, 0.999994636f},
+    {-1, 0, 0.9999789f},
+    {14, 70, 0.202033311f},
+    {-1, 0, 0.999970257f},
+    {-1, 0, 0.999897122f},
+    {41, 79, 1.02068734f},
+    {44, 76, 0.206974f},
+    {43, 75, 1.08314598f},
+    {-1, 0, 0.999984145f},
+    {-1, 0, 0.999931991f},
+    {43, 78, 0.927065313f},
+    {-1, 0, 0.999950826f},
+    {-1, 0, 0.999901772f},
+    {4, 83, 0.1852936f},
+    {42, 82, 1.03505337f},
+    {-1, 0, 0.99993372f},
+    {-1, 0, 0.999856114f},
+    {43, 85, 0.957544267f},
+    {-1, 0, 0.999795973f},
+    {-1, 0, 0.999421895f},
+    {43, 100, 0.934770525f},
+    {43, 95, 0.910377562f},
+    {43, 92, 0.894983411f},
+    {43, 91, 0.886172056f},
+    {-1, 0, 0.999996006f},
+    {-1, 0, 0.999979198f},
+    {14, 94, 0.329548001f},
+    {-1, 0, 0.999950647f},
+    {-1, 0, 0.999911547f},
+    {42, 99, 1.0164336f},
+    {24, 98, 0.342295587f},
+    {-1, 0, 0.999879062f},
+    {-1, 0, 0.999796927f},
+    {-1, 0, 0.999754965f},
+    {43, 106, 0.952899456f},
+    {24, 105, 0.342295587f},
+    {41, 104, 1.0251435f},
+    {-1, 0, 0.999607384f},
+    {-1, 0, 0.999325454f},
+    {-1, 0, 0.999011695f},
+    {-1, 0, 0.998462379f},
+    {43, 135, 0.939059615f},
+    {43, 124, 0.913851917f},
+    {43, 117, 0.89905709f},
+    {43, 114, 0.89072293f},
+    {35, 113, 0.107964002f},
+    {-1, 0, 0.999992013f},
+    {-1, 0, 0.999958873f},
+    {13, 116, 0.891011894f},
+    {-1, 0, 0.999937236f},
+    {-1, 0, 0.999893427f},
+    {4, 121, 0.386916608f},
+    {43, 120, 0.906701088f},
+    {-1, 0, 0.999866426f},
+    {-1, 0, 0.999776483f},
+    {43, 123, 0.906701088f},
+    {-1, 0, 0.99977529f},
+    {-1, 0, 0.999651432f},
+    {43, 132, 0.930782914f},
+    {42, 129, 1.01912153f},
+    {24, 128, 0.41570881f},
+    {-1, 0, 0.999646485f},
+    {-1, 0, 0.999429345f},
+    {44, 131, 0.419316411f},
+    {-1, 0, 0.999465346f},
+    {-1, 0, 0.999068022f},
+    {41, 134, 1.02068734f},
+    {-1, 0, 0.99913168f},
+    {-1, 0, 0.998419344f},
+    {41, 139, 1.03239286f},
+    {14, 138, 0.401879787f},
+    {-1, 0, 0.998310745f},
+    {-1, 0, 0.997823596f},
+    {-1, 0, 0.995420992f},
+    {33, 144, 1.01951492f},
+    {48, 143, 1.20981205f},
+    {-1, 0, 0.999277115f},
+    {-1, 0, 0.998118937f},
+    {-1, 0, 0.990215063f},
+    {45, 171, 0.183740005f},
+    {5, 148, 0.141808003f},
+    {-1, 0, 0.999908984f},
+    {14, 168, 0.351918906f},
+    {24, 163, 0.296198696f},
+    {34, 158, 0.230289996f},
+    {15, 155, 0.178568006f},
+    {5, 154, 0.155471995f},
+    {-1, 0, 0.999753356f},
+    {-1, 0, 0.999544322f},
+    {31, 157, 1.04011178f},
+    {-1, 0, 0.999553502f},
+    {-1, 0, 0.998731077f},
+    {43, 162, 0.962236941f},
+    {43, 161, 0.952899456f},
+    {-1, 0, 0.999427438f},
+    {-1, 0, 0.998920262f},
+    {-1, 0, 0.99770689f},
+    {33, 167, 0.946895599f},
+    {33, 166, 0.929732561f},
+    {-1, 0, 0.998520911f},
+    {-1, 0, 0.997789741f},
+    {-1, 0, 0.995274544f},
+    {43, 170, 0.952899456f},
+    {-1, 0, 0.995591819f},
+    {-1, 0, 0.986963928f},
+    {4, 183, 0.338903695f},
+    {24, 182, 0.305140197f},
+    {24, 179, 0.2109873f},
+    {32, 178, 1.04334009f},
+    {44, 177, 0.120407604f},
+    {-1, 0, 0.999602139f},
+    {-1, 0, 0.999370456f},
+    {-1, 0, 0.998574555f},
+    {33, 181, 0.965614676f},
+    {-1, 0, 0.99792707f},
+    {-1, 0, 0.995700479f},
+    {-1, 0, 0.992064357f},
+    {-1, 0, 0.981823862f},
+    {43, 230, 0.957544267f},
+    {43, 221, 0.934770525f},
+    {43, 206, 0.917248428f},
+    {43, 205, 0.89905709f},
+    {5, 198, 0.111956f},
+    {43, 197, 0.881482244f},
+    {15, 194, 0.0855140015f},
+    {5, 193, 0.0650639981f},
+    {-1, 0, 0.999997437f},
+    {-1, 0, 0.999991477f},
+    {42, 196, 1.0091871f},
+    {-1, 0, 0.999986708f},
+    {-1, 0, 0.999968827f},
+    {-1, 0, 0.999950707f},
+    {43, 204, 0.89072293f},
+    {14, 203, 0.462029994f},
+    {3, 202, 0.889578402f},
+    {-1, 0, 0.999918282f},
+    {-1, 0, 0.999886632f},
+    {-1, 0, 0.999862909f},
+    {-1, 0, 0.999781072f},
+    {-1, 0, 0.99950105f},
+    {43, 216, 0.927065313f},
+    {41, 211, 1.01501763f},
+    {42, 210, 1.0143075f},
+    {-1, 0, 0.999194264f},
+    {-1, 0, 0.998791635f},
+    {34, 215, 0.490761787f},
+    {44, 214, 0.4787305f},
+    {-1, 0, 0.998878896f},
+    {-1, 0, 0.998373508f},
+    {-1, 0, 0.997820199f},
+    {8, 218, 1.15369546f},
+    {-1, 0, 0.996136844f},
+    {24, 220, 0.463643998f},
+    {-1, 0, 0.998330772f},
+    {-1, 0, 0.997283101f},
+    {43, 229, 0.94806385f},
+    {42, 226, 1.04866946f},
+    {14, 225, 0.462029994f},
+    {-1, 0, 0.996636212f},
+    {-1, 0, 0.994395137f},
+    {23, 228, 0.918576777f},
+    {-1, 0, 0.992759526f},
+    {-1, 0, 0.990583777f},
+    {-1, 0, 0.986782372f},
+    {24, 232, 0.463643998f},
+    {-1, 0, 0.970520139f},
+    {-1, 0, 0.950784683f},
+    {20, 261, 0.937120914f},
+    {45, 258, 0.156230003f},
+    {21, 245, 1.0f},
+    {45, 240, 0.0699800029f},
+    {41, 239, 1.04594278f},
+    {-1, 0, 1.0f},
+    {-1, 0, 0.999987841f},
+    {41, 244, 1.0251435f},
+    {45, 243, 0.074876003f},
+    {-1, 0, 0.999997973f},
+    {-1, 0, 0.99998343f},
+    {-1, 0, 0.999943137f},
+    {45, 257, 0.154042006f},
+    {45, 256, 0.151749998f},
+    {45, 255, 0.149488002f},
+    {45, 254, 0.146727994f},
+    {45, 253, 0.144843996f},
+    {45, 252, 0.140407994f},
+    {-1, 0, 1.0f},
+    {-1, 0, 1.0f},
+    {-1, 0, 1.0f},
+    {-1, 0, 1.0f},
+    {-1, 0, 1.0f},
+    {-1, 0, 1.0f},
+    {-1, 0, 1.0f},
+    {42, 260, 1.00372124f},
+    {-1, 0, 1.0f},
+    {-1, 0, 0.999773264f},
+    {0, 263, 0.931889594f},
+    {-1, 0, 0.842625678f},
+    {-1, 0, 0.997884154f},
+    {43, 282, 0.957544267f},
+    {44, 267, 0.513029099f},
+    {-1, 0, 0.966166735f},
+    {43, 281, 0.934770525f},
+    {43, 278, 0.920447409f},
+    {43, 275, 0.906701088f},
+    {15, 272, 0.116802f},
+    {-1, 0, 0.999951363f},
+    {43, 274, 0.89905709f},
+    {-1, 0, 0.999663711f},
+    {-1, 0, 0.999192834f},
+    {43, 277, 0.913851917f},
+    {-1, 0, 0.998988509f},
+    {-1, 0, 0.998204708f},
+    {43, 280, 0.927065313f},
+    {-1, 0, 0.997119844f},
+    {-1, 0, 0.994839728f},
+    {-1, 0, 0.986920118f},
+    {-1, 0, 0.92731601f},
+    {45, 299, 0.171795994f},
+    {21, 286, 1.0186317f},
+    {-1, 0, 0.914905906f},
+    {25, 296, 0.133892f},
+    {15, 295, 0.101057999f},
+    {5, 294, 0.0908140019f},
+    {5, 293, 0.0650639981f},
+    {5, 292, 0.0360819995f},
+    {-1, 0, 0.999999344f},
+    {-1, 0, 0.999970734f},
+    {-1, 0, 0.999828994f},
+    {-1, 0, 0.999074042f},
+    {-1, 0, 0.996647954f},
+    {14, 298, 0.434532404f},
+    {-1, 0, 0.991476297f},
+    {-1, 0, 0.956642509f},
+    {-1, 0, 0.921015024f},
+    {42, 312, 1.04866946f},
+    {10, 309, 0.923974693f},
+    {2, 308, 1.0212034f},
+    {25, 305, 0.163652003f},
+    {-1, 0, 0.570823073f},
+    {2, 307, 1.01384127f},
+    {-1, 0, 0.403622508f},
+    {-1, 0, 0.279204667f},
+    {-1, 0, 0.069210656f},
+    {28, 311, 1.19616175f},
+    {-1, 0, -0.348943383f},
+    {-1, 0, -0.710986972f},
+    {23, 476, 0.964543939f},
+    {35, 465, 0.171782002f},
+    {43, 416, 0.989343405f},
+    {45, 389, 0.114436001f},
+    {15, 372, 0.0917880014f},
+    {15, 361, 0.0782440007f},
+    {33, 344, 0.937935293f},
+    {5, 329, 0.0558159985f},
+    {33, 322, 0.916263998f},
+    {-1, 0, 0.999996841f},
+    {4, 328, 0.461454749f},
+    {4, 327, 0.291961014f},
+    {15, 326, 0.0415359996f},
+    {-1, 0, 0.99995923f},
+    {-1, 0, 0.99988246f},
+    {-1, 0, 0.999781668f},
+    {-1, 0, 0.999455333f},
+    {4, 341, 0.386916608f},
+    {4, 336, 0.261460006f},
+    {41, 335, 1.11231971f},
+    {43, 334, 0.943503678f},
+    {-1, 0, 0.9999578f},
+    {-1, 0, 0.999896407f},
+    {-1, 0, 0.999787509f},
+    {43, 340, 0.943503678f},
+    {33, 339, 0.905520439f},
+    {-1, 0, 0.999888361f},
+    {-1, 0, 0.99971813f},
+    {-1, 0, 0.99927783f},
+    {43, 343, 0.939059615f},
+    {-1, 0, 0.999634862f},
+    {-1, 0, 0.998566806f},
+    {44, 358, 0.406275392f},
+    {4, 353, 0.281207114f},
+    {5, 350, 0.0650639981f},
+    {5, 349, 0.0473139994f},
+    {-1, 0, 0.999899089f},
+    {-1, 0, 0.999713302f},
+    {4, 352, 0.163932502f},
+    {-1, 0, 0.999702394f},
+    {-1, 0, 0.999060214f},
+    {5, 357, 0.058600001f},
+    {13, 356, 0.899316013f},
+    {-1, 0, 0.999500275f},
+    {-1, 0, 0.999126136f},
+    {-1, 0, 0.997335076f},
+    {15, 360, 0.0597140007f},
+    {-1, 0, 0.998445868f},
+    {-1, 0, 0.994088054f},
+    {31, 371, 1.10197699f},
+    {4, 368, 0.350952208f},
+    {4, 367, 0.215596095f},
+    {4, 366, 0.170051694f},
+    {-1, 0, 0.999869525f},
+    {-1, 0, 0.999581277f},
+    {-1, 0, 0.998622596f},
+    {43, 370, 0.94806385f},
+    {-1, 0, 0.998687088f},
+    {-1, 0, 0.994508564f},
+    {-1, 0, 0.987061441f},
+    {24, 382, 0.367134899f},
+    {4, 381, 0.281207114f},
+    {41, 380, 1.11231971f},
+    {4, 379, 0.207250193f},
+    {4, 378, 0.151098505f},
+    {-1, 0, 0.999854863f},
+    {-1, 0, 0.999618471f},
+    {-1, 0, 0.998748839f},
+    {-1, 0, 0.997331738f},
+    {-1, 0, 0.993549347f},
+    {33, 388, 0.951525629f},
+    {43, 387, 0.962236941f},
+    {43, 386, 0.952899456f},
+    {-1, 0, 0.994865f},
+    {-1, 0, 0.989548743f},
+    {-1, 0, 0.977260053f},
+    {-1, 0, 0.952250898f},
+    {4, 407, 0.362586498f},
+    {14, 404, 0.321305603f},
+    {14, 399, 0.252855092f},
+    {4, 396, 0.1923794f},
+    {4, 395, 0.133862898f},
+    {-1, 0, 0.999726057f},
+    {-1, 0, 0.998710096f},
+    {43, 398, 0.976335227f},
+    {-1, 0, 0.998247564f},
+    {-1, 0, 0.995689809f},
+    {43, 403, 0.980361938f},
+    {4, 402, 0.281207114f},
+    {-1, 0, 0.995739281f},
+    {-1, 0, 0.991939008f},
+    {-1, 0, 0.986387253f},
+    {22, 406, 1.05799139f},
+    {-1, 0, 0.988546252f},
+    {-1, 0, 0.960194111f},
+    {2, 415, 1.04421723f},
+    {43, 414, 0.976335227f},
+    {4, 413, 0.474941611f},
+    {45, 412, 0.131751999f},
+    {-1, 0, 0.97035563f},
+    {-1, 0, 0.94930166f},
+    {-1, 0, 0.928003728f},
+    {-1, 0, 0.887117743f},
+    {-1, 0, 0.834080696f},
+    {41, 464, 1.2540704f},
+    {24, 455, 0.403712004f},
+    {31, 452, 1.24673104f},
+    {34, 445, 0.324240088f},
+    {4, 440, 0.272093087f},
+    {4, 437, 0.225210801f},
+    {35, 430, 0.0770199969f},
+    {15, 427, 0.0597140007f},
+    {23, 426, 0.918576777f},
+    {-1, 0, 0.99996376f},
+    {-1, 0, 0.999358833f},
+    {33, 429, 0.979472458f},
+    {-1, 0, 0.998866558f},
+    {-1, 0, 0.997294366f},
+    {14, 434, 0.186648607f},
+    {41, 433, 1.16057968f},
+    {-1, 0, 0.997461021f},
+    {-1, 0, 0.990858972f},
+    {43, 436, 1.00576568f},
+    {-1, 0, 0.993218124f},
+    {-1, 0, 0.984965503f},
+    {18, 439, 1.11405396f},
+    {-1, 0, 0.995737553f},
+    {-1, 0, 0.974551439f},
+    {5, 442, 0.0940039977f},
+    {-1, 0, 0.996423542f},
+    {33, 444, 0.979472458f},
+    {-1, 0, 0.963105381f},
+    {-1, 0, 0.921160281f},
+    {25, 449, 0.0988819972f},
+    {5, 448, 0.0774559975f},
+    {-1, 0, 0.994980872f},
+    {-1, 0, 0.969620883f},
+    {43, 451, 0.998203158f},
+    {-1, 0, 0.930307627f},
+    {-1, 0, 0.844103694f},
+    {45, 454, 0.0527799986f},
+    {-1, 0, 0.696792364f},
+    {-1, 0, 0.999837875f},
+    {45, 461, 0.114436001f},
+    {5, 458, 0.08495f},
+    {-1, 0, 0.981377065f},
+    {38, 460, 1.09958684f},
+    {-1, 0, 0.907139003f},
+    {-1, 0, 0.861053765f},
+    {14, 463, 0.462029994f},
+    {-1, 0, 0.728497744f},
+    {-1, 0, 0.529035211f},
+    {-1, 0, 0.0585614964f},
+    {14, 471, 0.462029994f},
+    {4, 470, 0.362586498f},
+    {4, 469, 0.272093087f},
+    {-1, 0, 0.992884517f},
+    {-1, 0, 0.95634973f},
+    {-1, 0, 0.803390145f},
+    {5, 475, 0.188556001f},
+    {44, 474, 0.492177188f},
+    {-1, 0, 0.764068902f},
+    {-1, 0, 0.578629553f},
+    {-1, 0, 0.428518116f},
+    {4, 556, 0.362586498f},
+    {4, 541, 0.272093087f},
+    {41, 540, 1.30021548f},
+    {42, 505, 1.13319731f},
+    {14, 502, 0.218245804f},
+    {42, 497, 1.11334252f},
+    {14, 494, 0.158995703f},
+    {43, 487, 1.01679003f},
+    {5, 486, 0.144385993f},
+    {-1, 0, 0.999857664f},
+    {-1, 0, 0.997953773f},
+    {4, 493, 0.113779202f},
+    {43, 492, 1.05921125f},
+    {4, 491, 0.0758815035f},
+    {-1, 0, 0.998553157f},
+    {-1, 0, 0.997461319f},
+    {-1, 0, 0.994105101f},
+    {-1, 0, 0.992503345f},
+    {43, 496, 1.01679003f},
+    {-1, 0, 0.993444204f},
+    {-1, 0, 0.984873772f},
+    {4, 501, 0.170051694f},
+    {4, 500, 0.119360849f},
+    {-1, 0, 0.990290821f},
+    {-1, 0, 0.980886042f},
+    {-1, 0, 0.963701487f},
+    {43, 504, 1.02001345f},
+    {-1, 0, 0.965041518f},
+    {-1, 0, 0.910412848f},
+    {5, 525, 0.144385993f},
+    {13, 524, 0.977541029f},
+    {25, 519, 0.110440001f},
+    {13, 516, 0.949080467f},
+    {25, 515, 0.0968379974f},
+    {4, 512, 0.107340597f},
+    {-1, 0, 0.998438478f},
+    {28, 514, 1.10689795f},
+    {-1, 0, 0.994657397f},
+    {-1, 0, 0.990567505f},
+    {-1, 0, 0.980493188f},
+    {33, 518, 1.03671992f},
+    {-1, 0, 0.982818365f},
+    {-1, 0, 0.955551445f},
+    {4, 523, 0.1923794f},
+    {14, 522, 0.144461498f},
+    {-1, 0, 0.981987596f},
+    {-1, 0, 0.953470826f},
+    {-1, 0, 0.907943666f},
+    {-1, 0, 0.901679575f},
+    {32, 533, 1.12841725f},
+    {14, 530, 0.202033311f},
+    {4, 529, 0.133862898f},
+    {-1, 0, 0.95651114f},
+    {-1, 0, 0.932258308f},
+    {4, 532, 0.232080907f},
+    {-1, 0, 0.861247957f},
+    {-1, 0, 0.786547124f},
+    {4, 539, 0.207250193f},
+    {32, 538, 1.14439142f},
+    {5, 537, 0.173940003f},
+    {-1, 0, 0.87407285f},
+    {-1, 0, 0.823569596f},
+    {-1, 0, 0.735333025f},
+    {-1, 0, 0.618180037f},
+    {-1, 0, 0.357528239f},
+    {33, 551, 1.01232445f},
+    {43, 544, 1.0092051f},
+    {-1, 0, 0.949187696f},
+    {33, 548, 1.00121045f},
+    {4, 547, 0.328377008f},
+    {-1, 0, 0.855524838f},
+    {-1, 0, 0.768936157f},
+    {22, 550, 1.09275496f},
+    {-1, 0, 0.768997312f},
+    {-1, 0, 0.63563633f},
+    {33, 555, 1.02636349f},
+    {24, 554, 0.305140197f},
+    {-1, 0, 0.659558475f},
+    {-1, 0, 0.447364032f},
+    {-1, 0, 0.253741652f},
+    {23, 566, 0.98737973f},
+    {24, 561, 0.435982406f},
+    {33, 560, 0.997271121f},
+    {-1, 0, 0.62350893f},
+    {-1, 0, 0.404969543f},
+    {41, 563, 1.11231971f},
+    {-1, 0, 0.379163444f},
+    {4, 565, 0.461454749f},
+    {-1, 0, 0.214372471f},
+    {-1, 0, 0.0356921405f},
+    {4, 568, 0.412739813f},
+    {-1, 0, 0.168679461f},
+    {23, 570, 1.00047994f},
+    {-1, 0, -0.240385219f},
+    {-1, 0, -0.434644639f},
+    {23, 659, 0.955134869f},
+    {0, 588, 0.997847199f},
+    {33, 579, 0.905520439f},
+    {43, 578, 0.906701088f},
+    {30, 577, 0.964433372f},
+    {-1, 0, 0.554911137f},
+    {-1, 0, 0.762292743f},
+    {-1, 0, 0.424744993f},
+    {43, 583, 0.927065313f},
+    {40, 582, 0.992325664f},
+    {-1, 0, 0.238107726f},
+    {-1, 0, 0.368035495f},
+    {5, 585, 0.167283997f},
+    {-1, 0, 0.260045469f},
+    {40, 587, 0.990247369f},
+    {-1, 0, -0.0730258673f},
+    {-1, 0, 0.116235532f},
+    {33, 644, 0.951525629f},
+    {43, 629, 0.94806385f},
+    {33, 618, 0.916263998f},
+    {3, 615, 0.893969238f},
+    {33, 612, 0.905520439f},
+    {33, 605, 0.889283836f},
+    {5, 604, 0.100865997f},
+    {43, 601, 0.89072293f},
+    {15, 600, 0.0754479989f},
+    {43, 599, 0.881482244f},
+    {-1, 0, 0.999989927f},
+    {-1, 0, 0.999966562f},
+    {-1, 0, 0.999950171f},
+    {25, 603, 0.0635700002f},
+    {-1, 0, 0.999951422f},
+    {-1, 0, 0.999811411f},
+    {-1, 0, 0.999546349f},
+    {5, 607, 0.0671420023f},
+    {-1, 0, 0.999817669f},
+    {43, 611, 0.910377562f},
+    {43, 610, 0.89905709f},
+    {-1, 0, 0.999587417f},
+    {-1, 0, 0.999082923f},
+    {-1, 0, 0.998611748f},
+    {25, 614, 0.0789659992f},
+    {-1, 0, 0.999397695f},
+    {-1, 0, 0.995533288f},
+    {43, 617, 0.920447409f},
+    {-1, 0, 0.997888863f},
+    {-1, 0, 0.992542565f},
+    {4, 626, 0.544686675f},
+    {33, 625, 0.929732561f},
+    {43, 622, 0.930782914f},
+    {-1, 0, 0.994603395f},
+    {13, 624, 0.899316013f},
+    {-1, 0, 0.993584692f},
+    {-1, 0, 0.984830201f},
+    {-1, 0, 0.979898393f},
+    {11, 628, 1.02540004f},
+    {-1, 0, 0.963147044f},
+    {-1, 0, 0.986072421f},
+    {35, 637, 0.107964002f},
+    {15, 636, 0.0855140015f},
+    {5, 635, 0.0671420023f},
+    {35, 634, 0.0566219985f},
+    {-1, 0, 0.999008179f},
+    {-1, 0, 0.996071219f},
+    {-1, 0, 0.988450944f},
+    {-1, 0, 0.967094898f},
+    {4, 643, 0.558590889f},
+    {43, 640, 0.957544267f},
+    {-1, 0, 0.952438354f},
+    {18, 642, 1.13488078f},
+    {-1, 0, 0.911986351f},
+    {-1, 0, 0.879729092f},
+    {-1, 0, 0.792159677f},
+    {5, 650, 0.106348f},
+    {25, 649, 0.0895320028f},
+    {5, 648, 0.0687939972f},
+    {-1, 0, 0.993000209f},
+    {-1, 0, 0.95970124f},
+    {-1, 0, 0.869610965f},
+    {33, 654, 0.960968494f},
+    {4, 653, 0.544686675f},
+    {-1, 0, 0.786205053f},
+    {-1, 0, 0.565820873f},
+    {4, 656, 0.519812882f},
+    {-1, 0, 0.624820352f},
+    {8, 658, 1.13480949f},
+    {-1, 0, 0.507490695f},
+    {-1, 0, 0.281986147f},
+    {23, 669, 0.974024773f},
+    {15, 662, 0.112034f},
+    {-1, 0, 0.633985996f},
+    {14, 666, 0.558970571f},
+    {33, 665, 0.983905375f},
+    {-1, 0, 0.264196932f},
+    {-1, 0, -0.0207388699f},
+    {40, 668, 0.999982774f},
+    {-1, 0, -0.307300866f},
+    {-1, 0, -0.150099888f},
+    {14, 673, 0.531680226f},
+    {13, 672, 0.968109488f},
+    {-1, 0, -0.20263876f},
+    {-1, 0, -0.481806248f},
+    {4, 677, 0.575153291f},
+    {4, 676, 0.558590889f},
+    {-1, 0, -0.490641415f},
+    {-1, 0, -0.590070069f},
+    {-1, 0, -0.692600548f},
+    {32, 980, 1.10399091f},
+    {15, 785, 0.127900004f},
+    {41, 784, 1.13277555f},
+    {32, 683, 1.00115633f},
+    {-1, 0, 0.889547229f},
+    {41, 773, 1.07642698f},
+    {31, 764, 1.06470525f},
+    {22, 727, 1.1988622f},
+    {5, 726, 0.111956f},
+    {15, 701, 0.0782440007f},
+    {35, 700, 0.197116002f},
+    {4, 699, 0.200259298f},
+    {35, 698, 0.194754004f},
+    {44, 697, 0.164433002f},
+    {14, 696, 0.0773660019f},
+    {44, 695, 0.0916396677f},
+    {-1, 0, 1.0f},
+    {-1, 0, 1.0f},
+    {-1, 0, 0.999999881f},
+    {-1, 0, 0.999999821f},
+    {-1, 0, 1.0f},
+    {-1, 0, 0.999996483f},
+    {-1, 0, 1.0f},
+    {43, 725, 1.09922838f},
+    {43, 722, 1.07335508f},
+    {8, 717, 1.39467013f},
+    {43, 712, 1.05459571f},
+    {30, 709, 0.891042471f},
+    {14, 708, 0.0143010998f},
+    {-1, 0, 0.99999851f},
+    {-1, 0, 0.999999225f},
+    {43, 711, 1.04105961f},
+    {-1, 0, 0.999999464f},
+    {-1, 0, 0.999998569f},
+    {41, 714, 1.00385869f},
+    {-1, 0, 0.99999851f},
+    {12, 716, 1.00922382f},
+    {-1, 0, 0.999998033f},
+    {-1, 0, 0.999997556f},
+    {1, 721, 1.06712174f},
+    {23, 720, 1.09301412f},
+    {-1, 0, 0.999999583f},
+    {-1, 0, 0.999999762f},
+    {-1, 0, 0.999999821f},
+    {43, 724, 1.08823359f},
+    {-1, 0, 0.999996483f},
+    {-1, 0, 0.999994576f},
+    {-1, 0, 0.999980748f},
+    {-1, 0, 0.999970913f},
+    {45, 729, 0.121504001f},
+    {-1, 0, 0.999466538f},
+    {41, 763, 1.0251435f},
+    {43, 744, 1.23134112f},
+    {42, 743, 1.03505337f},
+    {45, 736, 0.169174001f},
+    {42, 735, 1.01265454f},
+    {-1, 0, 0.999999046f},
+    {-1, 0, 0.999998629f},
+    {45, 742, 0.192555994f},
+    {42, 741, 1.01912153f},
+    {32, 740, 1.00984228f},
+    {-1, 0, 0.999999225f},
+    {-1, 0, 0.999998987f},
+    {-1, 0, 0.999998808f},
+    {-1, 0, 0.999999464f},
+    {-1, 0, 0.999998093f},
+    {31, 762, 1.02974141f},
+    {45, 751, 0.135232002f},
+    {42, 750, 1.02735281f},
+    {45, 749, 0.128207996f},
+    {-1, 0, 0.999976754f},
+    {-1, 0, 0.999981701f},
+    {-1, 0, 0.9999668f},
+    {31, 759, 1.01266026f},
+    {45, 756, 0.143649995f},
+    {42, 755, 1.00659776f},
+    {-1, 0, 0.999986947f},
+    {-1, 0, 0.999983609f},
+    {45, 758, 0.151749998f},
+    {-1, 0, 0.999988496f},
+    {-1, 0, 0.999990463f},
+    {31, 761, 1.01958752f},
+    {-1, 0, 0.999982417f},
+    {-1, 0, 0.999978244f},
+    {-1, 0, 0.999951124f},
+    {-1, 0, 0.999786735f},
+    {25, 766, 0.0250979997f},
+    {-1, 0, 0.998040974f},
+    {18, 772, 1.15377927f},
+    {4, 771, 0.232080907f},
+    {1, 770, 1.10409284f},
+    {-1, 0, 0.999999166f},
+    {-1, 0, 1.0f},
+    {-1, 0, 0.999997318f},
+    {-1, 0, 0.999990761f},
+    {43, 783, 0.993731499f},
+    {25, 782, 0.0274563748f},
+    {24, 781, 0.323161215f},
+    {4, 778, 0.178121403f},
+    {-1, 0, 0.999998569f},
+    {33, 780, 0.905520439f},
+    {-1, 0, 0.999997497f},
+    {-1, 0, 0.999994338f},
+    {-1, 0, 0.999987543f},
+    {-1, 0, 0.999980271f},
+    {-1, 0, 0.989506245f},
+    {-1, 0, 0.699162662f},
+    {40, 957, 0.999982774f},
+    {23, 938, 1.23233223f},
+    {3, 847, 0.859958649f},
+    {34, 822, 0.490761787f},
+    {5, 821, 0.188556001f},
+    {23, 808, 1.16149867f},
+    {13, 795, 0.847906291f},
+    {5, 794, 0.148019999f},
+    {-1, 0, 0.983145356f},
+    {-1, 0, 0.921047807f},
+    {10, 797, 0.905280828f},
+    {-1, 0, 0.774753332f},
+    {40, 807, 0.954966664f},
+    {22, 802, 1.01177764f},
+    {12, 801, 1.0048269f},
+    {-1, 0, 0.8683936f},
+    {-1, 0, 0.864233851f},
+    {33, 804, 0.889283836f},
+    {-1, 0, 0.870263517f},
+    {22, 806, 1.02012265f},
+    {-1, 0, 0.843780935f},
+    {-1, 0, 0.799480081f},
+    {-1, 0, 0.915394127f},
+    {32, 820, 1.03215027f},
+    {25, 811, 0.163652003f},
+    {-1, 0, 0.715538025f},
+    {32, 819, 1.01822805f},
+    {35, 816, 0.174572006f},
+    {32, 815, 1.00802588f},
+    {-1, 0, 0.820675313f},
+    {-1, 0, 0.796041071f},
+    {32, 818, 1.01095343f},
+    {-1, 0, 0.836731851f},
+    {-1, 0, 0.820957661f},
+    {-1, 0, 0.770694911f},
+    {-1, 0, 0.625948191f},
+    {-1, 0, 0.597791731f},
+    {5, 828, 0.153318003f},
+    {33, 825, 0.867914855f},
+    {-1, 0, 0.856261015f},
+    {43, 827, 0.894983411f},
+    {-1, 0, 0.723722935f},
+    {-1, 0, 0.584792197f},
+    {43, 834, 0.869980335f},
+    {30, 833, 0.918385148f},
+    {5, 832, 0.185951993f},
+    {-1, 0, 0.671443641f},
+    {-1, 0, 0.434456587f},
+    {-1, 0, 0.830996752f},
+    {10, 844, 0.923974693f},
+    {32, 839, 1.06829596f},
+    {33, 838, 0.879865766f},
+    {-1, 0, 0.501214027f},
+    {-1, 0, 0.402166069f},
+    {33, 843, 0.879865766f},
+    {5, 842, 0.178568006f},
+    {-1, 0, 0.420683384f},
+    {-1, 0, 0.286054283f},
+    {-1, 0, 0.257972002f},
+    {33, 846, 0.874317706f},
+    {-1, 0, 0.602532029f},
+    {-1, 0, 0.459583014f},
+    {48, 861, 1.03896558f},
+    {40, 856, 0.960635602f},
+    {23, 855, 0.865699649f},
+    {48, 854, 1.02773857f},
+    {30, 853, 0.918385148f},
+    {-1, 0, 0.722993195f},
+    {-1, 0, 0.831982136f},
+    {-1, 0, 0.627195299f},
+    {-1, 0, 0.485163093f},
+    {38, 860, 1.03275621f},
+    {8, 859, 1.02461731f},
+    {-1, 0, 0.877694607f},
+    {-1, 0, 0.906456113f},
+    {-1, 0, 0.798961103f},
+    {43, 925, 0.927065313f},
+    {44, 868, 0.406275392f},
+    {30, 867, 0.930868268f},
+    {43, 866, 0.906701088f},
+    {-1, 0, 0.685089529f},
+    {-1, 0, 0.443822801f},
+    {-1, 0, 0.788831174f},
+    {5, 884, 0.155471995f},
+    {48, 875, 1.06012118f},
+    {20, 874, 0.95636487f},
+    {3, 873, 0.880137861f},
+    {-1, 0, 0.600253224f},
+    {-1, 0, 0.496421039f},
+    {-1, 0, 0.811095953f},
+    {2, 877, 1.10615003f},
+    {-1, 0, 0.501722872f},
+    {33, 881, 0.89784205f},
+    {23, 880, 0.878185034f},
+    {-1, 0, 0.426932871f},
+    {-1, 0, 0.396910846f},
+    {30, 883, 0.950305939f},
+    {-1, 0, 0.227239668f},
+    {-1, 0, 0.325197577f},
+    {12, 896, 1.08103299f},
+    {43, 893, 0.910377562f},
+    {30, 892, 0.96820271f},
+    {23, 889, 0.878185034f},
+    {-1, 0, 0.657228589f},
+    {20, 891, 0.92770344f},
+    {-1, 0, 0.389344215f},
+    {-1, 0, 0.47173968f},
+    {-1, 0, 0.787539005f},
+    {4, 895, 0.510396779f},
+    {-1, 0, 0.411506265f},
+    {-1, 0, 0.186144933f},
+    {34, 912, 0.512545824f},
+    {10, 903, 0.905280828f},
+    {2, 902, 1.1298939f},
+    {13, 901, 0.881736577f},
+    {-1, 0, 0.389075726f},
+    {-1, 0, 0.242189541f},
+    {-1, 0, 0.144021526f},
+    {13, 909, 0.886472583f},
+    {1, 908, 1.15889919f},
+    {23, 907, 0.883303285f},
+    {-1, 0, 0.575855553f},
+    {-1, 0, 0.462563813f},
+    {-1, 0, 0.260582745f},
+    {5, 911, 0.173940003f},
+    {-1, 0, 0.367911994f},
+    {-1, 0, 0.244276926f},
+    {33, 914, 0.874317706f},
+    {-1, 0, 0.411501288f},
+    {22, 920, 1.09275496f},
+    {5, 917, 0.173940003f},
+    {-1, 0, 0.369404793f},
+    {4, 919, 0.531412601f},
+    {-1, 0, 0.189477816f},
+    {-1, 0, 0.0952708647f},
+    {13, 922, 0.870273352f},
+    {-1, 0, 0.201987579f},
+    {4, 924, 0.544686675f},
+    {-1, 0, 0.111151814f},
+    {-1, 0, 0.0190778989f},
+    {44, 933, 0.513029099f},
+    {40, 928, 0.966866732f},
+    {-1, 0, 0.0355507769f},
+    {10, 932, 0.977497637f},
+    {43, 931, 0.939059615f},
+    {-1, 0, 0.357064962f},
+    {-1, 0, 0.0469104089f},
+    {-1, 0, 0.654327273f},
+    {33, 937, 0.929732561f},
+    {33, 936, 0.91949594f},
+    {-1, 0, 0.180546239f},
+    {-1, 0, 0.0278021842f},
+    {-1, 0, -0.1835199f},
+    {40, 956, 0.941334367f},
+    {11, 949, 1.01324415f},
+    {30, 948, 0.918385148f},
+    {35, 947, 0.153970003f},
+    {22, 946, 1.01739883f},
+    {45, 945, 0.146727994f},
+    {-1, 0, 0.108044326f},
+    {-1, 0, 0.188640937f},
+    {-1, 0, -0.0153959775f},
+    {-1, 0, 0.346164554f},
+    {-1, 0, -0.118879355f},
+    {30, 953, 0.918385148f},
+    {42, 952, 1.02735281f},
+    {-1, 0, 0.0353229977f},
+    {-1, 0, -0.272764444f},
+    {15, 955, 0.192524001f},
+    {-1, 0, -0.618513465f},
+    {-1, 0, -0.319336087f},
+    {-1, 0, 0.757832527f},
+    {4, 973, 0.350952208f},
+    {31, 972, 1.06470525f},
+    {43, 971, 1.09922838f},
+    {23, 962, 0.969338477f},
+    {-1, 0, 0.999908626f},
+    {43, 966, 1.04999876f},
+    {22, 965, 1.03861487f},
+    {-1, 0, 0.999997497f},
+    {-1, 0, 0.999999702f},
+    {44, 970, 0.0266258009f},
+    {12, 969, 1.01270139f},
+    {-1, 0, 0.999996364f},
+    {-1, 0, 0.999993563f},
+    {-1, 0, 0.999997079f},
+    {-1, 0, 0.999761403f},
+    {-1, 0, 0.973670423f},
+    {43, 979, 0.943503678f},
+    {43, 978, 0.923699558f},
+    {4, 977, 0.558590889f},
+    {-1, 0, 0.675061226f},
+    {-1, 0, 0.461023062f},
+    {-1, 0, 0.322918892f},
+    {-1, 0, -0.0892457739f},
+    {38, 2056, 0.980938435f},
+    {40, 1895, 0.989259541f},
+    {43, 1810, 1.16149867f},
+    {40, 1273, 0.922941148f},
+    {38, 1128, 0.937485337f},
+    {41, 1061, 1.47723091f},
+    {33, 1022, 1.03671992f},
+    {4, 1021, 0.446900308f},
+    {40, 1012, 0.903201103f},
+    {33, 1003, 0.937935293f},
+    {5, 998, 0.159278005f},
+    {42, 997, 1.35753155f},
+    {23, 996, 0.872398376f},
+    {48, 995, 0.866256595f},
+    {-1, 0, 0.999139905f},
+    {-1, 0, 0.997908056f},
+    {-1, 0, 0.992514074f},
+    {-1, 0, 0.979465783f},
+    {43, 1000, 0.846395493f},
+    {-1, 0, 0.9854877f},
+    {41, 1002, 1.21245313f},
+    {-1, 0, 0.977732718f},
+    {-1, 0, 0.974553525f},
+    {4, 1011, 0.119360849f},
+    {11, 1006, 1.44429564f},
+    {-1, 0, 0.908836067f},
+    {33, 1010, 1.02636349f},
+    {15, 1009, 0.0531059988f},
+    {-1, 0, 0.979525447f},
+    {-1, 0, 0.963153422f},
+    {-1, 0, 0.943665028f},
+    {-1, 0, 0.820657849f},
+    {4, 1020, 0.1923794f},
+    {42, 1019, 1.4256916f},
+    {41, 1016, 1.28075159f},
+    {-1, 0, 0.97152102f},
+    {1, 1018, 1.3776195f},
+    {-1, 0, 0.869670868f},
+    {-1, 0, 0.909548223f},
+    {-1, 0, 0.752005696f},
+    {-1, 0, 0.669871628f},
+    {-1, 0, 0.398499519f},
+    {8, 1040, 1.03869355f},
+    {5, 1039, 0.0881239995f},
+    {5, 1032, 0.0408440009f},
+    {1, 1029, 1.47612572f},
+    {41, 1028, 1.42646396f},
+    {-1, 0, 0.601522982f},
+    {-1, 0, 0.442742854f},
+    {20, 1031, 0.937120914f},
+    {-1, 0, 0.664983749f},
+    {-1, 0, 0.565176666f},
+    {11, 1034, 1.47617376f},
+    {-1, 0, 0.622395694f},
+    {18, 1038, 1.00797307f},
+    {48, 1037, 1.00517833f},
+    {-1, 0, 0.8369807f},
+    {-1, 0, 0.844019771f},
+    {-1, 0, 0.750007331f},
+    {-1, 0, 0.286202371f},
+    {0, 1052, 0.962941766f},
+    {20, 1051, 0.987119734f},
+    {28, 1044, 0.92146641f},
+    {-1, 0, 0.909600675f},
+    {43, 1048, 1.10664523f},
+    {33, 1047, 1.09337914f},
+    {-1, 0, 0.886144817f},
+    {-1, 0, 0.804531455f},
+    {18, 1050, 0.989177048f},
+    {-1, 0, 0.82149291f},
+    {-1, 0, 0.738587916f},
+    {-1, 0, 0.684761822f},
+    {43, 1054, 1.03028905f},
+    {-1, 0, 0.983163834f},
+    {48, 1056, 1.00517833f},
+    {-1, 0, 0.817410231f},
+    {48, 1060, 1.02773857f},
+    {8, 1059, 1.12109506f},
+    {-1, 0, 0.891655087f},
+    {-1, 0, 0.921008885f},
+    {-1, 0, 0.935563266f},
+    {46, 1125, 0.0f},
+    {43, 1086, 1.09358287f},
+    {5, 1085, 0.0774559975f},
+    {33, 1082, 1.16149867f},
+    {43, 1069, 0.886172056f},
+    {3, 1068, 0.884981871f},
+    {-1, 0, 0.999898493f},
+    {-1, 0, 0.993279099f},
+    {3, 1075, 1.0677439f},
+    {33, 1074, 1.10635662f},
+    {33, 1073, 0.926028848f},
+    {-1, 0, 0.668841124f},
+    {-1, 0, 0.904629171f},
+    {-1, 0, 0.499714702f},
+    {28, 1079, 0.978710473f},
+    {41, 1078, 1.68149841f},
+    {-1, 0, 0.899167657f},
+    {-1, 0, 0.788170993f},
+    {2, 1081, 1.42412353f},
+    {-1, 0, 0.774430752f},
+    {-1, 0, 0.564509153f},
+    {13, 1084, 1.0107758f},
+    {-1, 0, 0.61642307f},
+    {-1, 0, 0.212551221f},
+    {-1, 0, 0.109769285f},
+    {33, 1102, 1.0728749f},
+    {12, 1089, 1.47390151f},
+    {-1, 0, 0.243375391f},
+    {24, 1099, 0.104052298f},
+    {11, 1096, 1.67896414f},
+    {25, 1095, 0.0539540015f},
+    {40, 1094, 0.798483431f},
+    {-1, 0, 0.58425194f},
+    {-1, 0, 0.736587882f},
+    {-1, 0, 0.503436029f},
+    {13, 1098, 1.07234466f},
+    {-1, 0, 0.892170072f},
+    {-1, 0, 0.810321093f},
+    {33, 1101, 1.01232445f},
+    {-1, 0, 0.273686349f},
+    {-1, 0, 0.588726819f},
+    {23, 1116, 1.16149867f},
+    {43, 1111, 1.13930881f},
+    {35, 1108, 0.0358919986f},
+    {31, 1107, 1.6830436f},
+    {-1, 0, 0.477905184f},
+    {-1, 0, 0.400941372f},
+    {4, 1110, 0.0896302983f},
+    {-1, 0, 0.117509745f},
+    {-1, 0, -0.179620013f},
+    {13, 1115, 1.10606813f},
+    {40, 1114, 0.798483431f},
+    {-1, 0, -0.10812299f},
+    {-1, 0, 0.0353796631f},
+    {-1, 0, -0.243782148f},
+    {4, 1118, 0.0653693005f},
+    {-1, 0, -0.325959414f},
+    {20, 1124, 0.871244848f},
+    {28, 1121, 0.92146641f},
+    {-1, 0, 0.92171669f},
+    {43, 1123, 1.10664523f},
+    {-1, 0, 0.812077284f},
+    {-1, 0, 0.723971307f},
+    {-1, 0, 0.571494341f},
+    {43, 1127, 1.01283598f},
+    {-1, 0, 0.0676525831f},
+    {-1, 0, -0.632275045f},
+    {41, 1212, 1.3794868f},
+    {34, 1161, 0.197885796f},
+    {41, 1148, 1.33048368f},
+    {43, 1135, 0.943503678f},
+    {5, 1134, 0.144385993f},
+    {-1, 0, 0.982853949f},
+    {-1, 0, 0.902253985f},
+    {5, 1147, 0.159278005f},
+    {41, 1142, 1.30553532f},
+    {4, 1141, 0.142096698f},
+    {23, 1140, 0.974024773f},
+    {-1, 0, 0.943377614f},
+    {-1, 0, 0.888882697f},
+    {-1, 0, 0.840913057f},
+    {38, 1144, 0.960377157f},
+    {-1, 0, 0.855281651f},
+    {28, 1146, 0.92146641f},
+    {-1, 0, 0.797186673f},
+    {-1, 0, 0.673838556f},
+    {-1, 0, 0.629566133f},
+    {35, 1160, 0.0929500014f},
+    {38, 1155, 0.960377157f},
+    {14, 1152, 0.0773660019f},
+    {-1, 0, 0.841604352f},
+    {0, 1154, 0.98184222f},
+    {-1, 0, 0.693111181f},
+    {-1, 0, 0.796063006f},
+    {12, 1159, 1.47390151f},
+    {38, 1158, 0.972792387f},
+    {-1, 0, 0.571967304f},
+    {-1, 0, 0.429825306f},
+    {-1, 0, 0.742570817f},
+    {-1, 0, 0.324483633f},
+    {3, 1187, 0.905821443f},
+    {24, 1172, 0.435982406f},
+    {1, 1171, 1.24192643f},
+    {43, 1168, 0.869980335f},
+    {43, 1167, 0.846395493f},
+    {-1, 0, 0.971613586f},
+    {-1, 0, 0.940915287f},
+    {41, 1170, 1.16057968f},
+    {-1, 0, 0.829724252f},
+    {-1, 0, 0.911659956f},
+    {-1, 0, 0.609536469f},
+    {5, 1182, 0.181915998f},
+    {11, 1177, 1.18662906f},
+    {43, 1176, 0.846395493f},
+    {-1, 0, 0.825938761f},
+    {-1, 0, 0.720021546f},
+    {21, 1181, 1.18947244f},
+    {43, 1180, 0.862719417f},
+    {-1, 0, 0.561035872f},
+    {-1, 0, 0.358078718f},
+    {-1, 0, 0.208828539f},
+    {41, 1186, 1.13277555f},
+    {4, 1185, 0.544686675f},
+    {-1, 0, 0.326450795f},
+    {-1, 0, 0.223825291f},
+    {-1, 0, 0.120485917f},
+    {5, 1191, 0.0959059969f},
+    {43, 1190, 1.01679003f},
+    {-1, 0, 0.695855677f},
+    {-1, 0, 0.241575196f},
+    {31, 1203, 1.21020007f},
+    {44, 1198, 0.406275392f},
+    {43, 1195, 0.886172056f},
+    {-1, 0, 0.76420927f},
+    {5, 1197, 0.178568006f},
+    {-1, 0, 0.447275192f},
+    {-1, 0, 0.196171552f},
+    {33, 1202, 0.884740949f},
+    {20, 1201, 0.959317863f},
+    {-1, 0, 0.356115311f},
+    {-1, 0, 0.118895687f},
+    {-1, 0, -0.00909955893f},
+    {4, 1211, 0.375998706f},
+    {43, 1210, 0.962236941f},
+    {45, 1207, 0.146727994f},
+    {-1, 0, 0.400176495f},
+    {10, 1209, 0.976296902f},
+    {-1, 0, 0.225052297f},
+    {-1, 0, 0.0189440101f},
+    {-1, 0, -0.166980088f},
+    {-1, 0, -0.375210494f},
+    {4, 1270, 0.386916608f},
+    {5, 1263, 0.0881239995f},
+    {43, 1234, 1.09922838f},
+    {4, 1229, 0.291961014f},
+    {5, 1226, 0.0473139994f},
+    {43, 1225, 1.09358287f},
+    {20, 1222, 0.92770344f},
+    {13, 1221, 1.12411284f},
+    {-1, 0, 0.894041717f},
+    {-1, 0, 0.760512292f},
+    {0, 1224, 0.919523299f},
+    {-1, 0, 0.603463411f},
+    {-1, 0, 0.746994615f},
+    {-1, 0, 0.530575335f},
+    {12, 1228, 1.44375479f},
+    {-1, 0, 0.111245178f},
+    {-1, 0, 0.628860295f},
+    {28, 1233, 0.969537735f},
+    {43, 1232, 1.06481969f},
+    {-1, 0, 0.245331839f},
+    {-1, 0, 0.0437895842f},
+    {-1, 0, 0.421633869f},
+    {33, 1244, 1.07800603f},
+    {18, 1241, 1.05380309f},
+    {48, 1238, 1.00517833f},
+    {-1, 0, 0.478011876f},
+    {0, 1240, 0.983975112f},
+    {-1, 0, 0.626311779f},
+    {-1, 0, 0.760069489f},
+    {41, 1243, 1.42646396f},
+    {-1, 0, 0.370758891f},
+    {-1, 0, 0.236250564f},
+    {0, 1256, 0.954700708f},
+    {34, 1251, 0.132807419f},
+    {25, 1248, 0.037726f},
+    {-1, 0, 0.399826497f},
+    {18, 1250, 0.965817988f},
+    {-1, 0, 0.181781515f},
+    {-1, 0, -0.133024916f},
+    {23, 1253, 1.11375833f},
+    {-1, 0, -0.265872329f},
+    {20, 1255, 0.943891644f},
+    {-1, 0, 0.094378531f},
+    {-1, 0, -0.123534605f},
+    {48, 1258, 1.00735879f},
+    {-1, 0, 0.1285934f},
+    {21, 1262, 1.47692668f},
+    {18, 1261, 1.03261471f},
+    {-1, 0, 0.369411916f},
+    {-1, 0, 0.201696843f},
+    {-1, 0, 0.513336778f},
+    {18, 1269, 0.976275802f},
+    {43, 1266, 1.08823359f},
+    {-1, 0, 0.314752519f},
+    {38, 1268, 0.960377157f},
+    {-1, 0, 0.0725675672f},
+    {-1, 0, -0.19266288f},
+    {-1, 0, -0.327158242f},
+    {11, 1272, 1.39886272f},
+    {-1, 0, -0.46682775f},
+    {-1, 0, -0.555541933f},
+    {14, 1583, 0.186648607f},
+    {43, 1450, 1.07335508f},
+    {43, 1321, 1.0092051f},
+    {25, 1308, 0.142284006f},
+    {43, 1297, 0.993731499f},
+    {43, 1284, 0.957544267f},
+    {34, 1283, 0.162232205f},
+    {43, 1282, 0.934770525f},
+    {-1, 0, 0.990037501f},
+    {-1, 0, 0.964826107f},
+    {-1, 0, 0.925383091f},
+    {4, 1294, 0.151098505f},
+    {43, 1291, 0.984821081f},
+    {5, 1290, 0.100865997f},
+    {0, 1289, 0.967017829f},
+    {-1, 0, 0.935332596f},
+    {-1, 0, 0.96326828f},
+    {-1, 0, 0.896822155f},
+    {0, 1293, 0.968786538f},
+    {-1, 0, 0.812883496f},
+    {-1, 0, 0.895605922f},
+    {5, 1296, 0.0959059969f},
+    {-1, 0, 0.869078934f},
+    {-1, 0, 0.665815353f},
+    {4, 1305, 0.127657399f},
+    {22, 1302, 1.38740838f},
+    {42, 1301, 1.36449194f},
+    {-1, 0, 0.811884165f},
+    {-1, 0, 0.681182623f},
+    {5, 1304, 0.0725020021f},
+    {-1, 0, 0.918088734f},
+    {-1, 0, 0.845587254f},
+    {5, 1307, 0.104287997f},
+    {-1, 0, 0.651835978f},
+    {-1, 0, 0.271729976f},
+    {43, 1316, 0.966921031f},
+    {43, 1313, 0.943503678f},
+    {33, 1312, 0.929732561f},
+    {-1, 0, 0.939798713f},
+    {-1, 0, 0.860389113f},
+    {4, 1315, 0.163932502f},
+    {-1, 0, 0.772710502f},
+    {-1, 0, 0.559576571f},
+    {4, 1318, 0.151098505f},
+    {-1, 0, 0.438102484f},
+    {43, 1320, 0.984821081f},
+    {-1, 0, 0.27063477f},
+    {-1, 0, 0.031832844f},
+    {35, 1395, 0.0929500014f},
+    {28, 1358, 0.990572155f},
+    {14, 1345, 0.1155053f},
+    {0, 1334, 0.954700708f},
+    {5, 1331, 0.0774559975f},
+    {43, 1328, 1.04105961f},
+    {-1, 0, 0.838094175f},
+    {21, 1330, 1.39944971f},
+    {-1, 0, 0.565115154f},
+    {-1, 0, 0.701886952f},
+    {18, 1333, 1.03880179f},
+    {-1, 0, 0.552936137f},
+    {-1, 0, 0.446792692f},
+    {43, 1340, 1.04999876f},
+    {43, 1337, 1.02361953f},
+    {-1, 0, 0.927002192f},
+    {33, 1339, 1.00856853f},
+    {-1, 0, 0.894481421f},
+    {-1, 0, 0.852687836f},
+    {28, 1342, 0.955184042f},
+    {-1, 0, 0.797706008f},
+    {48, 1344, 0.98846221f},
+    {-1, 0, 0.612171292f},
+    {-1, 0, 0.738251865f},
+    {43, 1353, 1.05459571f},
+    {5, 1348, 0.0619920008f},
+    {-1, 0, 0.779773116f},
+    {14, 1352, 0.153083593f},
+    {43, 1351, 1.04105961f},
+    {-1, 0, 0.659166574f},
+    {-1, 0, 0.509010077f},
+    {-1, 0, 0.390717745f},
+    {15, 1357, 0.0703459978f},
+    {5, 1356, 0.0558159985f},
+    {-1, 0, 0.559027672f},
+    {-1, 0, 0.407732725f},
+    {-1, 0, 0.155559361f},
+    {15, 1374, 0.0531059988f},
+    {0, 1361, 0.893471003f},
+    {-1, 0, 0.41030997f},
+    {4, 1369, 0.113779202f},
+    {41, 1366, 1.47723091f},
+    {28, 1365, 1.04078281f},
+    {-1, 0, 0.860589743f},
+    {-1, 0, 0.782925487f},
+    {18, 1368, 1.0058279f},
+    {-1, 0, 0.872988939f},
+    {-1, 0, 0.550825477f},
+    {20, 1373, 0.977680326f},
+    {0, 1372, 0.960556686f},
+    {-1, 0, 0.649725318f},
+    {-1, 0, 0.748668194f},
+    {-1, 0, 0.517167866f},
+    {43, 1384, 1.03347719f},
+    {44, 1383, 0.151788995f},
+    {0, 1380, 0.946199358f},
+    {5, 1379, 0.0619920008f},
+    {-1, 0, 0.65481323f},
+    {-1, 0, 0.457740217f},
+    {4, 1382, 0.101230003f},
+    {-1, 0, 0.815307081f},
+    {-1, 0, 0.627539158f},
+    {-1, 0, 0.250710726f},
+    {33, 1388, 1.0298599f},
+    {4, 1387, 0.119360849f},
+    {-1, 0, 0.505456567f},
+    {-1, 0, 0.366349548f},
+    {25, 1392, 0.0561919995f},
+    {0, 1391, 0.893471003f},
+    {-1, 0, 0.216402084f},
+    {-1, 0, 0.475196451f},
+    {0, 1394, 0.893471003f},
+    {-1, 0, -0.260607511f},
+    {-1, 0, 0.139343604f},
+    {34, 1441, 0.140877008f},
+    {28, 1420, 0.969537735f},
+    {38, 1411, 0.960377157f},
+    {33, 1404, 1.03671992f},
+    {24, 1401, 0.0681656003f},
+    {-1, 0, 0.697711289f},
+    {0, 1403, 0.957801342f},
+    {-1, 0, 0.369579673f},
+    {-1, 0, 0.560806632f},
+    {21, 1408, 1.42590082f},
+    {0, 1407, 0.965028226f},
+    {-1, 0, 0.270000964f},
+    {-1, 0, 0.395636588f},
+    {28, 1410, 0.955184042f},
+    {-1, 0, 0.490925699f},
+    {-1, 0, 0.383309752f},
+    {24, 1419, 0.117326401f},
+    {18, 1416, 0.976275802f},
+    {41, 1415, 1.35123849f},
+    {-1, 0, 0.480390966f},
+    {-1, 0, 0.325215846f},
+    {12, 1418, 1.36299562f},
+    {-1, 0, 0.164156809f},
+    {-1, 0, 0.313240618f},
+    {-1, 0, 0.130827934f},
+    {0, 1426, 0.919523299f},
+    {43, 1425, 1.04502404f},
+    {43, 1424, 1.03028905f},
+    {-1, 0, 0.189916089f},
+    {-1, 0, 0.0151701495f},
+    {-1, 0, -0.218633622f},
+    {43, 1434, 1.03712821f},
+    {5, 1431, 0.136225998f},
+    {0, 1430, 0.940097868f},
+    {-1, 0, 0.302821904f},
+    {-1, 0, 0.456326514f},
+    {14, 1433, 0.1155053f},
+    {-1, 0, 0.306708217f},
+    {-1, 0, 0.0707917511f},
+    {18, 1438, 1.02864432f},
+    {4, 1437, 0.113779202f},
+    {-1, 0, 0.23714222f},
+    {-1, 0, -0.0741665065f},
+    {5, 1440, 0.122486003f},
+    {-1, 0, -0.0668277889f},
+    {-1, 0, 0.0956296697f},
+    {0, 1445, 0.97480011f},
+    {23, 1444, 1.02590036f},
+    {-1, 0, -0.0602013618f},
+    {-1, 0, -0.291714758f},
+    {33, 1449, 1.02636349f},
+    {5, 1448, 0.141808003f},
+    {-1, 0, 0.145735905f},
+    {-1, 0, 0.00170986296f},
+    {-1, 0, -0.0573411472f},
+    {5, 1510, 0.058600001f},
+    {18, 1491, 1.04580438f},
+    {14, 1470, 0.1155053f},
+    {0, 1459, 0.931889594f},
+    {18, 1456, 0.983655751f},
+    {-1, 0, 0.710551679f},
+    {33, 1458, 1.0728749f},
+    {-1, 0, 0.451522708f},
+    {-1, 0, 0.163169444f},
+    {43, 1465, 1.10664523f},
+    {10, 1462, 0.923974693f},
+    {-1, 0, 0.823296428f},
+    {42, 1464, 1.38816202f},
+    {-1, 0, 0.765475571f},
+    {-1, 0, 0.677929819f},
+    {41, 1467, 1.39999998f},
+    {-1, 0, 0.719314456f},
+    {20, 1469, 0.937120914f},
+    {-1, 0, 0.646744728f},
+    {-1, 0, 0.452073246f},
+    {43, 1478, 1.09922838f},
+    {40, 1477, 0.954966664f},
+    {4, 1474, 0.133862898f},
+    {-1, 0, 0.678688407f},
+    {8, 1476, 1.00270152f},
+    {-1, 0, 0.502496302f},
+    {-1, 0, 0.385878026f},
+    {-1, 0, 0.183972925f},
+    {33, 1484, 1.08288527f},
+    {22, 1483, 1.44420481f},
+    {0, 1482, 0.970383525f},
+    {-1, 0, 0.201578885f},
+    {-1, 0, 0.312386215f},
+    {-1, 0, 0.557367921f},
+    {20, 1488, 0.943891644f},
+    {5, 1487, 0.0360819995f},
+    {-1, 0, 0.342405826f},
+    {-1, 0, 0.15622431f},
+    {38, 1490, 0.972792387f},
+    {-1, 0, 0.034385182f},
+    {-1, 0, -0.189292222f},
+    {28, 1505, 1.03268421f},
+    {4, 1502, 0.142096698f},
+    {48, 1499, 1.0315026f},
+    {8, 1498, 1.04576528f},
+    {10, 1497, 0.942131877f},
+    {-1, 0, 0.0475623272f},
+    {-1, 0, 0.225624487f},
+    {-1, 0, 0.443539917f},
+    {0, 1501, 0.976062536f},
+    {-1, 0, 0.387999535f},
+    {-1, 0, 0.526712418f},
+    {32, 1504, 1.4113332f},
+    {-1, 0, 0.174471706f},
+    {-1, 0, -0.106454939f},
+    {0, 1509, 0.919523299f},
+    {10, 1508, 0.923974693f},
+    {-1, 0, -0.638297617f},
+    {-1, 0, -0.38542822f},
+    {-1, 0, 0.0685118362f},
+    {33, 1542, 1.0728749f},
+    {33, 1519, 1.04953671f},
+    {28, 1518, 0.978710473f},
+    {13, 1515, 1.11367428f},
+    {-1, 0, 0.539213538f},
+    {40, 1517, 0.946986496f},
+    {-1, 0, 0.796053648f},
+    {-1, 0, 0.645952702f},
+    {-1, 0, 0.264948308f},
+    {4, 1539, 0.133862898f},
+    {28, 1530, 0.985449076f},
+    {8, 1529, 1.08396757f},
+    {0, 1526, 0.962941766f},
+    {33, 1525, 1.05882764f},
+    {-1, 0, 0.263771802f},
+    {-1, 0, 0.0277987327f},
+    {45, 1528, 0.0866739973f},
+    {-1, 0, 0.393322498f},
+    {-1, 0, 0.256583363f},
+    {-1, 0, 0.51476723f},
+    {48, 1532, 0.98846221f},
+    {-1, 0, -0.249839321f},
+    {11, 1536, 1.3875066f},
+    {0, 1535, 0.950959086f},
+    {-1, 0, -0.0908027217f},
+    {-1, 0, 0.0413860343f},
+    {23, 1538, 1.09301412f},
+    {-1, 0, 0.127791479f},
+    {-1, 0, 0.246252328f},
+    {0, 1541, 0.954700708f},
+    {-1, 0, -0.488696873f},
+    {-1, 0, -0.222207248f},
+    {4, 1560, 0.0969059989f},
+    {3, 1551, 1.12386787f},
+    {18, 1548, 0.976275802f},
+    {30, 1547, 0.962382853f},
+    {-1, 0, -0.0108564682f},
+    {-1, 0, 0.263181448f},
+    {0, 1550, 0.946199358f},
+    {-1, 0, -0.300464004f},
+    {-1, 0, -0.101331986f},
+    {0, 1559, 0.957801342f},
+    {11, 1556, 1.47617376f},
+    {18, 1555, 1.0151f},
+    {-1, 0, -0.429336876f},
+    {-1, 0, -0.590973794f},
+    {20, 1558, 0.92770344f},
+    {-1, 0, -0.235799372f},
+    {-1, 0, -0.361502379f},
+    {-1, 0, -0.117829531f},
+    {4, 1578, 0.133862898f},
+    {43, 1571, 1.11397874f},
+    {5, 1566, 0.0700000003f},
+    {0, 1565, 0.946199358f},
+    {-1, 0, -0.261896253f},
+    {-1, 0, -0.127922893f},
+    {0, 1570, 0.960556686f},
+    {43, 1569, 1.09922838f},
+    {-1, 0, -0.38712433f},
+    {-1, 0, -0.5109424f},
+    {-1, 0, -0.273219436f},
+    {30, 1573, 0.945509851f},
+    {-1, 0, -0.389076412f},
+    {0, 1577, 0.965028226f},
+    {28, 1576, 0.99836278f},
+    {-1, 0, -0.54649967f},
+    {-1, 0, -0.647473991f},
+    {-1, 0, -0.457672477f},
+    {42, 1580, 1.4256916f},
+    {-1, 0, -0.49742648f},
+    {43, 1582, 1.10664523f},
+    {-1, 0, -0.576341271f},
+    {-1, 0, -0.685165703f},
+    {12, 1637, 1.22187531f},
+    {8, 1634, 1.03245306f},
+    {14, 1603, 0.414215714f},
+    {33, 1600, 0.916263998f},
+    {8, 1597, 0.996500373f},
+    {40, 1596, 0.957959414f},
+    {43, 1591, 0.869980335f},
+    {-1, 0, 0.936040401f},
+    {10, 1595, 0.981980264f},
+    {43, 1594, 0.89072293f},
+    {-1, 0, 0.912744939f},
+    {-1, 0, 0.857952118f},
+    {-1, 0, 0.792993486f},
+    {-1, 0, 0.758259952f},
+    {15, 1599, 0.159380004f},
+    {-1, 0, 0.689675033f},
+    {-1, 0, 0.442592889f},
+    {5, 1602, 0.163269997f},
+    {-1, 0, 0.585450172f},
+    {-1, 0, 0.0271275919f},
+    {43, 1623, 0.869980335f},
+    {5, 1620, 0.188556001f},
+    {1, 1619, 1.22061956f},
+    {33, 1612, 0.859473169f},
+    {5, 1609, 0.153318003f},
+    {-1, 0, 0.904186726f},
+    {12, 1611, 1.16265464f},
+    {-1, 0, 0.85938859f},
+    {-1, 0, 0.756673813f},
+    {32, 1616, 1.16942894f},
+    {5, 1615, 0.173940003f},
+    {-1, 0, 0.677721262f},
+    {-1, 0, 0.546428084f},
+    {13, 1618, 0.899316013f},
+    {-1, 0, 0.536287129f},
+    {-1, 0, 0.391622037f},
+    {-1, 0, 0.177018285f},
+    {4, 1622, 0.595098972f},
+    {-1, 0, 0.306974262f},
+    {-1, 0, -0.034423884f},
+    {4, 1633, 0.575153291f},
+    {13, 1630, 0.910706818f},
+    {5, 1627, 0.146039993f},
+    {-1, 0, 0.403207928f},
+    {34, 1629, 0.512545824f},
+    {-1, 0, 0.383000284f},
+    {-1, 0, -0.00464280881f},
+    {42, 1632, 1.1844964f},
+    {-1, 0, 0.153576598f},
+    {-1, 0, 0.0386131778f},
+    {-1, 0, -0.16169636f},
+    {8, 1636, 1.05376005f},
+    {-1, 0, -0.0555037744f},
+    {-1, 0, -0.464123219f},
+    {44, 1761, 0.406275392f},
+    {2, 1686, 1.28713977f},
+    {5, 1651, 0.0986139998f},
+    {15, 1646, 0.0882943794f},
+    {41, 1645, 1.29041314f},
+    {43, 1644, 0.966921031f},
+    {-1, 0, 0.946092427f},
+    {-1, 0, 0.840849698f},
+    {-1, 0, 0.629586935f},
+    {43, 1650, 0.966921031f},
+    {35, 1649, 0.0949340016f},
+    {-1, 0, 0.469666123f},
+    {-1, 0, 0.737427533f},
+    {-1, 0, 0.315070987f},
+    {43, 1663, 0.910377562f},
+    {43, 1660, 0.89905709f},
+    {30, 1659, 0.985252738f},
+    {44, 1658, 0.370875537f},
+    {40, 1657, 0.946986496f},
+    {-1, 0, 0.815201879f},
+    {-1, 0, 0.713880002f},
+    {-1, 0, 0.628245711f},
+    {-1, 0, 0.46301946f},
+    {5, 1662, 0.136225998f},
+    {-1, 0, 0.524844885f},
+    {-1, 0, 0.248497099f},
+    {44, 1673, 0.278790504f},
+    {43, 1668, 0.94806385f},
+    {5, 1667, 0.163269997f},
+    {-1, 0, 0.691857934f},
+    {-1, 0, 0.339860708f},
+    {42, 1672, 1.28547835f},
+    {5, 1671, 0.163269997f},
+    {-1, 0, 0.3539325f},
+    {-1, 0, 0.0370719209f},
+    {-1, 0, -0.28322348f},
+    {42, 1681, 1.24771786f},
+    {35, 1678, 0.137188002f},
+    {22, 1677, 1.25133741f},
+    {-1, 0, 0.312520772f},
+    {-1, 0, 0.106367745f},
+    {14, 1680, 0.311086804f},
+    {-1, 0, 0.0676926896f},
+    {-1, 0, -0.177054659f},
+    {43, 1683, 0.930782914f},
+    {-1, 0, -0.0456363112f},
+    {5, 1685, 0.144385993f},
+    {-1, 0, -0.313207984f},
+    {-1, 0, -0.535104632f},
+    {15, 1734, 0.0782440007f},
+    {43, 1707, 1.06898022f},
+    {43, 1696, 1.00191236f},
+    {4, 1695, 0.309403807f},
+    {5, 1694, 0.0650639981f},
+    {43, 1693, 0.989343405f},
+    {-1, 0, 0.932997644f},
+    {-1, 0, 0.814454019f},
+    {-1, 0, 0.672406793f},
+    {-1, 0, 0.428949088f},
+    {15, 1700, 0.0365119986f},
+    {20, 1699, 0.961823523f},
+    {-1, 0, 0.841454446f},
+    {-1, 0, 0.601926804f},
+    {43, 1704, 1.02361953f},
+    {15, 1703, 0.0690559968f},
+    {-1, 0, 0.553304732f},
+    {-1, 0, 0.101450093f},
+    {25, 1706, 0.0491320007f},
+    {-1, 0, 0.33511579f},
+    {-1, 0, 0.046817217f},
+    {35, 1721, 0.0381140001f},
+    {33, 1714, 1.07800603f},
+    {42, 1711, 1.37125468f},
+    {-1, 0, 0.665952921f},
+    {20, 1713, 0.953236282f},
+    {-1, 0, 0.571829975f},
+    {-1, 0, 0.380755693f},
+    {13, 1718, 1.16138828f},
+    {34, 1717, 0.268787503f},
+    {-1, 0, 0.298882484f},
+    {-1, 0, -0.0129410727f},
+    {33, 1720, 1.09337914f},
+    {-1, 0, 0.135280177f},
+    {-1, 0, -0.167368993f},
+    {25, 1727, 0.0491320007f},
+    {43, 1724, 1.09358287f},
+    {-1, 0, -0.103008613f},
+    {20, 1726, 0.95636487f},
+    {-1, 0, -0.309558541f},
+    {-1, 0, -0.43853569f},
+    {43, 1731, 1.09358287f},
+    {33, 1730, 1.0728749f},
+    {-1, 0, -0.37432307f},
+    {-1, 0, -0.530312419f},
+    {33, 1733, 1.09337914f},
+    {-1, 0, -0.609879315f},
+    {-1, 0, -0.783471882f},
+    {43, 1756, 1.0268327f},
+    {24, 1745, 0.275882006f},
+    {31, 1738, 1.27493799f},
+    {-1, 0, 0.265125185f},
+    {0, 1742, 0.957801342f},
+    {43, 1741, 1.0092051f},
+    {-1, 0, -0.200514495f},
+    {-1, 0, -0.377720326f},
+    {25, 1744, 0.0968379974f},
+    {-1, 0, 0.165134236f},
+    {-1, 0, -0.0696013793f},
+    {43, 1751, 0.971725464f},
+    {33, 1748, 0.905520439f},
+    {-1, 0, 0.259878188f},
+    {30, 1750, 0.971321344f},
+    {-1, 0, -0.061378289f},
+    {-1, 0, -0.26379475f},
+    {42, 1753, 1.2901274f},
+    {-1, 0, -0.42246747f},
+    {30, 1755, 0.959955215f},
+    {-1, 0, -0.7088871f},
+    {-1, 0, -0.560430229f},
+    {43, 1758, 1.04999876f},
+    {-1, 0, -0.492205232f},
+    {43, 1760, 1.09922838f},
+    {-1, 0, -0.739394426f},
+    {-1, 0, -0.83901912f},
+    {15, 1769, 0.0365119986f},
+    {33, 1766, 1.03306961f},
+    {23, 1765, 1.02249396f},
+    {-1, 0, 0.754620373f},
+    {-1, 0, 0.380917013f},
+    {23, 1768, 1.07271385f},
+    {-1, 0, -0.00745662395f},
+    {-1, 0, -0.409806997f},
+    {41, 1787, 1.19469798f},
+    {40, 1778, 0.941334367f},
+    {33, 1775, 0.89368248f},
+    {1, 1774, 1.24924493f},
+    {-1, 0, 0.163072407f},
+    {-1, 0, 0.0247977972f},
+    {0, 1777, 0.996729791f},
+    {-1, 0, -0.14624992f},
+    {-1, 0, -0.0620368458f},
+    {43, 1784, 0.886172056f},
+    {5, 1781, 0.159278005f},
+    {-1, 0, 0.0357872285f},
+    {23, 1783, 0.887886047f},
+    {-1, 0, -0.0689232647f},
+    {-1, 0, -0.244765759f},
+    {30, 1786, 0.980089247f},
+    {-1, 0, -0.182575226f},
+    {-1, 0, -0.288942665f},
+    {4, 1803, 0.558590889f},
+    {5, 1792, 0.109949999f},
+    {3, 1791, 1.01789939f},
+    {-1, 0, 0.399944454f},
+    {-1, 0, -0.0549957938f},
+    {42, 1800, 1.24771786f},
+    {42, 1797, 1.22016621f},
+    {43, 1796, 0.89905709f},
+    {-1, 0, -0.229384243f},
+    {-1, 0, -0.35683012f},
+    {5, 1799, 0.133103997f},
+    {-1, 0, -0.400480568f},
+    {-1, 0, -0.555027902f},
+    {43, 1802, 0.957544267f},
+    {-1, 0, -0.672240019f},
+    {-1, 0, -0.851369441f},
+    {20, 1809, 0.953236282f},
+    {11, 1806, 1.27316606f},
+    {-1, 0, -0.855584741f},
+    {48, 1808, 0.975374341f},
+    {-1, 0, -0.604872227f},
+    {-1, 0, -0.701456726f},
+    {-1, 0, -0.407126844f},
+    {33, 1868, 1.13908994f},
+    {23, 1813, 0.887886047f},
+    {-1, 0, -0.920024514f},
+    {4, 1851, 0.101230003f},
+    {11, 1820, 1.47617376f},
+    {42, 1817, 1.44493067f},
+    {-1, 0, 0.0572597198f},
+    {22, 1819, 1.47440445f},
+    {-1, 0, -0.562209606f},
+    {-1, 0, -0.280792922f},
+    {0, 1836, 0.893471003f},
+    {20, 1835, 0.937120914f},
+    {42, 1828, 1.64213538f},
+    {20, 1827, 0.912964582f},
+    {20, 1826, 0.871244848f},
+    {-1, 0, 0.630492151f},
+    {-1, 0, 0.332735032f},
+    {-1, 0, 0.00970680732f},
+    {4, 1832, 0.0653693005f},
+    {3, 1831, 0.884981871f},
+    {-1, 0, -0.105552815f},
+    {-1, 0, -0.00159803883f},
+    {20, 1834, 0.871244848f},
+    {-1, 0, 0.143483847f},
+    {-1, 0, 0.0944463313f},
+    {-1, 0, -0.240636393f},
+    {13, 1840, 1.11367428f},
+    {33, 1839, 1.10635662f},
+    {-1, 0, 0.719173908f},
+    {-1, 0, 0.446844548f},
+    {41, 1842, 1.41196477f},
+    {-1, 0, 0.440597296f},
+    {20, 1846, 0.912964582f},
+    {38, 1845, 0.937485337f},
+    {-1, 0, 0.491264194f},
+    {-1, 0, 0.182412639f},
+    {48, 1850, 1.03423667f},
+    {33, 1849, 1.10635662f},
+    {-1, 0, 0.215917617f},
+    {-1, 0, -0.0211552829f},
+    {-1, 0, 0.247082219f},
+    {42, 1853, 1.41181719f},
+    {-1, 0, 0.348965853f},
+    {13, 1867, 1.23208642f},
+    {46, 1866, 0.0f},
+    {20, 1859, 0.912964582f},
+    {14, 1858, 0.165779397f},
+    {-1, 0, -0.107379198f},
+    {-1, 0, -0.347259313f},
+    {24, 1863, 0.131446302f},
+    {18, 1862, 1.01663613f},
+    {-1, 0, -0.314355105f},
+    {-1, 0, -0.389927804f},
+    {28, 1865, 1.01540959f},
+    {-1, 0, -0.616129279f},
+    {-1, 0, -0.462411046f},
+    {-1, 0, -0.714311838f},
+    {-1, 0, 0.0236479361f},
+    {0, 1892, 0.931889594f},
+    {13, 1889, 1.23208642f},
+    {3, 1874, 1.09785402f},
+    {48, 1873, 0.866256595f},
+    {-1, 0, -0.944962919f},
+    {-1, 0, -0.748604417f},
+    {5, 1878, 0.0301660001f},
+    {23, 1877, 1.23233223f},
+    {-1, 0, -0.524783731f},
+    {-1, 0, -0.360749543f},
+    {48, 1888, 1.02898681f},
+    {20, 1883, 0.871244848f},
+    {23, 1882, 1.11375833f},
+    {-1, 0, -0.629027188f},
+    {-1, 0, -0.558802783f},
+    {0, 1887, 0.893471003f},
+    {2, 1886, 1.64331257f},
+    {-1, 0, -0.764887452f},
+    {-1, 0, -0.806939244f},
+    {-1, 0, -0.711691439f},
+    {-1, 0, -0.447069198f},
+    {3, 1891, 1.22902322f},
+    {-1, 0, -0.927534759f},
+    {-1, 0, -0.915331662f},
+    {28, 1894, 0.955184042f},
+    {-1, 0, -0.212018579f},
+    {-1, 0, -0.58126682f},
+    {33, 1989, 1.00856853f},
+    {0, 1906, 0.5f},
+    {41, 1903, 1.0251435f},
+    {42, 1902, 1.01134515f},
+    {45, 1901, 0.186000004f},
+    {-1, 0, -0.99905926f},
+    {-1, 0, -0.999173224f},
+    {-1, 0, -0.999267995f},
+    {42, 1905, 1.04866946f},
+    {-1, 0, -0.999486089f},
+    {-1, 0, -0.999829888f},
+    {44, 1912, 0.247288302f},
+    {31, 1909, 1.32996941f},
+    {-1, 0, 0.45351854f},
+    {4, 1911, 0.215596095f},
+    {-1, 0, 0.0669924989f},
+    {-1, 0, -0.178923577f},
+    {41, 1916, 1.1844914f},
+    {43, 1915, 0.87610954f},
+    {-1, 0, 0.356689066f},
+    {-1, 0, 0.0853004307f},
+    {0, 1924, 0.99445498f},
+    {4, 1923, 0.39912051f},
+    {42, 1920, 1.2406888f},
+    {-1, 0, 0.271253139f},
+    {41, 1922, 1.29041314f},
+    {-1, 0, -0.0640182421f},
+    {-1, 0, -0.322094262f},
+    {-1, 0, -0.411732465f},
+    {8, 1962, 1.04293513f},
+    {24, 1941, 0.379261106f},
+    {41, 1928, 1.2592231f},
+    {-1, 0, 0.0799325556f},
+    {44, 1936, 0.334320813f},
+    {23, 1933, 0.991899848f},
+    {4, 1932, 0.301314652f},
+    {-1, 0, -0.217238173f},
+    {-1, 0, -0.367711186f},
+    {14, 1935, 0.274142176f},
+    {-1, 0, -0.386821449f},
+    {-1, 0, -0.497258812f},
+    {33, 1938, 0.942302465f},
+    {-1, 0, -0.345726877f},
+    {45, 1940, 0.164496005f},
+    {-1, 0, -0.510006428f},
+    {-1, 0, -0.650954783f},
+    {33, 1951, 0.905520439f},
+    {5, 1946, 0.181915998f},
+    {42, 1945, 1.20332456f},
+    {-1, 0, -0.190102294f},
+    {-1, 0, -0.377112389f},
+    {34, 1948, 0.490761787f},
+    {-1, 0, -0.280397505f},
+    {12, 1950, 1.23552978f},
+    {-1, 0, -0.57516557f},
+    {-1, 0, -0.430799037f},
+    {5, 1953, 0.138973996f},
+    {-1, 0, -0.420008928f},
+    {43, 1959, 0.920447409f},
+    {5, 1956, 0.153318003f},
+    {-1, 0, -0.500497162f},
+    {4, 1958, 0.510396779f},
+    {-1, 0, -0.558248043f},
+    {-1, 0, -0.698897421f},
+    {21, 1961, 1.27912092f},
+    {-1, 0, -0.613510132f},
+    {-1, 0, -0.745808005f},
+    {5, 1970, 0.138973996f},
+    {3, 1965, 1.00268745f},
+    {-1, 0, -0.292972684f},
+    {4, 1969, 0.487102389f},
+    {25, 1968, 0.131160006f},
+    {-1, 0, -0.349332213f},
+    {-1, 0, -0.493407518f},
+    {-1, 0, -0.65060693f},
+    {34, 1974, 0.306728303f},
+    {33, 1973, 1.00121045f},
+    {-1, 0, -0.403711289f},
+    {-1, 0, -0.586571097f},
+    {42, 1976, 1.22657466f},
+    {-1, 0, -0.54204309f},
+    {34, 1982, 0.390567392f},
+    {42, 1979, 1.2901274f},
+    {-1, 0, -0.526752591f},
+    {14, 1981, 0.351918906f},
+    {-1, 0, -0.652517974f},
+    {-1, 0, -0.736046076f},
+    {5, 1986, 0.178568006f},
+    {41, 1985, 1.2481612f},
+    {-1, 0, -0.65147233f},
+    {-1, 0, -0.71986562f},
+    {43, 1988, 0.923699558f},
+    {-1, 0, -0.74578315f},
+    {-1, 0, -0.840394318f},
+    {24, 2041, 0.173624799f},
+    {34, 2028, 0.126164302f},
+    {43, 1995, 1.02361953f},
+    {3, 1994, 1.11332548f},
+    {-1, 0, 0.492833495f},
+    {-1, 0, 0.770605624f},
+    {13, 2027, 1.23208642f},
+    {28, 2012, 0.990572155f},
+    {43, 1999, 1.04502404f},
+    {-1, 0, 0.477170706f},
+    {4, 2009, 0.0846849009f},
+    {48, 2004, 0.975374341f},
+    {18, 2003, 0.997457445f},
+    {-1, 0, 0.433710903f},
+    {-1, 0, 0.28073588f},
+    {33, 2006, 1.04953671f},
+    {-1, 0, 0.341916353f},
+    {48, 2008, 0.992962539f},
+    {-1, 0, 0.306883305f},
+    {-1, 0, 0.202695459f},
+    {33, 2011, 1.05882764f},
+    {-1, 0, 0.266381443f},
+    {-1, 0, 0.156293496f},
+    {43, 2026, 1.07335508f},
+    {5, 2015, 0.0725020021f},
+    {-1, 0, 0.42976746f},
+    {43, 2023, 1.05459571f},
+    {0, 2018, 0.946199358f},
+    {-1, 0, 0.125652298f},
+    {5, 2020, 0.100865997f},
+    {-1, 0, 0.335855514f},
+    {4, 2022, 0.0969059989f},
+    {-1, 0, 0.299606293f},
+    {-1, 0, 0.184017196f},
+    {41, 2025, 1.38900673f},
+    {-1, 0, 0.194286004f},
+    {-1, 0, 0.00834954064f},
+    {-1, 0, -0.0134790726f},
+    {-1, 0, -0.3477844f},
+    {28, 2034, 0.969537735f},
+    {4, 2033, 0.157545701f},
+    {43, 2032, 1.03712821f},
+    {-1, 0, 0.219221815f},
+    {-1, 0, 0.0802913383f},
+    {-1, 0, 0.0453411676f},
+    {5, 2036, 0.111956f},
+    {-1, 0, 0.214242861f},
+    {18, 2040, 1.03880179f},
+    {4, 2039, 0.151098505f},
+    {-1, 0, -0.00456680544f},
+    {-1, 0, -0.130252361f},
+    {-1, 0, -0.262966841f},
+    {24, 2051, 0.220351696f},
+    {23, 2046, 1.04422116f},
+    {14, 2045, 0.193544596f},
+    {-1, 0, -0.0273534376f},
+    {-1, 0, -0.236542344f},
+    {15, 2048, 0.131047994f},
+    {-1, 0, -0.249502361f},
+    {24, 2050, 0.204005003f},
+    {-1, 0, -0.329717845f},
+    {-1, 0, -0.433370173f},
+    {4, 2055, 0.261460006f},
+    {28, 2054, 0.994894624f},
+    {-1, 0, -0.366352439f},
+    {-1, 0, -0.498958319f},
+    {-1, 0, -0.602582216f},
+    {3, 2628, 0.92649883f},
+    {15, 2125, 0.112034f},
+    {5, 2122, 0.0940039977f},
+    {5, 2111, 0.0700000003f},
+    {41, 2110, 1.27577209f},
+    {5, 2103, 0.058600001f},
+    {43, 2080, 1.00576568f},
+    {34, 2077, 0.368826509f},
+    {43, 2076, 0.989343405f},
+    {43, 2075, 0.962236941f},
+    {0, 2068, 0.950959086f},
+    {-1, 0, 0.999922037f},
+    {48, 2072, 1.00932705f},
+    {8, 2071, 1.0406599f},
+    {-1, 0, 0.99993068f},
+    {-1, 0, 0.999956191f},
+    {32, 2074, 1.12841725f},
+    {-1, 0, 0.999970853f},
+    {-1, 0, 0.99995929f},
+    {-1, 0, 0.999826908f},
+    {-1, 0, 0.999033749f},
+    {15, 2079, 0.033507999f},
+    {-1, 0, 0.998940885f},
+    {-1, 0, 0.996571839f},
+    {20, 2082, 0.987119734f},
+    {-1, 0, 0.973945081f},
+    {5, 2090, 0.0325319991f},
+    {4, 2089, 0.39912051f},
+    {41, 2088, 1.22671735f},
+    {25, 2087, 0.0709680021f},
+    {-1, 0, 0.9995538f},
+    {-1, 0, 0.99999398f},
+    {-1, 0, 0.997743249f},
+    {-1, 0, 0.993583262f},
+    {23, 2100, 0.974024773f},
+    {4, 2097, 0.431926012f},
+    {24, 2094, 0.28473711f},
+    {-1, 0, 0.996786058f},
+    {3, 2096, 0.909589291f},
+    {-1, 0, 0.994546056f},
+    {-1, 0, 0.990372002f},
+    {15, 2099, 0.0447320007f},
+    {-1, 0, 0.991075575f},
+    {-1, 0, 0.982990563f},
+    {24, 2102, 0.296198696f},
+    {-1, 0, 0.990327835f},
+    {-1, 0, 0.976003766f},
+    {12, 2107, 1.11506557f},
+    {4, 2106, 0.301314652f},
+    {-1, 0, 0.994579017f},
+    {-1, 0, 0.977212131f},
+    {43, 2109, 1.02361953f},
+    {-1, 0, 0.965302646f},
+    {-1, 0, 0.934790552f},
+    {-1, 0, 0.890648901f},
+    {44, 2117, 0.370875537f},
+    {13, 2114, 0.931255281f},
+    {-1, 0, 0.978958905f},
+    {8, 2116, 1.09213281f},
+    {-1, 0, 0.932429075f},
+    {-1, 0, 0.962018609f},
+    {15, 2121, 0.0829280019f},
+    {33, 2120, 0.997271121f},
+    {-1, 0, 0.921630681f},
+    {-1, 0, 0.896621108f},
+    {-1, 0, 0.818879068f},
+    {4, 2124, 0.499599695f},
+    {-1, 0, 0.752767086f},
+    {-1, 0, 0.459560901f},
+    {4, 2287, 0.431926012f},
+    {43, 2168, 0.910377562f},
+    {5, 2165, 0.188556001f},
+    {44, 2154, 0.380909592f},
+    {30, 2135, 0.918385148f},
+    {43, 2134, 0.89905709f},
+    {43, 2133, 0.886172056f},
+    {-1, 0, 0.872721314f},
+    {-1, 0, 0.730800748f},
+    {-1, 0, 0.547899365f},
+    {43, 2143, 0.89905709f},
+    {4, 2142, 0.362586498f},
+    {13, 2141, 0.895269573f},
+    {48, 2140, 1.00517833f},
+    {-1, 0, 0.959616661f},
+    {-1, 0, 0.925524294f},
+    {-1, 0, 0.909335434f},
+    {-1, 0, 0.887416363f},
+    {4, 2145, 0.328377008f},
+    {-1, 0, 0.929644823f},
+    {1, 2151, 1.14582312f},
+    {1, 2148, 1.12920785f},
+    {-1, 0, 0.897164106f},
+    {33, 2150, 0.905520439f},
+    {-1, 0, 0.858665824f},
+    {-1, 0, 0.835143745f},
+    {4, 2153, 0.338903695f},
+    {-1, 0, 0.855843246f},
+    {-1, 0, 0.768129051f},
+    {43, 2156, 0.894983411f},
+    {-1, 0, 0.788487077f},
+    {1, 2162, 1.15889919f},
+    {43, 2159, 0.902836859f},
+    {-1, 0, 0.739816427f},
+    {40, 2161, 0.982363045f},
+    {-1, 0, 0.622157037f},
+    {-1, 0, 0.680165946f},
+    {5, 2164, 0.141808003f},
+    {-1, 0, 0.593136728f},
+    {-1, 0, 0.318234712f},
+    {3, 2167, 0.898096085f},
+    {-1, 0, 0.414014846f},
+    {-1, 0, 0.214952424f},
+    {15, 2250, 0.178568006f},
+    {44, 2215, 0.380909592f},
+    {43, 2192, 0.930782914f},
+    {20, 2175, 0.92770344f},
+    {33, 2174, 0.912767529f},
+    {-1, 0, 0.553773224f},
+    {-1, 0, 0.290441573f},
+    {24, 2183, 0.342295587f},
+    {4, 2178, 0.281207114f},
+    {-1, 0, 0.911202133f},
+    {11, 2182, 1.17495418f},
+    {12, 2181, 1.16265464f},
+    {-1, 0, 0.859533668f},
+    {-1, 0, 0.779036939f},
+    {-1, 0, 0.671653807f},
+    {11, 2187, 1.14978588f},
+    {20, 2186, 0.976509631f},
+    {-1, 0, 0.691854f},
+    {-1, 0, 0.80403167f},
+    {33, 2189, 0.916263998f},
+    {-1, 0, 0.632673323f},
+    {13, 2191, 0.917604327f},
+    {-1, 0, 0.552242994f},
+    {-1, 0, 0.458913505f},
+    {40, 2214, 0.998924851f},
+    {1, 2209, 1.2031368f},
+    {4, 2196, 0.291961014f},
+    {-1, 0, 0.735954463f},
+    {23, 2202, 0.928525031f},
+    {30, 2201, 0.972818613f},
+    {5, 2200, 0.130904004f},
+    {-1, 0, 0.521803916f},
+    {-1, 0, 0.350810647f},
+    {-1, 0, 0.642261982f},
+    {40, 2206, 0.975681901f},
+    {43, 2205, 0.952899456f},
+    {-1, 0, 0.280685633f},
+    {-1, 0, 0.0712304264f},
+    {23, 2208, 0.941051722f},
+    {-1, 0, 0.446860492f},
+    {-1, 0, 0.292152792f},
+    {20, 2213, 0.943891644f},
+    {4, 2212, 0.309403807f},
+    {-1, 0, 0.489317387f},
+    {-1, 0, 0.152163222f},
+    {-1, 0, -0.276196629f},
+    {-1, 0, 0.853614748f},
+    {32, 2231, 1.14439142f},
+    {23, 2222, 0.911741555f},
+    {8, 2219, 0.996500373f},
+    {-1, 0, 0.284245312f},
+    {13, 2221, 0.903135478f},
+    {-1, 0, 0.635090411f},
+    {-1, 0, 0.562213361f},
+    {43, 2228, 0.943503678f},
+    {5, 2225, 0.141808003f},
+    {-1, 0, 0.466717124f},
+    {30, 2227, 0.976689696f},
+    {-1, 0, 0.22322011f},
+    {-1, 0, 0.422754019f},
+    {40, 2230, 0.991291523f},
+    {-1, 0, 0.150978714f},
+    {-1, 0, 0.333142549f},
+    {43, 2239, 0.923699558f},
+    {12, 2236, 1.16265464f},
+    {43, 2235, 0.920447409f},
+    {-1, 0, 0.404081196f},
+    {-1, 0, 0.275669158f},
+    {25, 2238, 0.142284006f},
+    {-1, 0, 0.288304865f},
+    {-1, 0, -0.0115428511f},
+    {5, 2243, 0.141808003f},
+    {32, 2242, 1.15715539f},
+    {-1, 0, 0.284109682f},
+    {-1, 0, 0.108089499f},
+    {43, 2249, 0.934770525f},
+    {1, 2246, 1.15889919f},
+    {-1, 0, 0.198649585f},
+    {28, 2248, 1.02365029f},
+    {-1, 0, -0.0241467394f},
+    {-1, 0, 0.0423803441f},
+    {-1, 0, -0.100374237f},
+    {43, 2284, 0.962236941f},
+    {1, 2261, 1.14582312f},
+    {43, 2256, 0.930782914f},
+    {4, 2255, 0.386916608f},
+    {-1, 0, 0.547723889f},
+    {-1, 0, 0.226356417f},
+    {20, 2258, 0.963960171f},
+    {-1, 0, 0.157938734f},
+    {5, 2260, 0.188556001f},
+    {-1, 0, 0.378507197f},
+    {-1, 0, 0.265879571f},
+    {24, 2279, 0.403712004f},
+    {0, 2274, 0.962941766f},
+    {5, 2269, 0.197116002f},
+    {20, 2268, 0.912964582f},
+    {43, 2267, 0.923699558f},
+    {-1, 0, 0.173339337f},
+    {-1, 0, 0.00844804198f},
+    {-1, 0, 0.24816069f},
+    {41, 2273, 1.20334625f},
+    {8, 2272, 0.99246031f},
+    {-1, 0, 0.00849254616f},
+    {-1, 0, 0.090291895f},
+    {-1, 0, -0.0654626563f},
+    {4, 2278, 0.362586498f},
+    {1, 2277, 1.19429874f},
+    {-1, 0, 0.433331579f},
+    {-1, 0, 0.162806585f},
+    {-1, 0, 0.151669875f},
+    {40, 2281, 0.979191422f},
+    {-1, 0, -0.123700388f},
+    {43, 2283, 0.920447409f},
+    {-1, 0, 0.0663756803f},
+    {-1, 0, -0.0232027192f},
+    {15, 2286, 0.188697994f},
+    {-1, 0, -0.081071265f},
+    {-1, 0, -0.349898458f},
+    {23, 2389, 0.896501482f},
+    {5, 2322, 0.155471995f},
+    {2, 2299, 1.1298939f},
+    {43, 2296, 0.89072293f},
+    {33, 2295, 0.884740949f},
+    {0, 2294, 0.979638755f},
+    {-1, 0, 0.831961513f},
+    {-1, 0, 0.879275084f},
+    {-1, 0, 0.769055307f},
+    {4, 2298, 0.544686675f},
+    {-1, 0, 0.727947772f},
+    {-1, 0, 0.625602305f},
+    {33, 2303, 0.874317706f},
+    {33, 2302, 0.867914855f},
+    {-1, 0, 0.728764653f},
+    {-1, 0, 0.554322183f},
+    {40, 2321, 0.973080456f},
+    {33, 2312, 0.884740949f},
+    {11, 2309, 1.17495418f},
+    {43, 2308, 0.886172056f},
+    {-1, 0, 0.525906861f},
+    {-1, 0, 0.424148858f},
+    {23, 2311, 0.883303285f},
+    {-1, 0, 0.379452705f},
+    {-1, 0, 0.294509321f},
+    {3, 2320, 0.905821443f},
+    {15, 2315, 0.133763999f},
+    {-1, 0, 0.380507678f},
+    {43, 2319, 0.906701088f},
+    {8, 2318, 0.99246031f},
+    {-1, 0, 0.253127247f},
+    {-1, 0, 0.326143593f},
+    {-1, 0, 0.155864507f},
+    {-1, 0, 0.160164863f},
+    {-1, 0, 0.593621492f},
+    {14, 2362, 0.558970571f},
+    {43, 2339, 0.886172056f},
+    {21, 2330, 1.13953161f},
+    {30, 2327, 0.930868268f},
+    {-1, 0, 0.476862729f},
+    {43, 2329, 0.881482244f},
+    {-1, 0, 0.740129054f},
+    {-1, 0, 0.570426106f},
+    {43, 2334, 0.869980335f},
+    {48, 2333, 1.00517833f},
+    {-1, 0, 0.588188291f},
+    {-1, 0, 0.420564562f},
+    {43, 2338, 0.881482244f},
+    {4, 2337, 0.499599695f},
+    {-1, 0, 0.39050585f},
+    {-1, 0, 0.232051253f},
+    {-1, 0, 0.17268759f},
+    {1, 2345, 1.12920785f},
+    {4, 2342, 0.499599695f},
+    {-1, 0, 0.582251728f},
+    {43, 2344, 0.894983411f},
+    {-1, 0, 0.41609031f},
+    {-1, 0, 0.152649119f},
+    {34, 2351, 0.477444589f},
+    {1, 2348, 1.14582312f},
+    {-1, 0, 0.399278522f},
+    {43, 2350, 0.89072293f},
+    {-1, 0, 0.25036937f},
+    {-1, 0, 0.132236838f},
+    {42, 2359, 1.13319731f},
+    {43, 2358, 0.89905709f},
+    {8, 2355, 0.996500373f},
+    {-1, 0, 0.0652667657f},
+    {43, 2357, 0.894983411f},
+    {-1, 0, 0.198905334f},
+    {-1, 0, 0.128841594f},
+    {-1, 0, 0.0239961129f},
+    {3, 2361, 0.898096085f},
+    {-1, 0, -0.165516332f},
+    {-1, 0, 0.000642657396f},
+    {31, 2380, 1.12767088f},
+    {5, 2367, 0.167283997f},
+    {43, 2366, 0.89072293f},
+    {-1, 0, 0.474921554f},
+    {-1, 0, 0.296303004f},
+    {4, 2373, 0.575153291f},
+    {43, 2370, 0.886172056f},
+    {-1, 0, 0.269852728f},
+    {0, 2372, 0.991121888f},
+    {-1, 0, 0.105366372f},
+    {-1, 0, 0.0623117313f},
+    {41, 2375, 1.11231971f},
+    {-1, 0, 0.164018884f},
+    {30, 2379, 0.988175929f},
+    {48, 2378, 1.02144539f},
+    {-1, 0, 0.0134110581f},
+    {-1, 0, -0.0870005786f},
+    {-1, 0, 0.0444754027f},
+    {10, 2386, 0.987071216f},
+    {43, 2385, 0.886172056f},
+    {8, 2384, 0.987664461f},
+    {-1, 0, -0.223794669f},
+    {-1, 0, -0.0932890549f},
+    {-1, 0, -0.423234165f},
+    {10, 2388, 0.99335736f},
+    {-1, 0, -0.0447306633f},
+    {-1, 0, 0.00772382179f},
+    {42, 2583, 1.16069233f},
+    {44, 2522, 0.546171188f},
+    {35, 2441, 0.149417996f},
+    {43, 2416, 0.913851917f},
+    {21, 2403, 1.13953161f},
+    {10, 2396, 0.973692596f},
+    {-1, 0, 0.357257575f},
+    {43, 2398, 0.902836859f},
+    {-1, 0, 0.726014912f},
+    {43, 2402, 0.910377562f},
+    {23, 2401, 0.904336691f},
+    {-1, 0, 0.634532511f},
+    {-1, 0, 0.535620809f},
+    {-1, 0, 0.483728677f},
+    {2, 2409, 1.15904737f},
+    {43, 2406, 0.906701088f},
+    {-1, 0, 0.420753539f},
+    {38, 2408, 1.02125835f},
+    {-1, 0, 0.277219087f},
+    {-1, 0, 0.184458658f},
+    {15, 2411, 0.131047994f},
+    {-1, 0, 0.27619344f},
+    {4, 2415, 0.510396779f},
+    {35, 2414, 0.142872006f},
+    {-1, 0, 0.155343339f},
+    {-1, 0, 0.0816632882f},
+    {-1, 0, 0.0250697024f},
+    {38, 2440, 1.08411169f},
+    {15, 2427, 0.127900004f},
+    {1, 2426, 1.18345451f},
+    {25, 2423, 0.123525999f},
+    {23, 2422, 0.921725035f},
+    {-1, 0, 0.513473213f},
+    {-1, 0, 0.354286969f},
+    {33, 2425, 0.926028848f},
+    {-1, 0, 0.313144654f},
+    {-1, 0, 0.178669795f},
+    {-1, 0, 0.168197811f},
+    {31, 2433, 1.12767088f},
+    {43, 2430, 0.927065313f},
+    {-1, 0, 0.384493023f},
+    {43, 2432, 0.939059615f},
+    {-1, 0, 0.240366891f},
+    {-1, 0, 0.11745505f},
+    {14, 2437, 0.462029994f},
+    {8, 2436, 1.01632047f},
+    {-1, 0, 0.0161413494f},
+    {-1, 0, 0.17382212f},
+    {5, 2439, 0.144385993f},
+    {-1, 0, 0.0334891714f},
+    {-1, 0, -0.12415608f},
+    {-1, 0, -0.493801057f},
+    {42, 2471, 1.13319731f},
+    {24, 2452, 0.476305306f},
+    {10, 2449, 0.983047485f},
+    {12, 2446, 1.11506557f},
+    {-1, 0, 0.291229367f},
+    {5, 2448, 0.185951993f},
+    {-1, 0, 0.181908667f},
+    {-1, 0, -0.0104433158f},
+    {11, 2451, 1.11394656f},
+    {-1, 0, 0.531931758f},
+    {-1, 0, 0.303064287f},
+    {5, 2456, 0.153318003f},
+    {1, 2455, 1.12920785f},
+    {-1, 0, 0.44148013f},
+    {-1, 0, 0.0687099844f},
+    {4, 2464, 0.519812882f},
+    {12, 2461, 1.11506557f},
+    {5, 2460, 0.178568006f},
+    {-1, 0, 0.236416191f},
+    {-1, 0, 0.0561348014f},
+    {43, 2463, 0.906701088f},
+    {-1, 0, 0.0985009521f},
+    {-1, 0, 0.013808459f},
+    {43, 2468, 0.930782914f},
+    {12, 2467, 1.11506557f},
+    {-1, 0, 0.143372297f},
+    {-1, 0, -0.00246905256f},
+    {4, 2470, 0.531412601f},
+    {-1, 0, -0.109348342f},
+    {-1, 0, -0.271564066f},
+    {43, 2499, 0.923699558f},
+    {24, 2484, 0.476305306f},
+    {5, 2477, 0.153318003f},
+    {43, 2476, 0.920447409f},
+    {-1, 0, 0.273762017f},
+    {-1, 0, 0.189098269f},
+    {43, 2481, 0.913851917f},
+    {5, 2480, 0.185951993f},
+    {-1, 0, 0.20230414f},
+    {-1, 0, 0.0186904818f},
+    {42, 2483, 1.14837039f},
+    {-1, 0, 0.0460848995f},
+    {-1, 0, -0.0462765656f},
+    {20, 2492, 0.978850424f},
+    {5, 2489, 0.159278005f},
+    {43, 2488, 0.906701088f},
+    {-1, 0, 0.0756665543f},
+    {-1, 0, -0.159456328f},
+    {0, 2491, 0.971916854f},
+    {-1, 0, -0.434157252f},
+    {-1, 0, -0.285558105f},
+    {5, 2496, 0.159278005f},
+    {44, 2495, 0.53341502f},
+    {-1, 0, 0.0636546984f},
+    {-1, 0, -0.157355726f},
+    {42, 2498, 1.14837039f},
+    {-1, 0, -0.0108184638f},
+    {-1, 0, -0.148970708f},
+    {34, 2511, 0.490761787f},
+    {5, 2504, 0.153318003f},
+    {30, 2503, 0.990193546f},
+    {-1, 0, 0.101633675f},
+    {-1, 0, 0.0334991664f},
+    {41, 2508, 1.14820385f},
+    {30, 2507, 0.99786073f},
+    {-1, 0, -0.0440722778f},
+    {-1, 0, 0.0592051707f},
+    {20, 2510, 0.98516494f},
+    {-1, 0, -0.305271f},
+    {-1, 0, -0.0979262665f},
+    {1, 2519, 1.12920785f},
+    {43, 2516, 0.943503678f},
+    {2, 2515, 1.10615003f},
+    {-1, 0, -0.0804723799f},
+    {-1, 0, -0.197682172f},
+    {4, 2518, 0.510396779f},
+    {-1, 0, -0.211299539f},
+    {-1, 0, -0.399977475f},
+    {0, 2521, 0.98184222f},
+    {-1, 0, -0.553873241f},
+    {-1, 0, -0.379020482f},
+    {5, 2572, 0.188556001f},
+    {33, 2569, 0.942302465f},
+    {43, 2544, 0.906701088f},
+    {5, 2533, 0.155471995f},
+    {2, 2528, 1.1298939f},
+    {-1, 0, 0.51939559f},
+    {1, 2532, 1.17154479f},
+    {43, 2531, 0.902836859f},
+    {-1, 0, 0.227172092f},
+    {-1, 0, 0.060931243f},
+    {-1, 0, -0.0297440439f},
+    {42, 2539, 1.13319731f},
+    {11, 2536, 1.11394656f},
+    {-1, 0, 0.230144098f},
+    {43, 2538, 0.894983411f},
+    {-1, 0, 0.184605598f},
+    {-1, 0, -0.00607460644f},
+    {5, 2541, 0.171509996f},
+    {-1, 0, -0.0426806249f},
+    {4, 2543, 0.558590889f},
+    {-1, 0, -0.162005678f},
+    {-1, 0, -0.409863651f},
+    {5, 2558, 0.159278005f},
+    {13, 2553, 0.920781374f},
+    {5, 2550, 0.136225998f},
+    {33, 2549, 0.922699213f},
+    {-1, 0, 0.2685875f},
+    {-1, 0, -0.00572103867f},
+    {30, 2552, 0.976689696f},
+    {-1, 0, -0.205003589f},
+    {-1, 0, -0.00862352829f},
+    {5, 2555, 0.136225998f},
+    {-1, 0, 0.0509656221f},
+    {10, 2557, 0.99335736f},
+    {-1, 0, -0.291698933f},
+    {-1, 0, -0.0818635747f},
+    {1, 2564, 1.12920785f},
+    {42, 2563, 1.13319731f},
+    {4, 2562, 0.575153291f},
+    {-1, 0, -0.0529878698f},
+    {-1, 0, -0.230070457f},
+    {-1, 0, -0.32420519f},
+    {5, 2566, 0.173940003f},
+    {-1, 0, -0.359019578f},
+    {40, 2568, 0.985345602f},
+    {-1, 0, -0.650946975f},
+    {-1, 0, -0.491570711f},
+    {33, 2571, 0.956241488f},
+    {-1, 0, -0.435145646f},
+    {-1, 0, -0.701242864f},
+    {4, 2578, 0.575153291f},
+    {2, 2577, 1.1298939f},
+    {0, 2576, 0.993314385f},
+    {-1, 0, -0.0242955945f},
+    {-1, 0, -0.116792813f},
+    {-1, 0, -0.555253088f},
+    {11, 2582, 1.13417459f},
+    {43, 2581, 0.913851917f},
+    {-1, 0, -0.447282881f},
+    {-1, 0, -0.677653611f},
+    {-1, 0, -0.788515627f},
+    {5, 2605, 0.148019999f},
+    {11, 2586, 1.13417459f},
+    {-1, 0, -0.530947506f},
+    {35, 2590, 0.123627998f},
+    {11, 2589, 1.18662906f},
+    {-1, 0, 0.329039633f},
+    {-1, 0, -0.0508789904f},
+    {43, 2598, 0.920447409f},
+    {5, 2593, 0.141808003f},
+    {-1, 0, 0.166078955f},
+    {43, 2597, 0.917248428f},
+    {12, 2596, 1.16265464f},
+    {-1, 0, 0.0714225322f},
+    {-1, 0, 0.0248577483f},
+    {-1, 0, -0.0309130549f},
+    {41, 2604, 1.17285359f},
+    {43, 2603, 0.930782914f},
+    {20, 2602, 0.978850424f},
+    {-1, 0, -0.119867854f},
+    {-1, 0, -0.00322506879f},
+    {-1, 0, -0.177738175f},
+    {-1, 0, -0.310768306f},
+    {43, 2607, 0.902836859f},
+    {-1, 0, -0.0805967525f},
+    {1, 2609, 1.14582312f},
+    {-1, 0, -0.178053901f},
+    {4, 2625, 0.575153291f},
+    {43, 2618, 0.923699558f},
+    {4, 2613, 0.487102389f},
+    {-1, 0, -0.264010727f},
+    {0, 2615, 0.960556686f},
+    {-1, 0, -0.601319849f},
+    {5, 2617, 0.151035994f},
+    {-1, 0, -0.390120238f},
+    {-1, 0, -0.513671398f},
+    {24, 2620, 0.476305306f},
+    {-1, 0, -0.502775908f},
+    {1, 2624, 1.17154479f},
+    {43, 2623, 0.930782914f},
+    {-1, 0, -0.590138257f},
+    {-1, 0, -0.678792894f},
+    {-1, 0, -0.74940294f},
+    {2, 2627, 1.17161393f},
+    {-1, 0, -0.84574002f},
+    {-1, 0, -0.929631174f},
+    {43, 4986, 1.13930881f},
+    {5, 3611, 0.0748900026f},
+    {13, 2862, 1.0107758f},
+    {3, 2695, 0.976586819f},
+    {3, 2674, 0.962109208f},
+    {13, 2655, 0.973002732f},
+    {5, 2648, 0.0619920008f},
+    {5, 2641, 0.0389619991f},
+    {4, 2640, 0.39912051f},
+    {23, 2639, 0.982955992f},
+    {-1, 0, 0.998409212f},
+    {-1, 0, 0.987511039f},
+    {-1, 0, 0.965995193f},
+    {12, 2643, 1.14998126f},
+    {-1, 0, 0.967892587f},
+    {42, 2647, 1.27543628f},
+    {4, 2646, 0.431926012f},
+    {-1, 0, 0.959763885f},
+    {-1, 0, 0.910939813f},
+    {-1, 0, 0.90084666f},
+    {4, 2652, 0.301314652f},
+    {42, 2651, 1.23313165f},
+    {-1, 0, 0.980583966f},
+    {-1, 0, 0.893974304f},
+    {1, 2654, 1.10409284f},
+    {-1, 0, 0.86212033f},
+    {-1, 0, 0.759843409f},
+    {25, 2667, 0.0561919995f},
+    {23, 2664, 1.0189538f},
+    {35, 2661, 0.0471220016f},
+    {4, 2660, 0.375998706f},
+    {-1, 0, 0.967129946f},
+    {-1, 0, 0.916957319f},
+    {32, 2663, 1.24633205f},
+    {-1, 0, 0.891268969f},
+    {-1, 0, 0.797356665f},
+    {10, 2666, 0.995610356f},
+    {-1, 0, 0.751870632f},
+    {-1, 0, 0.84667933f},
+    {4, 2673, 0.499599695f},
+    {31, 2672, 1.22520864f},
+    {24, 2671, 0.296198696f},
+    {-1, 0, 0.887754679f},
+    {-1, 0, 0.7459445f},
+    {-1, 0, 0.660477281f},
+    {-1, 0, 0.527968884f},
+    {25, 2692, 0.0694200024f},
+    {5, 2687, 0.0619920008f},
+    {4, 2686, 0.531412601f},
+    {33, 2685, 1.06867754f},
+    {5, 2680, 0.0389619991f},
+    {-1, 0, 0.899376869f},
+    {13, 2682, 0.981986046f},
+    {-1, 0, 0.907853305f},
+    {42, 2684, 1.30524385f},
+    {-1, 0, 0.803386152f},
+    {-1, 0, 0.704170704f},
+    {-1, 0, 0.667850614f},
+    {-1, 0, 0.603244662f},
+    {33, 2689, 1.01232445f},
+    {-1, 0, 0.807351828f},
+    {8, 2691, 1.08396757f},
+    {-1, 0, 0.424620658f},
+    {-1, 0, 0.608574986f},
+    {4, 2694, 0.519812882f},
+    {-1, 0, 0.463918656f},
+    {-1, 0, 0.280028492f},
+    {44, 2787, 0.502447844f},
+    {43, 2718, 0.993731499f},
+    {15, 2711, 0.0690559968f},
+    {43, 2710, 0.989343405f},
+    {4, 2705, 0.309403807f},
+    {43, 2702, 0.971725464f},
+    {-1, 0, 0.977761507f},
+    {42, 2704, 1.26469636f},
+    {-1, 0, 0.936526f},
+    {-1, 0, 0.890940487f},
+    {21, 2709, 1.27406502f},
+    {0, 2708, 0.97480011f},
+    {-1, 0, 0.858386099f},
+    {-1, 0, 0.903716922f},
+    {-1, 0, 0.702105463f},
+    {-1, 0, 0.685067952f},
+    {4, 2713, 0.240021199f},
+    {-1, 0, 0.797717631f},
+    {32, 2717, 1.2578609f},
+    {22, 2716, 1.25133741f},
+    {-1, 0, 0.606427908f},
+    {-1, 0, 0.546531618f},
+    {-1, 0, 0.360948682f},
+    {5, 2744, 0.0619920008f},
+    {15, 2725, 0.0485399999f},
+    {31, 2722, 1.26956642f},
+    {-1, 0, 0.932970047f},
+    {14, 2724, 0.303198308f},
+    {-1, 0, 0.852305353f},
+    {-1, 0, 0.670682728f},
+    {43, 2737, 1.02361953f},
+    {4, 2730, 0.301314652f},
+    {42, 2729, 1.2901274f},
+    {-1, 0, 0.818513989f},
+    {-1, 0, 0.680512965f},
+    {43, 2734, 1.01283598f},
+    {21, 2733, 1.26855767f},
+    {-1, 0, 0.728962004f},
+    {-1, 0, 0.598824084f},
+    {40, 2736, 0.978052974f},
+    {-1, 0, 0.40139696f},
+    {-1, 0, 0.606813073f},
+    {8, 2743, 1.02200055f},
+    {0, 2740, 0.957801342f},
+    {-1, 0, 0.220093802f},
+    {4, 2742, 0.32010591f},
+    {-1, 0, 0.423645735f},
+    {-1, 0, 0.330189079f},
+    {-1, 0, 0.634541512f},
+    {2, 2762, 1.26613379f},
+    {4, 2749, 0.309403807f},
+    {31, 2748, 1.25290132f},
+    {-1, 0, 0.802093804f},
+    {-1, 0, 0.505523026f},
+    {43, 2757, 1.01283598f},
+    {43, 2754, 1.00191236f},
+    {11, 2753, 1.2560631f},
+    {-1, 0, 0.483533949f},
+    {-1, 0, 0.414806694f},
+    {2, 2756, 1.25471163f},
+    {-1, 0, 0.41673103f},
+    {-1, 0, 0.349050432f},
+    {30, 2759, 0.982218206f},
+    {-1, 0, 0.156233579f},
+    {1, 2761, 1.24924493f},
+    {-1, 0, 0.33055082f},
+    {-1, 0, 0.252324075f},
+    {34, 2772, 0.213127807f},
+    {43, 2769, 1.04105961f},
+    {43, 2766, 1.02001345f},
+    {-1, 0, 0.671761572f},
+    {0, 2768, 0.954700708f},
+    {-1, 0, 0.391262382f},
+    {-1, 0, 0.534490705f},
+    {0, 2771, 0.967017829f},
+    {-1, 0, 0.0799096599f},
+    {-1, 0, 0.359985173f},
+    {43, 2780, 1.0268327f},
+    {43, 2777, 1.01283598f},
+    {4, 2776, 0.375998706f},
+    {-1, 0, 0.387512952f},
+    {-1, 0, 0.209190845f},
+    {24, 2779, 0.323161215f},
+    {-1, 0, 0.223289207f},
+    {-1, 0, 0.0418878421f},
+    {0, 2784, 0.968786538f},
+    {33, 2783, 1.02636349f},
+    {-1, 0, -0.107502751f},
+    {-1, 0, -0.251764625f},
+    {44, 2786, 0.316127211f},
+    {-1, 0, 0.056573458f},
+    {-1, 0, -0.0600803941f},
+    {5, 2795, 0.0473139994f},
+    {43, 2792, 1.01679003f},
+    {40, 2791, 0.957959414f},
+    {-1, 0, 0.85337019f},
+    {-1, 0, 0.808288872f},
+    {11, 2794, 1.29323101f},
+    {-1, 0, 0.675012052f},
+    {-1, 0, 0.438436359f},
+    {5, 2831, 0.0671420023f},
+    {33, 2816, 1.005018f},
+    {25, 2809, 0.0660799965f},
+    {40, 2806, 0.974451244f},
+    {43, 2803, 0.998203158f},
+    {33, 2802, 0.992904782f},
+    {-1, 0, 0.388082355f},
+    {-1, 0, 0.291370273f},
+    {8, 2805, 1.01135957f},
+    {-1, 0, 0.159306154f},
+    {-1, 0, 0.274063438f},
+    {22, 2808, 1.25133741f},
+    {-1, 0, 0.530559003f},
+    {-1, 0, 0.407993704f},
+    {43, 2811, 0.998203158f},
+    {-1, 0, 0.308867931f},
+    {42, 2813, 1.24771786f},
+    {-1, 0, 0.212464646f},
+    {43, 2815, 1.00191236f},
+    {-1, 0, 0.159435764f},
+    {-1, 0, 0.0910630822f},
+    {31, 2830, 1.27997029f},
+    {25, 2823, 0.0635700002f},
+    {42, 2820, 1.26469636f},
+    {-1, 0, 0.342357308f},
+    {35, 2822, 0.0566219985f},
+    {-1, 0, 0.241901323f},
+    {-1, 0, 0.136927292f},
+    {43, 2827, 1.02001345f},
+    {32, 2826, 1.2578609f},
+    {-1, 0, 0.172990292f},
+    {-1, 0, 0.0443653055f},
+    {14, 2829, 0.545403123f},
+    {-1, 0, 0.00846019853f},
+    {-1, 0, -0.138143212f},
+    {-1, 0, -0.136588171f},
+    {41, 2851, 1.26484537f},
+    {43, 2844, 0.998203158f},
+    {33, 2837, 0.988406062f},
+    {21, 2836, 1.25167799f},
+    {-1, 0, 0.397390783f},
+    {-1, 0, 0.207338348f},
+    {4, 2841, 0.595098972f},
+    {38, 2840, 1.02125835f},
+    {-1, 0, 0.131364763f},
+    {-1, 0, 0.260621935f},
+    {33, 2843, 0.997271121f},
+    {-1, 0, 0.121381111f},
+    {-1, 0, 0.0362858735f},
+    {4, 2846, 0.510396779f},
+    {-1, 0, 0.358234257f},
+    {41, 2848, 1.2407701f},
+    {-1, 0, 0.163681298f},
+    {43, 2850, 1.01283598f},
+    {-1, 0, -0.0257044919f},
+    {-1, 0, -0.0946709812f},
+    {31, 2859, 1.27493799f},
+    {43, 2856, 1.00576568f},
+    {4, 2855, 0.558590889f},
+    {-1, 0, 0.118064463f},
+    {-1, 0, -0.0850135162f},
+    {33, 2858, 1.00856853f},
+    {-1, 0, -0.140386179f},
+    {-1, 0, -0.283796638f},
+    {4, 2861, 0.575153291f},
+    {-1, 0, -0.267276555f},
+    {-1, 0, -0.409869194f},
+    {43, 3262, 1.08314598f},
+    {34, 3057, 0.490761787f},
+    {15, 2950, 0.0415359996f},
+    {34, 2913, 0.332257986f},
+    {4, 2886, 0.127657399f},
+    {20, 2879, 0.967827559f},
+    {8, 2874, 1.00270152f},
+    {18, 2873, 1.01807451f},
+    {40, 2872, 0.964930654f},
+    {-1, 0, 0.723917007f},
+    {-1, 0, 0.795181394f},
+    {-1, 0, 0.640430033f},
+    {16, 2878, 0.0f},
+    {0, 2877, 0.957801342f},
+    {-1, 0, 0.773593545f},
+    {-1, 0, 0.843228757f},
+    {-1, 0, 0.938286066f},
+    {28, 2885, 1.09952641f},
+    {41, 2882, 1.3794868f},
+    {-1, 0, 0.756603956f},
+    {0, 2884, 0.97480011f},
+    {-1, 0, 0.579531074f},
+    {-1, 0, 0.717403293f},
+    {-1, 0, 0.842685163f},
+    {35, 2900, 0.029716f},
+    {18, 2895, 1.0151f},
+    {0, 2892, 0.950959086f},
+    {13, 2891, 1.08739161f},
+    {-1, 0, 0.707562149f},
+    {-1, 0, 0.629238904f},
+    {43, 2894, 1.06898022f},
+    {-1, 0, 0.818865359f},
+    {-1, 0, 0.743895352f},
+    {43, 2897, 1.06898022f},
+    {-1, 0, 0.765446544f},
+    {28, 2899, 1.02876401f},
+    {-1, 0, 0.467337877f},
+    {-1, 0, 0.634632885f},
+    {43, 2906, 1.05459571f},
+    {43, 2903, 1.03028905f},
+    {-1, 0, 0.888724506f},
+    {18, 2905, 1.03124225f},
+    {-1, 0, 0.695357561f},
+    {-1, 0, 0.598891139f},
+    {43, 2910, 1.07335508f},
+    {0, 2909, 0.971916854f},
+    {-1, 0, 0.441080391f},
+    {-1, 0, 0.545069277f},
+    {4, 2912, 0.142096698f},
+    {-1, 0, 0.612739265f},
+    {-1, 0, 0.333237737f},
+    {5, 2925, 0.0301660001f},
+    {4, 2918, 0.412739813f},
+    {20, 2917, 0.965969622f},
+    {-1, 0, 0.622440279f},
+    {-1, 0, 0.490860134f},
+    {43, 2920, 1.06481969f},
+    {-1, 0, 0.475231707f},
+    {13, 2924, 1.10606813f},
+    {0, 2923, 0.973408639f},
+    {-1, 0, 0.260176897f},
+    {-1, 0, 0.352307528f},
+    {-1, 0, 0.179593459f},
+    {43, 2935, 1.05921125f},
+    {31, 2930, 1.35772836f},
+    {5, 2929, 0.0325319991f},
+    {-1, 0, 0.510440469f},
+    {-1, 0, 0.377550632f},
+    {5, 2932, 0.0360819995f},
+    {-1, 0, 0.360023618f},
+    {4, 2934, 0.39912051f},
+    {-1, 0, 0.300892919f},
+    {-1, 0, 0.213934511f},
+    {41, 2943, 1.36489868f},
+    {43, 2940, 1.07335508f},
+    {15, 2939, 0.0399999991f},
+    {-1, 0, 0.275873661f},
+    {-1, 0, 0.124202915f},
+    {15, 2942, 0.0399999991f},
+    {-1, 0, 0.142951056f},
+    {-1, 0, -0.00842258427f},
+    {43, 2947, 1.07838476f},
+    {15, 2946, 0.0399999991f},
+    {-1, 0, 0.0971502066f},
+    {-1, 0, -0.062742196f},
+    {5, 2949, 0.0360819995f},
+    {-1, 0, 0.0287121069f},
+    {-1, 0, -0.123137839f},
+    {43, 3002, 1.03028905f},
+    {5, 2971, 0.058600001f},
+    {43, 2960, 1.01283598f},
+    {25, 2955, 0.0491320007f},
+    {-1, 0, 0.908889055f},
+    {41, 2957, 1.27577209f},
+    {-1, 0, 0.833753645f},
+    {4, 2959, 0.350952208f},
+    {-1, 0, 0.72860378f},
+    {-1, 0, 0.581435204f},
+    {35, 2964, 0.0471220016f},
+    {18, 2963, 1.01949894f},
+    {-1, 0, 0.637244523f},
+    {-1, 0, 0.816309988f},
+    {22, 2968, 1.30938971f},
+    {34, 2967, 0.40520519f},
+    {-1, 0, 0.611292839f},
+    {-1, 0, 0.48319608f},
+    {34, 2970, 0.324240088f},
+    {-1, 0, 0.488613516f},
+    {-1, 0, 0.329501569f},
+    {24, 2987, 0.2345061f},
+    {43, 2980, 1.01283598f},
+    {43, 2977, 1.00576568f},
+    {43, 2976, 0.989343405f},
+    {-1, 0, 0.919293284f},
+    {-1, 0, 0.770072043f},
+    {34, 2979, 0.213127807f},
+    {-1, 0, 0.67113924f},
+    {-1, 0, 0.488094568f},
+    {14, 2984, 0.180123806f},
+    {4, 2983, 0.133862898f},
+    {-1, 0, 0.70421958f},
+    {-1, 0, 0.507126093f},
+    {41, 2986, 1.29041314f},
+    {-1, 0, 0.487572849f},
+    {-1, 0, 0.276514709f},
+    {43, 2995, 1.01283598f},
+    {31, 2992, 1.26956642f},
+    {5, 2991, 0.0671420023f},
+    {-1, 0, 0.71367842f},
+    {-1, 0, 0.43188554f},
+    {35, 2994, 0.0685359985f},
+    {-1, 0, 0.361928165f},
+    {-1, 0, 0.163762972f},
+    {25, 2999, 0.0635700002f},
+    {2, 2998, 1.28713977f},
+    {-1, 0, 0.343329668f},
+    {-1, 0, 0.174592406f},
+    {41, 3001, 1.27577209f},
+    {-1, 0, 0.184326172f},
+    {-1, 0, 0.0434475914f},
+    {43, 3034, 1.06481969f},
+    {25, 3019, 0.0613720007f},
+    {43, 3012, 1.04502404f},
+    {14, 3009, 0.351918906f},
+    {2, 3008, 1.28200197f},
+    {-1, 0, 0.637176871f},
+    {-1, 0, 0.392945647f},
+    {5, 3011, 0.0473139994f},
+    {-1, 0, 0.497835875f},
+    {-1, 0, 0.182860196f},
+    {14, 3016, 0.186648607f},
+    {0, 3015, 0.970383525f},
+    {-1, 0, 0.26302883f},
+    {-1, 0, 0.510109901f},
+    {2, 3018, 1.27698696f},
+    {-1, 0, 0.48654291f},
+    {-1, 0, 0.104577579f},
+    {34, 3027, 0.222026095f},
+    {24, 3024, 0.131446302f},
+    {41, 3023, 1.3794868f},
+    {-1, 0, 0.492130488f},
+    {-1, 0, 0.150108308f},
+    {43, 3026, 1.05459571f},
+    {-1, 0, 0.14041394f},
+    {-1, 0, -0.00581103191f},
+    {43, 3031, 1.04999876f},
+    {35, 3030, 0.0636980012f},
+    {-1, 0, 0.0273502711f},
+    {-1, 0, -0.0793454945f},
+    {42, 3033, 1.31708229f},
+    {-1, 0, -0.144533351f},
+    {-1, 0, -0.277267754f},
+    {0, 3044, 0.970383525f},
+    {8, 3037, 0.939417303f},
+    {-1, 0, 0.616407633f},
+    {4, 3041, 0.272093087f},
+    {28, 3040, 1.07534695f},
+    {-1, 0, -0.0903808475f},
+    {-1, 0, -0.49216494f},
+    {31, 3043, 1.35772836f},
+    {-1, 0, -0.159386039f},
+    {-1, 0, -0.359099805f},
+    {24, 3050, 0.131446302f},
+    {42, 3047, 1.33019054f},
+    {-1, 0, 0.645055532f},
+    {5, 3049, 0.0558159985f},
+    {-1, 0, 0.586294651f},
+    {-1, 0, 0.162961423f},
+    {25, 3054, 0.0491320007f},
+    {24, 3053, 0.367134899f},
+    {-1, 0, 0.0979392603f},
+    {-1, 0, -0.0880893245f},
+    {24, 3056, 0.266422689f},
+    {-1, 0, -0.0250369236f},
+    {-1, 0, -0.185389757f},
+    {35, 3153, 0.0566219985f},
+    {42, 3116, 1.36449194f},
+    {15, 3087, 0.0306519996f},
+    {42, 3072, 1.33684874f},
+    {42, 3065, 1.30524385f},
+    {43, 3064, 1.03347719f},
+    {-1, 0, 0.804217815f},
+    {-1, 0, 0.628687322f},
+    {43, 3069, 1.04502404f},
+    {22, 3068, 1.3155309f},
+    {-1, 0, 0.621736228f},
+    {-1, 0, 0.491455913f},
+    {21, 3071, 1.35709262f},
+    {-1, 0, 0.378650546f},
+    {-1, 0, 0.141199276f},
+    {15, 3080, 0.0263260007f},
+    {20, 3077, 0.979949355f},
+    {8, 3076, 1.02461731f},
+    {-1, 0, 0.222672909f},
+    {-1, 0, 0.303805858f},
+    {0, 3079, 0.980734169f},
+    {-1, 0, 0.141759485f},
+    {-1, 0, 0.22020641f},
+    {4, 3084, 0.519812882f},
+    {43, 3083, 1.06898022f},
+    {-1, 0, 0.18160136f},
+    {-1, 0, 0.0521986596f},
+    {1, 3086, 1.33470345f},
+    {-1, 0, 0.157913566f},
+    {-1, 0, -0.124926411f},
+    {43, 3101, 1.05459571f},
+    {25, 3094, 0.037726f},
+    {1, 3091, 1.29253161f},
+    {-1, 0, 0.725011885f},
+    {43, 3093, 1.0268327f},
+    {-1, 0, 0.526316106f},
+    {-1, 0, 0.142742977f},
+    {41, 3098, 1.28570485f},
+    {33, 3097, 1.01951492f},
+    {-1, 0, 0.328102976f},
+    {-1, 0, 0.171099216f},
+    {42, 3100, 1.31074226f},
+    {-1, 0, 0.0527557023f},
+    {-1, 0, -0.0326656662f},
+    {45, 3109, 0.0362179987f},
+    {41, 3106, 1.33048368f},
+    {2, 3105, 1.29729092f},
+    {-1, 0, 0.385186106f},
+    {-1, 0, 0.059239883f},
+    {43, 3108, 1.07335508f},
+    {-1, 0, -0.0186301265f},
+    {-1, 0, -0.119405985f},
+    {4, 3113, 0.595098972f},
+    {22, 3112, 1.34274852f},
+    {-1, 0, -0.0924768001f},
+    {-1, 0, -0.287454486f},
+    {43, 3115, 1.06481969f},
+    {-1, 0, -0.447879821f},
+    {-1, 0, -0.509773731f},
+    {25, 3140, 0.0340000018f},
+    {4, 3133, 0.531412601f},
+    {42, 3126, 1.37892795f},
+    {43, 3123, 1.07838476f},
+    {8, 3122, 1.01135957f},
+    {-1, 0, -0.048645664f},
+    {-1, 0, 0.0916441754f},
+    {40, 3125, 0.970140159f},
+    {-1, 0, -0.146632805f},
+    {-1, 0, -0.0285995286f},
+    {41, 3130, 1.38900673f},
+    {8, 3129, 1.00951266f},
+    {-1, 0, -0.173269793f},
+    {-1, 0, -0.0716119558f},
+    {4, 3132, 0.510396779f},
+    {-1, 0, -0.19021377f},
+    {-1, 0, -0.251700848f},
+    {22, 3135, 1.35655248f},
+    {-1, 0, -0.141228676f},
+    {25, 3137, 0.0274563748f},
+    {-1, 0, -0.225210145f},
+    {43, 3139, 1.07335508f},
+    {-1, 0, -0.283004105f},
+    {-1, 0, -0.436947405f},
+    {14, 3142, 0.52029407f},
+    {-1, 0, -0.304216921f},
+    {15, 3148, 0.0365119986f},
+    {4, 3145, 0.531412601f},
+    {-1, 0, -0.381897748f},
+    {4, 3147, 0.575153291f},
+    {-1, 0, -0.469764858f},
+    {-1, 0, -0.543177426f},
+    {1, 3150, 1.37003601f},
+    {-1, 0, -0.550511718f},
+    {22, 3152, 1.37815118f},
+    {-1, 0, -0.625454843f},
+    {-1, 0, -0.675361395f},
+    {32, 3217, 1.29440069f},
+    {43, 3186, 1.0268327f},
+    {4, 3171, 0.558590889f},
+    {31, 3164, 1.26956642f},
+    {5, 3161, 0.0725020021f},
+    {12, 3160, 1.26136398f},
+    {-1, 0, 0.365061134f},
+    {-1, 0, 0.137150615f},
+    {38, 3163, 1.030141f},
+    {-1, 0, 0.0100029353f},
+    {-1, 0, -0.0623892322f},
+    {35, 3168, 0.0663719997f},
+    {43, 3167, 1.02001345f},
+    {-1, 0, 0.092169404f},
+    {-1, 0, 0.0200450625f},
+    {31, 3170, 1.28492033f},
+    {-1, 0, -0.0353131928f},
+    {-1, 0, -0.200799093f},
+    {2, 3179, 1.26613379f},
+    {43, 3176, 1.0092051f},
+    {5, 3175, 0.0671420023f},
+    {-1, 0, 0.208782196f},
+    {-1, 0, 0.0149239013f},
+    {43, 3178, 1.01679003f},
+    {-1, 0, -0.024632059f},
+    {-1, 0, -0.108700402f},
+    {5, 3183, 0.0725020021f},
+    {43, 3182, 1.01679003f},
+    {-1, 0, -0.0925515965f},
+    {-1, 0, -0.20041123f},
+    {31, 3185, 1.27997029f},
+    {-1, 0, -0.23820053f},
+    {-1, 0, -0.488535643f},
+    {35, 3202, 0.0663719997f},
+    {4, 3195, 0.544686675f},
+    {43, 3192, 1.04105961f},
+    {4, 3191, 0.531412601f},
+    {-1, 0, -0.0601798557f},
+    {-1, 0, 0.00743067265f},
+    {4, 3194, 0.531412601f},
+    {-1, 0, -0.17000185f},
+    {-1, 0, -0.0764147192f},
+    {11, 3199, 1.28311849f},
+    {0, 3198, 0.986992121f},
+    {-1, 0, -0.208446592f},
+    {-1, 0, -0.10195291f},
+    {11, 3201, 1.29816902f},
+    {-1, 0, -0.325397283f},
+    {-1, 0, -0.426613152f},
+    {4, 3210, 0.558590889f},
+    {20, 3207, 0.992255986f},
+    {24, 3206, 0.501248181f},
+    {-1, 0, -0.277329952f},
+    {-1, 0, -0.378838241f},
+    {1, 3209, 1.28231013f},
+    {-1, 0, -0.105067506f},
+    {-1, 0, -0.279361874f},
+    {21, 3214, 1.27912092f},
+    {22, 3213, 1.26253712f},
+    {-1, 0, -0.324384242f},
+    {-1, 0, -0.430747032f},
+    {43, 3216, 1.03712821f},
+    {-1, 0, -0.540758789f},
+    {-1, 0, -0.629416049f},
+    {15, 3247, 0.0703459978f},
+    {14, 3234, 0.545403123f},
+    {5, 3227, 0.0650639981f},
+    {43, 3224, 1.04105961f},
+    {1, 3223, 1.29768944f},
+    {-1, 0, -0.0221924894f},
+    {-1, 0, -0.161143363f},
+    {21, 3226, 1.30399382f},
+    {-1, 0, -0.225260094f},
+    {-1, 0, -0.360583276f},
+    {43, 3231, 1.03347719f},
+    {4, 3230, 0.510396779f},
+    {-1, 0, -0.235285208f},
+    {-1, 0, -0.346727252f},
+    {22, 3233, 1.30938971f},
+    {-1, 0, -0.400888532f},
+    {-1, 0, -0.523724973f},
+    {22, 3242, 1.3155309f},
+    {43, 3239, 1.03712821f},
+    {2, 3238, 1.2921983f},
+    {-1, 0, -0.286511928f},
+    {-1, 0, -0.397771358f},
+    {5, 3241, 0.0650639981f},
+    {-1, 0, -0.46574977f},
+    {-1, 0, -0.561295569f},
+    {22, 3246, 1.32886684f},
+    {4, 3245, 0.575153291f},
+    {-1, 0, -0.449821353f},
+    {-1, 0, -0.567271829f},
+    {-1, 0, -0.663137376f},
+    {1, 3259, 1.31450474f},
+    {43, 3254, 1.03712821f},
+    {1, 3251, 1.29253161f},
+    {-1, 0, -0.438689113f},
+    {4, 3253, 0.519812882f},
+    {-1, 0, -0.4930951f},
+    {-1, 0, -0.585287631f},
+    {11, 3256, 1.28813672f},
+    {-1, 0, -0.550731599f},
+    {43, 3258, 1.05459571f},
+    {-1, 0, -0.673981249f},
+    {-1, 0, -0.743139505f},
+    {4, 3261, 0.575153291f},
+    {-1, 0, -0.69124496f},
+    {-1, 0, -0.863871634f},
+    {15, 3468, 0.0415359996f},
+    {44, 3373, 0.406275392f},
+    {25, 3320, 0.0340000018f},
+    {43, 3291, 1.10664523f},
+    {25, 3282, 0.0314819999f},
+    {20, 3275, 0.963960171f},
+    {23, 3272, 1.16149867f},
+    {13, 3271, 1.06818306f},
+    {-1, 0, 0.609454513f},
+    {-1, 0, 0.441996306f},
+    {3, 3274, 1.10585618f},
+    {-1, 0, 0.486815929f},
+    {-1, 0, 0.605893731f},
+    {8, 3279, 1.0406599f},
+    {20, 3278, 0.986141443f},
+    {-1, 0, 0.292486817f},
+    {-1, 0, 0.142238334f},
+    {28, 3281, 1.03883934f},
+    {-1, 0, 0.33150959f},
+    {-1, 0, 0.488906562f},
+    {8, 3290, 1.06724966f},
+    {43, 3287, 1.08823359f},
+    {13, 3286, 1.0824337f},
+    {-1, 0, 0.435340106f},
+    {-1, 0, 0.254470706f},
+    {13, 3289, 1.07743692f},
+    {-1, 0, 0.243897721f},
+    {-1, 0, 0.0558779836f},
+    {-1, 0, 0.521568f},
+    {13, 3307, 1.09861207f},
+    {13, 3300, 1.0824337f},
+    {49, 3297, 0.0f},
+    {31, 3296, 1.3365109f},
+    {-1, 0, 0.68806535f},
+    {-1, 0, 0.381575197f},
+    {18, 3299, 0.948286235f},
+    {-1, 0, 0.148249388f},
+    {-1, 0, -0.241871551f},
+    {0, 3304, 0.978485048f},
+    {3, 3303, 1.0772531f},
+    {-1, 0, -0.0350219123f},
+    {-1, 0, 0.135396481f},
+    {43, 3306, 1.1249454f},
+    {-1, 0, 0.232464284f},
+    {-1, 0, 0.357058555f},
+    {0, 3313, 0.965028226f},
+    {49, 3312, 0.0f},
+    {20, 3311, 0.953236282f},
+    {-1, 0, 0.0681321546f},
+    {-1, 0, -0.160537943f},
+    {-1, 0, -0.561697304f},
+    {33, 3317, 1.08288527f},
+    {11, 3316, 1.41069651f},
+    {-1, 0, 0.21759674f},
+    {-1, 0, 0.379708141f},
+    {3, 3319, 1.16031682f},
+    {-1, 0, 0.0258546267f},
+    {-1, 0, 0.205426142f},
+    {13, 3344, 1.0824337f},
+    {14, 3335, 0.232900798f},
+    {13, 3328, 1.06358767f},
+    {38, 3327, 1.05997741f},
+    {33, 3326, 1.06438231f},
+    {-1, 0, 0.584307134f},
+    {-1, 0, 0.362481683f},
+    {-1, 0, 0.691587985f},
+    {18, 3332, 0.948286235f},
+    {40, 3331, 0.960635602f},
+    {-1, 0, 0.199248493f},
+    {-1, 0, 0.44070515f},
+    {0, 3334, 0.965028226f},
+    {-1, 0, 0.0184599385f},
+    {-1, 0, 0.183176726f},
+    {1, 3337, 1.32803214f},
+    {-1, 0, 0.379356593f},
+    {43, 3341, 1.10664523f},
+    {0, 3340, 0.967017829f},
+    {-1, 0, -0.0750778839f},
+    {-1, 0, 0.0400895067f},
+    {0, 3343, 0.970383525f},
+    {-1, 0, -0.430445522f},
+    {-1, 0, -0.149775788f},
+    {43, 3358, 1.09922838f},
+    {4, 3351, 0.240021199f},
+    {0, 3348, 0.919523299f},
+    {-1, 0, -0.270721406f},
+    {42, 3350, 1.39885306f},
+    {-1, 0, 0.297555804f},
+    {-1, 0, 0.0916509926f},
+    {48, 3355, 1.0111258f},
+    {40, 3354, 0.968568146f},
+    {-1, 0, -0.284996897f},
+    {-1, 0, -0.177829534f},
+    {41, 3357, 1.35123849f},
+    {-1, 0, 0.115676649f},
+    {-1, 0, -0.0883189514f},
+    {0, 3366, 0.960556686f},
+    {44, 3363, 0.270729393f},
+    {18, 3362, 1.02608585f},
+    {-1, 0, -0.161771864f},
+    {-1, 0, -0.356621861f},
+    {43, 3365, 1.11397874f},
+    {-1, 0, -0.370765239f},
+    {-1, 0, -0.613089621f},
+    {4, 3370, 0.207250193f},
+    {43, 3369, 1.11397874f},
+    {-1, 0, 0.168335438f},
+    {-1, 0, -0.0550618581f},
+    {41, 3372, 1.42646396f},
+    {-1, 0, -0.21821034f},
+    {-1, 0, -0.513800859f},
+    {25, 3415, 0.0250979997f},
+    {43, 3396, 1.10664523f},
+    {13, 3385, 1.07743692f},
+    {0, 3384, 0.979638755f},
+    {12, 3381, 1.3421874f},
+    {8, 3380, 1.03869355f},
+    {-1, 0, 0.162165731f},
+    {-1, 0, 0.216060519f},
+    {40, 3383, 0.97162056f},
+    {-1, 0, 0.0937913209f},
+    {-1, 0, 0.154372618f},
+    {-1, 0, 0.281470656f},
+    {41, 3391, 1.38900673f},
+    {0, 3388, 0.960556686f},
+    {-1, 0, -0.057791017f},
+    {0, 3390, 0.984983087f},
+    {-1, 0, 0.0470837839f},
+    {-1, 0, 0.111191541f},
+    {8, 3395, 1.03245306f},
+    {0, 3394, 0.965028226f},
+    {-1, 0, -0.170646518f},
+    {-1, 0, -0.0963454619f},
+    {-1, 0, -0.00126465177f},
+    {13, 3410, 1.10606813f},
+    {0, 3403, 0.967017829f},
+    {43, 3402, 1.11397874f},
+    {21, 3401, 1.37082255f},
+    {-1, 0, -0.0972511694f},
+    {-1, 0, -0.212484762f},
+    {-1, 0, -0.287216932f},
+    {23, 3407, 1.07779157f},
+    {31, 3406, 1.35083342f},
+    {-1, 0, 0.0647168756f},
+    {-1, 0, -0.0527058579f},
+    {0, 3409, 0.98184222f},
+    {-1, 0, -0.127164707f},
+    {-1, 0, -0.0567336231f},
+    {8, 3412, 1.03108215f},
+    {-1, 0, -0.390691012f},
+    {28, 3414, 1.03410709f},
+    {-1, 0, -0.28474766f},
+    {-1, 0, -0.159727409f},
+    {34, 3439, 0.501817822f},
+    {42, 3432, 1.41181719f},
+    {43, 3425, 1.10664523f},
+    {25, 3422, 0.0314819999f},
+    {14, 3421, 0.475468099f},
+    {-1, 0, 0.00837353431f},
+    {-1, 0, -0.116654456f},
+    {41, 3424, 1.37153876f},
+    {-1, 0, -0.119366467f},
+    {-1, 0, -0.333102286f},
+    {8, 3429, 1.02847731f},
+    {25, 3428, 0.0314819999f},
+    {-1, 0, -0.252594113f},
+    {-1, 0, -0.418374658f},
+    {13, 3431, 1.09273791f},
+    {-1, 0, 0.12699303f},
+    {-1, 0, -0.19192718f},
+    {0, 3436, 0.960556686f},
+    {43, 3435, 1.1249454f},
+    {-1, 0, -0.498327315f},
+    {-1, 0, -0.671497405f},
+    {28, 3438, 1.03132176f},
+    {-1, 0, -0.450474709f},
+    {-1, 0, -0.323045075f},
+    {21, 3453, 1.36398649f},
+    {31, 3446, 1.32996941f},
+    {13, 3443, 1.0398066f},
+    {-1, 0, 0.293804258f},
+    {5, 3445, 0.0325319991f},
+    {-1, 0, 0.0735226497f},
+    {-1, 0, -0.105902947f},
+    {25, 3450, 0.0340000018f},
+    {4, 3449, 0.544686675f},
+    {-1, 0, -0.151872292f},
+    {-1, 0, -0.283095211f},
+    {21, 3452, 1.3429358f},
+    {-1, 0, -0.244615823f},
+    {-1, 0, -0.408784837f},
+    {24, 3461, 0.545653403f},
+    {43, 3458, 1.09922838f},
+    {32, 3457, 1.37084115f},
+    {-1, 0, -0.310425431f},
+    {-1, 0, -0.398079336f},
+    {4, 3460, 0.519812882f},
+    {-1, 0, -0.4698295f},
+    {-1, 0, -0.561534047f},
+    {25, 3465, 0.0274563748f},
+    {0, 3464, 0.973408639f},
+    {-1, 0, -0.427735776f},
+    {-1, 0, -0.359461606f},
+    {31, 3467, 1.39970171f},
+    {-1, 0, -0.569908798f},
+    {-1, 0, -0.746788204f},
+    {13, 3532, 1.0824337f},
+    {28, 3485, 0.969537735f},
+    {48, 3480, 1.06012118f},
+    {4, 3479, 0.119360849f},
+    {4, 3476, 0.0896302983f},
+    {0, 3475, 0.940097868f},
+    {-1, 0, 0.326842189f},
+    {-1, 0, 0.589733601f},
+    {42, 3478, 1.35753155f},
+    {-1, 0, 0.361347198f},
+    {-1, 0, 0.108896352f},
+    {-1, 0, -0.0983581543f},
+    {14, 3484, 0.0924076512f},
+    {23, 3483, 1.02249396f},
+    {-1, 0, 0.802398086f},
+    {-1, 0, 0.708163619f},
+    {-1, 0, 0.513906956f},
+    {14, 3503, 0.129789203f},
+    {15, 3494, 0.0485399999f},
+    {13, 3489, 1.06358767f},
+    {-1, 0, 0.513039112f},
+    {10, 3491, 0.947725415f},
+    {-1, 0, 0.368399858f},
+    {41, 3493, 1.39999998f},
+    {-1, 0, 0.286573499f},
+    {-1, 0, 0.154037327f},
+    {42, 3496, 1.31074226f},
+    {-1, 0, 0.466237098f},
+    {33, 3500, 1.06438231f},
+    {41, 3499, 1.36489868f},
+    {-1, 0, 0.294951618f},
+    {-1, 0, 0.0899848342f},
+    {1, 3502, 1.47612572f},
+    {-1, 0, -0.222314119f},
+    {-1, 0, 0.194745213f},
+    {0, 3519, 0.976062536f},
+    {31, 3512, 1.3645339f},
+    {24, 3509, 0.323161215f},
+    {5, 3508, 0.0619920008f},
+    {-1, 0, -0.205942959f},
+    {-1, 0, -0.338463277f},
+    {5, 3511, 0.0473139994f},
+    {-1, 0, -0.294256389f},
+    {-1, 0, -0.439864665f},
+    {33, 3516, 1.0728749f},
+    {25, 3515, 0.0511960015f},
+    {-1, 0, -0.223185718f},
+    {-1, 0, -0.339880794f},
+    {30, 3518, 0.972818613f},
+    {-1, 0, -0.514890194f},
+    {-1, 0, -0.291406184f},
+    {3, 3525, 1.00268745f},
+    {13, 3524, 1.02867222f},
+    {4, 3523, 0.431926012f},
+    {-1, 0, 0.340657026f},
+    {-1, 0, 0.0641863942f},
+    {-1, 0, -0.0189356823f},
+    {24, 3529, 0.323161215f},
+    {25, 3528, 0.0561919995f},
+    {-1, 0, -0.0707137287f},
+    {-1, 0, -0.250091672f},
+    {35, 3531, 0.0504000001f},
+    {-1, 0, -0.194777593f},
+    {-1, 0, -0.349767238f},
+    {42, 3574, 1.37892795f},
+    {4, 3555, 0.32010591f},
+    {33, 3544, 1.0728749f},
+    {34, 3537, 0.156605005f},
+    {-1, 0, 0.216003194f},
+    {0, 3541, 0.973408639f},
+    {33, 3540, 1.06438231f},
+    {-1, 0, -0.121788062f},
+    {-1, 0, -0.275151461f},
+    {25, 3543, 0.0539540015f},
+    {-1, 0, -0.0515811443f},
+    {-1, 0, -0.171707049f},
+    {48, 3552, 1.06749523f},
+    {5, 3549, 0.0506419986f},
+    {43, 3548, 1.09922838f},
+    {-1, 0, -0.140130505f},
+    {-1, 0, -0.255799383f},
+    {23, 3551, 1.06405568f},
+    {-1, 0, -0.215993956f},
+    {-1, 0, -0.371126831f},
+    {28, 3554, 0.994894624f},
+    {-1, 0, 0.0510782897f},
+    {-1, 0, -0.171009526f},
+    {20, 3567, 0.984172523f},
+    {5, 3562, 0.0473139994f},
+    {34, 3561, 0.490761787f},
+    {43, 3560, 1.08823359f},
+    {-1, 0, -0.372680694f},
+    {-1, 0, -0.473143935f},
+    {-1, 0, -0.6172809f},
+    {4, 3564, 0.338903695f},
+    {-1, 0, -0.510986626f},
+    {38, 3566, 1.01250184f},
+    {-1, 0, -0.576134324f},
+    {-1, 0, -0.642840087f},
+    {41, 3569, 1.34398496f},
+    {-1, 0, -0.247170836f},
+    {15, 3573, 0.0485399999f},
+    {4, 3572, 0.461454749f},
+    {-1, 0, -0.287446856f},
+    {-1, 0, -0.414886773f},
+    {-1, 0, -0.50458616f},
+    {0, 3596, 0.968786538f},
+    {12, 3591, 1.47390151f},
+    {18, 3584, 1.08402038f},
+    {25, 3581, 0.0491320007f},
+    {4, 3580, 0.350952208f},
+    {-1, 0, -0.481498718f},
+    {-1, 0, -0.589333594f},
+    {14, 3583, 0.121753998f},
+    {-1, 0, -0.514246285f},
+    {-1, 0, -0.689686954f},
+    {0, 3588, 0.893471003f},
+    {43, 3587, 1.1249454f},
+    {-1, 0, -0.825732768f},
+    {-1, 0, -0.932253242f},
+    {20, 3590, 0.993366957f},
+    {-1, 0, -0.77809751f},
+    {-1, 0, -0.596269429f},
+    {4, 3595, 0.101230003f},
+    {18, 3594, 1.0058279f},
+    {-1, 0, 0.125882402f},
+    {-1, 0, -0.110158533f},
+    {-1, 0, -0.621248364f},
+    {4, 3598, 0.0969059989f},
+    {-1, 0, -0.119039059f},
+    {4, 3606, 0.32010591f},
+    {43, 3603, 1.10664523f},
+    {4, 3602, 0.127657399f},
+    {-1, 0, -0.229781628f},
+    {-1, 0, -0.375322074f},
+    {42, 3605, 1.39885306f},
+    {-1, 0, -0.426857769f},
+    {-1, 0, -0.558348119f},
+    {15, 3610, 0.0531059988f},
+    {20, 3609, 0.973959744f},
+    {-1, 0, -0.58792758f},
+    {-1, 0, -0.435288608f},
+    {-1, 0, -0.707791626f},
+    {14, 4223, 0.264256299f},
+    {43, 3914, 1.02001345f},
+    {5, 3761, 0.122486003f},
+    {24, 3682, 0.188435197f},
+    {43, 3641, 0.993731499f},
+    {44, 3626, 0.157994494f},
+    {43, 3621, 0.980361938f},
+    {42, 3620, 1.25354946f},
+    {-1, 0, 0.966260016f},
+    {-1, 0, 0.929475963f},
+    {5, 3625, 0.100865997f},
+    {41, 3624, 1.28570485f},
+    {-1, 0, 0.86911881f},
+    {-1, 0, 0.777615845f},
+    {-1, 0, 0.689102769f},
+    {43, 3630, 0.976335227f},
+    {5, 3629, 0.0959059969f},
+    {-1, 0, 0.901859462f},
+    {-1, 0, 0.725510061f},
+    {5, 3636, 0.104287997f},
+    {13, 3633, 0.99961859f},
+    {-1, 0, 0.711272717f},
+    {8, 3635, 1.00524664f},
+    {-1, 0, 0.502607465f},
+    {-1, 0, 0.625517428f},
+    {43, 3640, 0.989343405f},
+    {1, 3639, 1.28746855f},
+    {-1, 0, 0.547392309f},
+    {-1, 0, 0.427424431f},
+    {-1, 0, 0.42012313f},
+    {5, 3667, 0.104287997f},
+    {4, 3652, 0.127657399f},
+    {5, 3645, 0.0881239995f},
+    {-1, 0, 0.808902979f},
+    {41, 3649, 1.31125546f},
+    {41, 3648, 1.28570485f},
+    {-1, 0, 0.747607172f},
+    {-1, 0, 0.635879099f},
+    {1, 3651, 1.32803214f},
+    {-1, 0, 0.435742497f},
+    {-1, 0, 0.606064916f},
+    {43, 3660, 1.0092051f},
+    {30, 3657, 0.977863729f},
+    {33, 3656, 0.997271121f},
+    {-1, 0, 0.516778648f},
+    {-1, 0, 0.388094485f},
+    {44, 3659, 0.157994494f},
+    {-1, 0, 0.623669565f},
+    {-1, 0, 0.5107131f},
+    {30, 3664, 0.987191975f},
+    {38, 3663, 1.01569283f},
+    {-1, 0, 0.347993851f},
+    {-1, 0, 0.225780874f},
+    {0, 3666, 0.977297843f},
+    {-1, 0, 0.33951956f},
+    {-1, 0, 0.493567139f},
+    {4, 3669, 0.142096698f},
+    {-1, 0, 0.683247924f},
+    {33, 3677, 1.01951492f},
+    {33, 3674, 0.997271121f},
+    {42, 3673, 1.25354946f},
+    {-1, 0, 0.474984467f},
+    {-1, 0, 0.321909845f},
+    {43, 3676, 0.998203158f},
+    {-1, 0, 0.337869644f},
+    {-1, 0, 0.189420521f},
+    {40, 3681, 0.996787965f},
+    {41, 3680, 1.31125546f},
+    {-1, 0, 0.0575866252f},
+    {-1, 0, -0.163045809f},
+    {-1, 0, 0.324057817f},
+    {43, 3714, 0.998203158f},
+    {5, 3693, 0.0881239995f},
+    {43, 3690, 0.989343405f},
+    {4, 3687, 0.215596095f},
+    {-1, 0, 0.931947172f},
+    {43, 3689, 0.980361938f},
+    {-1, 0, 0.840522349f},
+    {-1, 0, 0.688819647f},
+    {34, 3692, 0.230289996f},
+    {-1, 0, 0.631952107f},
+    {-1, 0, 0.434462011f},
+    {43, 3699, 0.971725464f},
+    {5, 3698, 0.111956f},
+    {33, 3697, 0.975023091f},
+    {-1, 0, 0.707723916f},
+    {-1, 0, 0.523332179f},
+    {-1, 0, 0.374604017f},
+    {43, 3707, 0.989343405f},
+    {5, 3704, 0.120108001f},
+    {41, 3703, 1.2540704f},
+    {-1, 0, 0.436639994f},
+    {-1, 0, 0.282520771f},
+    {43, 3706, 0.980361938f},
+    {-1, 0, 0.246749014f},
+    {-1, 0, 0.16785951f},
+    {44, 3711, 0.206974f},
+    {42, 3710, 1.26469636f},
+    {-1, 0, 0.36445269f},
+    {-1, 0, 0.182138056f},
+    {33, 3713, 1.005018f},
+    {-1, 0, 0.174832225f},
+    {-1, 0, 0.0830672234f},
+    {5, 3732, 0.0818039998f},
+    {41, 3721, 1.28075159f},
+    {41, 3718, 1.2592231f},
+    {-1, 0, 0.71008563f},
+    {43, 3720, 1.0092051f},
+    {-1, 0, 0.581471682f},
+    {-1, 0, 0.425730288f},
+    {30, 3727, 0.972818613f},
+    {23, 3724, 1.01161134f},
+    {-1, 0, 0.279618233f},
+    {2, 3726, 1.30223262f},
+    {-1, 0, 0.197776139f},
+    {-1, 0, 0.091295518f},
+    {33, 3729, 1.02313185f},
+    {-1, 0, 0.437335193f},
+    {0, 3731, 0.971916854f},
+    {-1, 0, 0.220513791f},
+    {-1, 0, 0.320767134f},
+    {30, 3748, 0.983253896f},
+    {43, 3741, 1.0092051f},
+    {34, 3738, 0.205480903f},
+    {5, 3737, 0.106348f},
+    {-1, 0, 0.183613136f},
+    {-1, 0, -0.029347362f},
+    {33, 3740, 0.997271121f},
+    {-1, 0, 0.0663814172f},
+    {-1, 0, -0.0581979863f},
+    {34, 3745, 0.230289996f},
+    {5, 3744, 0.08495f},
+    {-1, 0, 0.0229183715f},
+    {-1, 0, -0.116506122f},
+    {11, 3747, 1.28813672f},
+    {-1, 0, -0.192735329f},
+    {-1, 0, -0.405667424f},
+    {24, 3754, 0.204005003f},
+    {41, 3751, 1.2540704f},
+    {-1, 0, 0.439585149f},
+    {5, 3753, 0.106348f},
+    {-1, 0, 0.25208649f},
+    {-1, 0, 0.0571621321f},
+    {33, 3758, 1.02313185f},
+    {5, 3757, 0.0881239995f},
+    {-1, 0, 0.323741704f},
+    {-1, 0, 0.0884959921f},
+    {30, 3760, 0.990193546f},
+    {-1, 0, -0.125298664f},
+    {-1, 0, -0.00872253999f},
+    {43, 3817, 0.976335227f},
+    {43, 3784, 0.952899456f},
+    {35, 3777, 0.160114005f},
+    {11, 3772, 1.21467721f},
+    {31, 3767, 1.18126643f},
+    {-1, 0, 0.917808473f},
+    {43, 3769, 0.939059615f},
+    {-1, 0, 0.817894161f},
+    {3, 3771, 0.94306612f},
+    {-1, 0, 0.685711563f},
+    {-1, 0, 0.606078804f},
+    {4, 3774, 0.207250193f},
+    {-1, 0, 0.725517392f},
+    {33, 3776, 0.951525629f},
+    {-1, 0, 0.514138877f},
+    {-1, 0, 0.303195447f},
+    {5, 3783, 0.188556001f},
+    {20, 3780, 0.961823523f},
+    {-1, 0, 0.280658662f},
+    {2, 3782, 1.2203716f},
+    {-1, 0, 0.496959388f},
+    {-1, 0, 0.403711826f},
+    {-1, 0, 0.0884358808f},
+    {14, 3790, 0.186648607f},
+    {4, 3787, 0.157545701f},
+    {-1, 0, 0.783598542f},
+    {43, 3789, 0.966921031f},
+    {-1, 0, 0.582367957f},
+    {-1, 0, 0.403140306f},
+    {1, 3802, 1.22061956f},
+    {24, 3797, 0.256341904f},
+    {12, 3794, 1.18656683f},
+    {-1, 0, 0.623062968f},
+    {0, 3796, 0.931889594f},
+    {-1, 0, 0.095133625f},
+    {-1, 0, 0.317858487f},
+    {2, 3799, 1.20313036f},
+    {-1, 0, 0.181445137f},
+    {18, 3801, 1.02348042f},
+    {-1, 0, 0.0313250907f},
+    {-1, 0, 0.0904197842f},
+    {5, 3810, 0.144385993f},
+    {30, 3807, 0.954093039f},
+    {21, 3806, 1.24525142f},
+    {-1, 0, 0.164030328f},
+    {-1, 0, 0.262571484f},
+    {11, 3809, 1.24368393f},
+    {-1, 0, 0.39635244f},
+    {-1, 0, 0.261717826f},
+    {30, 3814, 0.962382853f},
+    {13, 3813, 0.949080467f},
+    {-1, 0, 0.142492607f},
+    {-1, 0, -0.0200490095f},
+    {34, 3816, 0.258516908f},
+    {-1, 0, 0.160760432f},
+    {-1, 0, 0.0151528884f},
+    {4, 3853, 0.157545701f},
+    {24, 3830, 0.117326401f},
+    {43, 3823, 1.00191236f},
+    {4, 3822, 0.0846849009f},
+    {-1, 0, 0.785845637f},
+    {-1, 0, 0.622341692f},
+    {41, 3825, 1.27577209f},
+    {-1, 0, 0.660721064f},
+    {24, 3827, 0.0992536023f},
+    {-1, 0, 0.520078003f},
+    {41, 3829, 1.30553532f},
+    {-1, 0, 0.396024019f},
+    {-1, 0, 0.263056815f},
+    {43, 3840, 0.998203158f},
+    {12, 3833, 1.26717949f},
+    {-1, 0, 0.460173368f},
+    {4, 3837, 0.142096698f},
+    {18, 3836, 1.00797307f},
+    {-1, 0, 0.39940387f},
+    {-1, 0, 0.325841635f},
+    {0, 3839, 0.965028226f},
+    {-1, 0, 0.164804816f},
+    {-1, 0, 0.298399031f},
+    {0, 3846, 0.954700708f},
+    {10, 3843, 0.923974693f},
+    {-1, 0, -0.173172161f},
+    {43, 3845, 1.01679003f},
+    {-1, 0, 0.0371370576f},
+    {-1, 0, -0.0958703086f},
+    {43, 3850, 1.01679003f},
+    {41, 3849, 1.27577209f},
+    {-1, 0, 0.237042651f},
+    {-1, 0, 0.150643915f},
+    {0, 3852, 0.992193222f},
+    {-1, 0, 0.0536892042f},
+    {-1, 0, 0.178389251f},
+    {42, 3885, 1.28547835f},
+    {14, 3870, 0.202033311f},
+    {43, 3863, 0.998203158f},
+    {30, 3860, 0.96820271f},
+    {5, 3859, 0.153318003f},
+    {-1, 0, 0.122893296f},
+    {-1, 0, -0.0131422766f},
+    {31, 3862, 1.2391299f},
+    {-1, 0, 0.359003901f},
+    {-1, 0, 0.143495649f},
+    {30, 3867, 0.985252738f},
+    {10, 3866, 0.961203992f},
+    {-1, 0, -0.152075112f},
+    {-1, 0, -0.0170263778f},
+    {32, 3869, 1.23884714f},
+    {-1, 0, 0.329020143f},
+    {-1, 0, 0.0525764264f},
+    {42, 3878, 1.25354946f},
+    {2, 3875, 1.2203716f},
+    {21, 3874, 1.17821503f},
+    {-1, 0, 0.441021621f},
+    {-1, 0, 0.0883288905f},
+    {20, 3877, 0.92770344f},
+    {-1, 0, -0.298156977f},
+    {-1, 0, -0.0265038498f},
+    {44, 3882, 0.2243305f},
+    {43, 3881, 1.00191236f},
+    {-1, 0, -0.0561681092f},
+    {-1, 0, -0.196295634f},
+    {0, 3884, 0.976062536f},
+    {-1, 0, -0.477344275f},
+    {-1, 0, -0.280814081f},
+    {4, 3901, 0.207250193f},
+    {14, 3894, 0.180123806f},
+    {43, 3891, 1.0092051f},
+    {20, 3890, 0.982097447f},
+    {-1, 0, -0.0765846521f},
+    {-1, 0, 0.0683821216f},
+    {20, 3893, 0.975253761f},
+    {-1, 0, -0.257969171f},
+    {-1, 0, -0.103371933f},
+    {43, 3898, 1.00576568f},
+    {0, 3897, 0.980734169f},
+    {-1, 0, -0.276924044f},
+    {-1, 0, -0.129809663f},
+    {0, 3900, 0.980734169f},
+    {-1, 0, -0.412898749f},
+    {-1, 0, -0.277777225f},
+    {0, 3909, 0.978485048f},
+    {4, 3906, 0.232080907f},
+    {43, 3905, 1.00191236f},
+    {-1, 0, -0.564406037f},
+    {-1, 0, -0.644040942f},
+    {43, 3908, 1.00576568f},
+    {-1, 0, -0.67709434f},
+    {-1, 0, -0.747233331f},
+    {4, 3911, 0.225210801f},
+    {-1, 0, -0.398175538f},
+    {12, 3913, 1.27780342f},
+    {-1, 0, -0.466099292f},
+    {-1, 0, -0.583881438f},
+    {2, 3974, 1.1298939f},
+    {23, 3945, 1.04022086f},
+    {14, 3934, 0.193544596f},
+    {33, 3929, 1.05425978f},
+    {33, 3924, 1.03671992f},
+    {4, 3921, 0.127657399f},
+    {-1, 0, 0.977047503f},
+    {13, 3923, 0.968109488f},
+    {-1, 0, 0.963501096f},
+    {-1, 0, 0.905927956f},
+    {4, 3928, 0.163932502f},
+    {4, 3927, 0.107340597f},
+    {-1, 0, 0.947675943f},
+    {-1, 0, 0.870306253f},
+    {-1, 0, 0.764585435f},
+    {4, 3931, 0.142096698f},
+    {-1, 0, 0.859622657f},
+    {4, 3933, 0.163932502f},
+    {-1, 0, 0.712249935f},
+    {-1, 0, 0.606765568f},
+    {13, 3940, 0.990998209f},
+    {13, 3937, 0.977541029f},
+    {-1, 0, 0.847263455f},
+    {14, 3939, 0.218245804f},
+    {-1, 0, 0.70843339f},
+    {-1, 0, 0.638539016f},
+    {4, 3944, 0.232080907f},
+    {32, 3943, 1.16942894f},
+    {-1, 0, 0.59926945f},
+    {-1, 0, 0.447464675f},
+    {-1, 0, 0.304011315f},
+    {4, 3965, 0.1923794f},
+    {22, 3954, 1.15368319f},
+    {24, 3951, 0.131446302f},
+    {41, 3950, 1.19469798f},
+    {-1, 0, 0.821004212f},
+    {-1, 0, 0.72768867f},
+    {30, 3953, 0.999956429f},
+    {-1, 0, 0.522317648f},
+    {-1, 0, 0.639568686f},
+    {44, 3956, 0.0975620002f},
+    {-1, 0, 0.67558229f},
+    {33, 3962, 1.09899652f},
+    {4, 3959, 0.142096698f},
+    {-1, 0, 0.439939111f},
+    {23, 3961, 1.05831933f},
+    {-1, 0, 0.339320511f},
+    {-1, 0, 0.204260424f},
+    {4, 3964, 0.151098505f},
+    {-1, 0, 0.206052199f},
+    {-1, 0, -0.0155532192f},
+    {32, 3969, 1.1921587f},
+    {44, 3968, 0.2150006f},
+    {-1, 0, 0.296460241f},
+    {-1, 0, 0.103457332f},
+    {33, 3971, 1.07800603f},
+    {-1, 0, 0.0156015065f},
+    {23, 3973, 1.07271385f},
+    {-1, 0, -0.148417249f},
+    {-1, 0, -0.267453372f},
+    {44, 4102, 0.164433002f},
+    {43, 4039, 1.07335508f},
+    {14, 4008, 0.121753998f},
+    {43, 3993, 1.04999876f},
+    {42, 3986, 1.28547835f},
+    {41, 3983, 1.26484537f},
+    {41, 3982, 1.23334372f},
+    {-1, 0, 0.772164404f},
+    {-1, 0, 0.597038686f},
+    {5, 3985, 0.136225998f},
+    {-1, 0, 0.476269186f},
+    {-1, 0, 0.266792864f},
+    {34, 3990, 0.0843309984f},
+    {41, 3989, 1.37153876f},
+    {-1, 0, 0.354069382f},
+    {-1, 0, 0.142573059f},
+    {0, 3992, 0.954700708f},
+    {-1, 0, -0.00668585533f},
+    {-1, 0, 0.15287967f},
+    {0, 4001, 0.940097868f},
+    {18, 3998, 1.04926491f},
+    {18, 3997, 0.997457445f},
+    {-1, 0, 0.206394702f},
+    {-1, 0, -0.13293317f},
+    {5, 4000, 0.120108001f},
+    {-1, 0, -0.431013316f},
+    {-1, 0, -0.206751347f},
+    {4, 4005, 0.0896302983f},
+    {3, 4004, 1.06286848f},
+    {-1, 0, 0.268627584f},
+    {-1, 0, 0.0964538828f},
+    {18, 4007, 1.00797307f},
+    {-1, 0, 0.0532045588f},
+    {-1, 0, -0.0695474744f},
+    {43, 4024, 1.04999876f},
+    {5, 4017, 0.104287997f},
+    {33, 4014, 1.0161401f},
+    {41, 4013, 1.28075159f},
+    {-1, 0, 0.433416009f},
+    {-1, 0, 0.262662113f},
+    {41, 4016, 1.29041314f},
+    {-1, 0, 0.191325977f},
+    {-1, 0, 0.0334259495f},
+    {0, 4021, 0.960556686f},
+    {4, 4020, 0.157545701f},
+    {-1, 0, -0.179237977f},
+    {-1, 0, -0.349523097f},
+    {42, 4023, 1.25890422f},
+    {-1, 0, 0.224276766f},
+    {-1, 0, -0.0497490875f},
+    {41, 4032, 1.33048368f},
+    {5, 4029, 0.0881239995f},
+    {3, 4028, 1.04351294f},
+    {-1, 0, -0.151245341f},
+    {-1, 0, 0.145944431f},
+    {0, 4031, 0.982929111f},
+    {-1, 0, -0.235728309f},
+    {-1, 0, -0.109511107f},
+    {24, 4036, 0.137893498f},
+    {42, 4035, 1.35753155f},
+    {-1, 0, -0.190802276f},
+    {-1, 0, -0.326816022f},
+    {5, 4038, 0.104287997f},
+    {-1, 0, -0.26922977f},
+    {-1, 0, -0.446010917f},
+    {41, 4071, 1.38900673f},
+    {4, 4056, 0.0969059989f},
+    {28, 4049, 0.969537735f},
+    {41, 4046, 1.33707452f},
+    {23, 4045, 1.02929282f},
+    {-1, 0, 0.606493592f},
+    {-1, 0, 0.324474424f},
+    {0, 4048, 0.989027202f},
+    {-1, 0, 0.0978303775f},
+    {-1, 0, 0.245888069f},
+    {0, 4053, 0.965028226f},
+    {11, 4052, 1.33523786f},
+    {-1, 0, -0.334734231f},
+    {-1, 0, -0.171669558f},
+    {43, 4055, 1.10664523f},
+    {-1, 0, 0.00588324992f},
+    {-1, 0, -0.140415519f},
+    {23, 4064, 1.0490768f},
+    {11, 4061, 1.37811399f},
+    {48, 4060, 1.06749523f},
+    {-1, 0, -0.166543692f},
+    {-1, 0, 0.0669533238f},
+    {23, 4063, 1.03633714f},
+    {-1, 0, 0.284956753f},
+    {-1, 0, 0.0191531014f},
+    {34, 4068, 0.126164302f},
+    {41, 4067, 1.34398496f},
+    {-1, 0, -0.1819603f},
+    {-1, 0, -0.328127086f},
+    {1, 4070, 1.14582312f},
+    {-1, 0, -0.0414975844f},
+    {-1, 0, -0.42733264f},
+    {24, 4087, 0.0785211623f},
+    {28, 4080, 1.0223726f},
+    {5, 4077, 0.146039993f},
+    {28, 4076, 0.969537735f},
+    {-1, 0, -0.00440343097f},
+    {-1, 0, -0.316430748f},
+    {18, 4079, 0.965817988f},
+    {-1, 0, 0.126783684f},
+    {-1, 0, -0.0606164038f},
+    {0, 4084, 0.931889594f},
+    {41, 4083, 1.41196477f},
+    {-1, 0, -0.408856392f},
+    {-1, 0, -0.627209127f},
+    {43, 4086, 1.10664523f},
+    {-1, 0, -0.222885638f},
+    {-1, 0, -0.424534082f},
+    {43, 4095, 1.09358287f},
+    {14, 4092, 0.1155053f},
+    {0, 4091, 0.931889594f},
+    {-1, 0, -0.517331362f},
+    {-1, 0, -0.335272104f},
+    {14, 4094, 0.144461498f},
+    {-1, 0, -0.51590848f},
+    {-1, 0, -0.627481461f},
+    {28, 4099, 0.985449076f},
+    {4, 4098, 0.101230003f},
+    {-1, 0, -0.362925351f},
+    {-1, 0, -0.606961489f},
+    {0, 4101, 0.962941766f},
+    {-1, 0, -0.677717865f},
+    {-1, 0, -0.54877907f},
+    {42, 4166, 1.29992652f},
+    {5, 4135, 0.127575994f},
+    {34, 4120, 0.205480903f},
+    {8, 4113, 1.03869355f},
+    {33, 4110, 1.02636349f},
+    {3, 4109, 1.01789939f},
+    {-1, 0, -0.0312181059f},
+    {-1, 0, 0.0784034431f},
+    {5, 4112, 0.106348f},
+    {-1, 0, -0.0980186611f},
+    {-1, 0, -0.208020374f},
+    {5, 4117, 0.104287997f},
+    {41, 4116, 1.26484537f},
+    {-1, 0, 0.447744817f},
+    {-1, 0, 0.172659114f},
+    {42, 4119, 1.27033794f},
+    {-1, 0, 0.125404775f},
+    {-1, 0, -0.0539295077f},
+    {5, 4128, 0.08495f},
+    {12, 4125, 1.26136398f},
+    {0, 4124, 0.979638755f},
+    {-1, 0, 0.135579199f},
+    {-1, 0, 0.373499691f},
+    {8, 4127, 1.03389883f},
+    {-1, 0, -0.0922675729f},
+    {-1, 0, 0.103383571f},
+    {41, 4132, 1.28570485f},
+    {30, 4131, 0.985252738f},
+    {-1, 0, -0.273050964f},
+    {-1, 0, -0.125178918f},
+    {25, 4134, 0.101254001f},
+    {-1, 0, -0.397288859f},
+    {-1, 0, -0.613383412f},
+    {42, 4151, 1.27543628f},
+    {44, 4144, 0.206974f},
+    {42, 4141, 1.24771786f},
+    {42, 4140, 1.23313165f},
+    {-1, 0, 0.131406218f},
+    {-1, 0, -0.00052335998f},
+    {24, 4143, 0.173624799f},
+    {-1, 0, -0.0977835879f},
+    {-1, 0, -0.224449366f},
+    {42, 4148, 1.25354946f},
+    {42, 4147, 1.23313165f},
+    {-1, 0, -0.00932354387f},
+    {-1, 0, -0.271253556f},
+    {0, 4150, 0.978485048f},
+    {-1, 0, -0.637110472f},
+    {-1, 0, -0.431513518f},
+    {4, 4159, 0.200259298f},
+    {24, 4156, 0.173624799f},
+    {5, 4155, 0.173940003f},
+    {-1, 0, -0.30290997f},
+    {-1, 0, -0.105107293f},
+    {43, 4158, 1.03028905f},
+    {-1, 0, -0.356834739f},
+    {-1, 0, -0.462680697f},
+    {44, 4163, 0.2243305f},
+    {42, 4162, 1.28547835f},
+    {-1, 0, -0.498544157f},
+    {-1, 0, -0.604198098f},
+    {40, 4165, 0.98630631f},
+    {-1, 0, -0.748248756f},
+    {-1, 0, -0.623894811f},
+    {5, 4194, 0.08495f},
+    {42, 4181, 1.33684874f},
+    {43, 4174, 1.03028905f},
+    {8, 4173, 1.03538048f},
+    {41, 4172, 1.31125546f},
+    {-1, 0, -0.0265654586f},
+    {-1, 0, -0.112868257f},
+    {-1, 0, 0.12954542f},
+    {8, 4178, 1.01632047f},
+    {24, 4177, 0.228628606f},
+    {-1, 0, -0.291371465f},
+    {-1, 0, -0.463067472f},
+    {33, 4180, 1.05882764f},
+    {-1, 0, -0.0926831514f},
+    {-1, 0, -0.257477582f},
+    {43, 4187, 1.06898022f},
+    {34, 4186, 0.230289996f},
+    {33, 4185, 1.0728749f},
+    {-1, 0, -0.232789308f},
+    {-1, 0, -0.429986238f},
+    {-1, 0, -0.61700356f},
+    {30, 4191, 0.988175929f},
+    {43, 4190, 1.09358287f},
+    {-1, 0, -0.680672407f},
+    {-1, 0, -0.79776305f},
+    {48, 4193, 1.02773857f},
+    {-1, 0, -0.532169342f},
+    {-1, 0, -0.443134367f},
+    {14, 4210, 0.186648607f},
+    {43, 4203, 1.06481969f},
+    {5, 4200, 0.104287997f},
+    {43, 4199, 1.04502404f},
+    {-1, 0, -0.0654237866f},
+    {-1, 0, -0.392144382f},
+    {4, 4202, 0.178121403f},
+    {-1, 0, -0.397066295f},
+    {-1, 0, -0.494370908f},
+    {20, 4207, 0.977680326f},
+    {43, 4206, 1.08823359f},
+    {-1, 0, -0.684390187f},
+    {-1, 0, -0.790477812f},
+    {1, 4209, 1.19429874f},
+    {-1, 0, -0.454935342f},
+    {-1, 0, -0.579889953f},
+    {41, 4218, 1.39999998f},
+    {4, 4215, 0.207250193f},
+    {43, 4214, 1.03347719f},
+    {-1, 0, -0.466347009f},
+    {-1, 0, -0.568693638f},
+    {5, 4217, 0.104287997f},
+    {-1, 0, -0.563656569f},
+    {-1, 0, -0.691970229f},
+    {43, 4220, 1.09922838f},
+    {-1, 0, -0.800921261f},
+    {23, 4222, 1.11375833f},
+    {-1, 0, -0.877630413f},
+    {-1, 0, -0.919690609f},
+    {42, 4649, 1.25890422f},
+    {45, 4420, 0.124926001f},
+    {41, 4311, 1.22671735f},
+    {25, 4252, 0.0895320028f},
+    {4, 4239, 0.375998706f},
+    {41, 4234, 1.20334625f},
+    {43, 4233, 0.962236941f},
+    {23, 4232, 0.941051722f},
+    {-1, 0, 0.980027676f},
+    {-1, 0, 0.95928663f},
+    {-1, 0, 0.889367998f},
+    {43, 4236, 0.966921031f},
+    {-1, 0, 0.836118937f},
+    {21, 4238, 1.21672416f},
+    {-1, 0, 0.763294458f},
+    {-1, 0, 0.592066646f},
+    {3, 4243, 0.952573061f},
+    {3, 4242, 0.938625038f},
+    {-1, 0, 0.752769947f},
+    {-1, 0, 0.560046673f},
+    {33, 4245, 0.975023091f},
+    {-1, 0, 0.429400444f},
+    {4, 4249, 0.575153291f},
+    {11, 4248, 1.22873199f},
+    {-1, 0, 0.322186321f},
+    {-1, 0, 0.175329819f},
+    {48, 4251, 1.03569841f},
+    {-1, 0, 0.0525456481f},
+    {-1, 0, -0.0090615144f},
+    {43, 4280, 0.94806385f},
+    {4, 4265, 0.461454749f},
+    {5, 4258, 0.104287997f},
+    {2, 4257, 1.23388731f},
+    {-1, 0, 0.815222561f},
+    {-1, 0, 0.587037206f},
+    {43, 4262, 0.930782914f},
+    {21, 4261, 1.20793748f},
+    {-1, 0, 0.621484458f},
+    {-1, 0, 0.438732088f},
+    {1, 4264, 1.2031368f},
+    {-1, 0, 0.421931982f},
+    {-1, 0, 0.20066914f},
+    {25, 4273, 0.107809998f},
+    {1, 4270, 1.22061956f},
+    {5, 4269, 0.104287997f},
+    {-1, 0, 0.614353597f},
+    {-1, 0, 0.435002446f},
+    {22, 4272, 1.23003054f},
+    {-1, 0, 0.322122604f},
+    {-1, 0, 0.157657817f},
+    {41, 4277, 1.20334625f},
+    {31, 4276, 1.16940844f},
+    {-1, 0, 0.31870693f},
+    {-1, 0, 0.079625994f},
+    {30, 4279, 0.979006946f},
+    {-1, 0, -0.36945194f},
+    {-1, 0, -0.0820489302f},
+    {35, 4296, 0.105605997f},
+    {4, 4289, 0.544686675f},
+    {41, 4286, 1.21245313f},
+    {10, 4285, 0.990114927f},
+    {-1, 0, 0.25027889f},
+    {-1, 0, 0.485252798f},
+    {5, 4288, 0.0940039977f},
+    {-1, 0, 0.303832859f},
+    {-1, 0, 0.0816478133f},
+    {43, 4293, 0.976335227f},
+    {43, 4292, 0.962236941f},
+    {-1, 0, 0.207376406f},
+    {-1, 0, 0.0580121018f},
+    {31, 4295, 1.19213283f},
+    {-1, 0, 0.192897215f},
+    {-1, 0, -0.0737694353f},
+    {4, 4304, 0.309403807f},
+    {11, 4301, 1.21467721f},
+    {42, 4300, 1.20332456f},
+    {-1, 0, 0.403259158f},
+    {-1, 0, 0.240914464f},
+    {43, 4303, 0.971725464f},
+    {-1, 0, 0.139607087f},
+    {-1, 0, -0.0281251948f},
+    {43, 4308, 0.971725464f},
+    {11, 4307, 1.17495418f},
+    {-1, 0, 0.139958516f},
+    {-1, 0, -0.0201843381f},
+    {14, 4310, 0.52029407f},
+    {-1, 0, -0.0917577147f},
+    {-1, 0, -0.39890039f},
+    {5, 4375, 0.111956f},
+    {45, 4344, 0.0999779999f},
+    {14, 4329, 0.545403123f},
+    {43, 4322, 0.980361938f},
+    {25, 4319, 0.0895320028f},
+    {2, 4318, 1.2921983f},
+    {-1, 0, 0.519869208f},
+    {-1, 0, 0.0515222214f},
+    {1, 4321, 1.29253161f},
+    {-1, 0, 0.167057812f},
+    {-1, 0, -0.139134854f},
+    {25, 4326, 0.094283998f},
+    {25, 4325, 0.0789659992f},
+    {-1, 0, 0.184443191f},
+    {-1, 0, 0.0174467582f},
+    {43, 4328, 0.998203158f},
+    {-1, 0, -0.0421290211f},
+    {-1, 0, -0.2243056f},
+    {25, 4337, 0.0789659992f},
+    {41, 4334, 1.2481612f},
+    {0, 4333, 0.993314385f},
+    {-1, 0, 0.0308812503f},
+    {-1, 0, 0.143117905f},
+    {43, 4336, 1.00576568f},
+    {-1, 0, -0.0476504192f},
+    {-1, 0, -0.177448988f},
+    {41, 4341, 1.2407701f},
+    {5, 4340, 0.0908140019f},
+    {-1, 0, -0.0259183273f},
+    {-1, 0, -0.19513391f},
+    {5, 4343, 0.0908140019f},
+    {-1, 0, -0.284452975f},
+    {-1, 0, -0.541163981f},
+    {44, 4360, 0.370875537f},
+    {43, 4353, 0.989343405f},
+    {43, 4350, 0.971725464f},
+    {33, 4349, 0.970540404f},
+    {-1, 0, 0.349326074f},
+    {-1, 0, 0.139469847f},
+    {30, 4352, 0.974204957f},
+    {-1, 0, -0.126864791f},
+    {-1, 0, 0.0342716239f},
+    {8, 4357, 1.02461731f},
+    {15, 4356, 0.104404002f},
+    {-1, 0, -0.164167166f},
+    {-1, 0, -0.350257993f},
+    {41, 4359, 1.2407701f},
+    {-1, 0, -0.0734161958f},
+    {-1, 0, -0.193115637f},
+    {2, 4368, 1.23388731f},
+    {43, 4365, 0.980361938f},
+    {0, 4364, 0.982929111f},
+    {-1, 0, -0.205641344f},
+    {-1, 0, -0.0819274187f},
+    {0, 4367, 0.983975112f},
+    {-1, 0, -0.446941167f},
+    {-1, 0, -0.250672936f},
+    {43, 4372, 0.980361938f},
+    {33, 4371, 0.965614676f},
+    {-1, 0, -0.191446096f},
+    {-1, 0, -0.377714127f},
+    {42, 4374, 1.24771786f},
+    {-1, 0, -0.515990555f},
+    {-1, 0, -0.662230551f},
+    {14, 4397, 0.401879787f},
+    {1, 4388, 1.23403978f},
+    {42, 4383, 1.23313165f},
+    {48, 4382, 1.02015293f},
+    {4, 4381, 0.301314652f},
+    {-1, 0, 0.093622297f},
+    {-1, 0, -0.013439537f},
+    {-1, 0, -0.0777062774f},
+    {8, 4385, 1.02976692f},
+    {-1, 0, -0.249354362f},
+    {42, 4387, 1.24771786f},
+    {-1, 0, -0.069280453f},
+    {-1, 0, -0.182656363f},
+    {43, 4394, 0.993731499f},
+    {4, 4393, 0.328377008f},
+    {35, 4392, 0.113792002f},
+    {-1, 0, -0.267319262f},
+    {-1, 0, -0.102402799f},
+    {-1, 0, -0.480011106f},
+    {0, 4396, 0.978485048f},
+    {-1, 0, -0.668226421f},
+    {-1, 0, -0.476008087f},
+    {1, 4407, 1.22061956f},
+    {4, 4404, 0.519812882f},
+    {44, 4401, 0.419316411f},
+    {-1, 0, -0.231533781f},
+    {10, 4403, 0.997866035f},
+    {-1, 0, -0.550236762f},
+    {-1, 0, -0.35484612f},
+    {8, 4406, 1.06724966f},
+    {-1, 0, -0.72323668f},
+    {-1, 0, -0.611094177f},
+    {5, 4415, 0.116580002f},
+    {43, 4412, 0.980361938f},
+    {41, 4411, 1.2407701f},
+    {-1, 0, -0.404705733f},
+    {-1, 0, -0.5738343f},
+    {1, 4414, 1.24192643f},
+    {-1, 0, -0.631696939f},
+    {-1, 0, -0.770200849f},
+    {43, 4417, 0.952899456f},
+    {-1, 0, -0.614378989f},
+    {43, 4419, 0.989343405f},
+    {-1, 0, -0.812940538f},
+    {-1, 0, -0.89374274f},
+    {4, 4544, 0.461454749f},
+    {42, 4485, 1.21238589f},
+    {34, 4454, 0.344467312f},
+    {42, 4439, 1.17288053f},
+    {20, 4432, 0.978850424f},
+    {40, 4429, 0.974451244f},
+    {48, 4428, 1.03024542f},
+    {-1, 0, 0.267239302f},
+    {-1, 0, 0.0563665628f},
+    {14, 4431, 0.303198308f},
+    {-1, 0, 0.363127351f},
+    {-1, 0, 0.213413239f},
+    {44, 4436, 0.289475411f},
+    {23, 4435, 0.950343907f},
+    {-1, 0, 0.773490667f},
+    {-1, 0, 0.542187393f},
+    {43, 4438, 0.962236941f},
+    {-1, 0, 0.46069923f},
+    {-1, 0, 0.266447842f},
+    {43, 4447, 0.957544267f},
+    {4, 4444, 0.309403807f},
+    {2, 4443, 1.18349862f},
+    {-1, 0, 0.471033335f},
+    {-1, 0, 0.131473482f},
+    {1, 4446, 1.17154479f},
+    {-1, 0, 0.236433759f},
+    {-1, 0, 0.0285943393f},
+    {4, 4451, 0.281207114f},
+    {5, 4450, 0.144385993f},
+    {-1, 0, 0.206930801f},
+    {-1, 0, 0.0248717144f},
+    {20, 4453, 0.969468832f},
+    {-1, 0, -0.190124303f},
+    {-1, 0, -0.0387742743f},
+    {42, 4470, 1.1844964f},
+    {43, 4463, 0.934770525f},
+    {4, 4460, 0.362586498f},
+    {30, 4459, 0.987191975f},
+    {-1, 0, 0.264852345f},
+    {-1, 0, 0.678471088f},
+    {5, 4462, 0.171509996f},
+    {-1, 0, 0.0922889635f},
+    {-1, 0, -0.0427629314f},
+    {5, 4467, 0.171509996f},
+    {4, 4466, 0.375998706f},
+    {-1, 0, 0.0722204074f},
+    {-1, 0, -0.0474421158f},
+    {4, 4469, 0.431926012f},
+    {-1, 0, -0.146997049f},
+    {-1, 0, -0.425189495f},
+    {5, 4478, 0.151035994f},
+    {4, 4475, 0.412739813f},
+    {43, 4474, 0.94806385f},
+    {-1, 0, -0.0148000494f},
+    {-1, 0, -0.148588985f},
+    {1, 4477, 1.19429874f},
+    {-1, 0, -0.269859582f},
+    {-1, 0, -0.561067343f},
+    {43, 4482, 0.943503678f},
+    {4, 4481, 0.39912051f},
+    {-1, 0, -0.126286417f},
+    {-1, 0, -0.247500315f},
+    {4, 4484, 0.386916608f},
+    {-1, 0, -0.373737365f},
+    {-1, 0, -0.620441437f},
+    {24, 4515, 0.323161215f},
+    {43, 4502, 0.989343405f},
+    {35, 4495, 0.137188002f},
+    {43, 4492, 0.952899456f},
+    {31, 4491, 1.23171103f},
+    {-1, 0, 0.230565369f},
+    {-1, 0, 0.13300243f},
+    {43, 4494, 0.976335227f},
+    {-1, 0, 0.0479365513f},
+    {-1, 0, -0.037320774f},
+    {42, 4499, 1.23313165f},
+    {43, 4498, 0.957544267f},
+    {-1, 0, 0.00754352706f},
+    {-1, 0, -0.134482026f},
+    {40, 4501, 0.973080456f},
+    {-1, 0, -0.453284353f},
+    {-1, 0, -0.194238067f},
+    {2, 4510, 1.23388731f},
+    {5, 4507, 0.136225998f},
+    {43, 4506, 1.0092051f},
+    {-1, 0, -0.120350882f},
+    {-1, 0, -0.248346269f},
+    {13, 4509, 1.04388428f},
+    {-1, 0, -0.316760004f},
+    {-1, 0, -0.52334553f},
+    {0, 4514, 0.987992644f},
+    {10, 4513, 0.969136357f},
+    {-1, 0, -0.765220582f},
+    {-1, 0, -0.638334811f},
+    {-1, 0, -0.485032856f},
+    {1, 4531, 1.21254396f},
+    {44, 4524, 0.406275392f},
+    {43, 4521, 0.962236941f},
+    {43, 4520, 0.943503678f},
+    {-1, 0, -0.0774059594f},
+    {-1, 0, -0.289576203f},
+    {5, 4523, 0.148019999f},
+    {-1, 0, -0.355122596f},
+    {-1, 0, -0.530423582f},
+    {5, 4528, 0.163269997f},
+    {32, 4527, 1.2101351f},
+    {-1, 0, -0.528704405f},
+    {-1, 0, -0.630132616f},
+    {2, 4530, 1.14605081f},
+    {-1, 0, -0.767614841f},
+    {-1, 0, -0.840148926f},
+    {43, 4537, 0.962236941f},
+    {4, 4534, 0.338903695f},
+    {-1, 0, -0.2002635f},
+    {14, 4536, 0.364304006f},
+    {-1, 0, -0.520257175f},
+    {-1, 0, -0.65335983f},
+    {4, 4541, 0.350952208f},
+    {1, 4540, 1.23403978f},
+    {-1, 0, -0.615354657f},
+    {-1, 0, -0.750334501f},
+    {42, 4543, 1.22657466f},
+    {-1, 0, -0.697806656f},
+    {-1, 0, -0.815901756f},
+    {42, 4594, 1.17288053f},
+    {5, 4573, 0.163269997f},
+    {43, 4560, 0.939059615f},
+    {5, 4555, 0.133103997f},
+    {43, 4552, 0.930782914f},
+    {20, 4551, 0.994509339f},
+    {-1, 0, 0.0343081839f},
+    {-1, 0, 0.149182558f},
+    {0, 4554, 0.982929111f},
+    {-1, 0, -0.164416745f},
+    {-1, 0, -0.00706249662f},
+    {10, 4557, 0.981980264f},
+    {-1, 0, -0.46770677f},
+    {4, 4559, 0.519812882f},
+    {-1, 0, -0.0433567427f},
+    {-1, 0, -0.188636795f},
+    {5, 4566, 0.136225998f},
+    {0, 4563, 0.978485048f},
+    {-1, 0, -0.442697525f},
+    {5, 4565, 0.127575994f},
+    {-1, 0, -0.0546527542f},
+    {-1, 0, -0.206732959f},
+    {4, 4570, 0.510396779f},
+    {30, 4569, 0.996765435f},
+    {-1, 0, -0.399539143f},
+    {-1, 0, -0.174918696f},
+    {0, 4572, 0.993314385f},
+    {-1, 0, -0.645470858f},
+    {-1, 0, -0.468971282f},
+    {43, 4581, 0.923699558f},
+    {4, 4576, 0.487102389f},
+    {-1, 0, -0.085851334f},
+    {43, 4578, 0.89905709f},
+    {-1, 0, -0.150871724f},
+    {34, 4580, 0.521979213f},
+    {-1, 0, -0.268107831f},
+    {-1, 0, -0.361883253f},
+    {2, 4589, 1.14605081f},
+    {24, 4586, 0.511820793f},
+    {33, 4585, 0.965614676f},
+    {-1, 0, -0.255310029f},
+    {-1, 0, -0.474870473f},
+    {33, 4588, 0.946895599f},
+    {-1, 0, -0.419494957f},
+    {-1, 0, -0.608673453f},
+    {5, 4591, 0.171509996f},
+    {-1, 0, -0.573431969f},
+    {4, 4593, 0.510396779f},
+    {-1, 0, -0.694395602f},
+    {-1, 0, -0.82334286f},
+    {32, 4624, 1.1921587f},
+    {5, 4609, 0.136225998f},
+    {43, 4602, 0.94806385f},
+    {8, 4599, 1.01925993f},
+    {-1, 0, -0.303950727f},
+    {43, 4601, 0.943503678f},
+    {-1, 0, -0.108706437f},
+    {-1, 0, -0.220887437f},
+    {0, 4606, 0.992193222f},
+    {43, 4605, 0.966921031f},
+    {-1, 0, -0.481450796f},
+    {-1, 0, -0.65476644f},
+    {43, 4608, 0.962236941f},
+    {-1, 0, -0.25766331f},
+    {-1, 0, -0.455658197f},
+    {43, 4617, 0.923699558f},
+    {45, 4614, 0.154042006f},
+    {33, 4613, 0.91949594f},
+    {-1, 0, 0.0221522208f},
+    {-1, 0, -0.162000924f},
+    {42, 4616, 1.1844964f},
+    {-1, 0, -0.302243292f},
+    {-1, 0, -0.430499375f},
+    {2, 4621, 1.17161393f},
+    {43, 4620, 0.939059615f},
+    {-1, 0, -0.455713809f},
+    {-1, 0, -0.663648963f},
+    {5, 4623, 0.173940003f},
+    {-1, 0, -0.720430195f},
+    {-1, 0, -0.84825784f},
+    {1, 4640, 1.2031368f},
+    {25, 4633, 0.144408002f},
+    {43, 4630, 0.94806385f},
+    {30, 4629, 0.996765435f},
+    {-1, 0, -0.56324935f},
+    {-1, 0, -0.435625494f},
+    {4, 4632, 0.595098972f},
+    {-1, 0, -0.664039135f},
+    {-1, 0, -0.788127124f},
+    {1, 4637, 1.18345451f},
+    {33, 4636, 0.933643222f},
+    {-1, 0, -0.61370635f},
+    {-1, 0, -0.766990185f},
+    {4, 4639, 0.487102389f},
+    {-1, 0, -0.798134506f},
+    {-1, 0, -0.881375968f},
+    {43, 4642, 0.939059615f},
+    {-1, 0, -0.605492771f},
+    {45, 4646, 0.149488002f},
+    {41, 4645, 1.22035789f},
+    {-1, 0, -0.824006438f},
+    {-1, 0, -0.901460409f},
+    {4, 4648, 0.558590889f},
+    {-1, 0, -0.949479342f},
+    {-1, 0, -0.993540823f},
+    {35, 4829, 0.0863339975f},
+    {41, 4746, 1.28570485f},
+    {4, 4693, 0.412739813f},
+    {48, 4664, 1.01446116f},
+    {43, 4655, 0.984821081f},
+    {-1, 0, 0.452828854f},
+    {25, 4663, 0.0837839991f},
+    {43, 4660, 0.998203158f},
+    {4, 4659, 0.32010591f},
+    {-1, 0, 0.333304286f},
+    {-1, 0, 0.115425594f},
+    {8, 4662, 1.02717817f},
+    {-1, 0, 0.0601449125f},
+    {-1, 0, 0.152071521f},
+    {-1, 0, -0.0335120708f},
+    {15, 4678, 0.0782440007f},
+    {43, 4673, 1.02361953f},
+    {8, 4670, 1.03245306f},
+    {43, 4669, 1.01283598f},
+    {-1, 0, 0.0954380333f},
+    {-1, 0, -0.000545851712f},
+    {43, 4672, 1.01283598f},
+    {-1, 0, 0.231923312f},
+    {-1, 0, 0.0997026414f},
+    {8, 4677, 1.05376005f},
+    {30, 4676, 0.979006946f},
+    {-1, 0, -0.202607483f},
+    {-1, 0, -0.0730191171f},
+    {-1, 0, 0.207512826f},
+    {11, 4686, 1.2560631f},
+    {41, 4683, 1.26484537f},
+    {28, 4682, 1.04929233f},
+    {-1, 0, -0.0209545977f},
+    {-1, 0, 0.132738099f},
+    {43, 4685, 1.02001345f},
+    {-1, 0, -0.0228602421f},
+    {-1, 0, -0.198718414f},
+    {43, 4690, 1.02361953f},
+    {0, 4689, 0.977297843f},
+    {-1, 0, -0.266526312f},
+    {-1, 0, -0.10941872f},
+    {0, 4692, 0.982929111f},
+    {-1, 0, -0.369613737f},
+    {-1, 0, -0.272100151f},
+    {2, 4723, 1.27185786f},
+    {43, 4708, 1.00576568f},
+    {4, 4703, 0.531412601f},
+    {5, 4700, 0.0818039998f},
+    {43, 4699, 0.998203158f},
+    {-1, 0, 0.157089084f},
+    {-1, 0, 0.0319090858f},
+    {0, 4702, 0.979638755f},
+    {-1, 0, -0.225765571f},
+    {-1, 0, -0.064028725f},
+    {2, 4705, 1.25471163f},
+    {-1, 0, -0.115605973f},
+    {10, 4707, 0.986079931f},
+    {-1, 0, -0.256224632f},
+    {-1, 0, -0.171388879f},
+    {35, 4716, 0.0808219984f},
+    {4, 4713, 0.544686675f},
+    {2, 4712, 1.24880528f},
+    {-1, 0, 0.0731579289f},
+    {-1, 0, -0.169959366f},
+    {2, 4715, 1.25471163f},
+    {-1, 0, -0.229634747f},
+    {-1, 0, -0.353625596f},
+    {1, 4720, 1.24924493f},
+    {44, 4719, 0.492177188f},
+    {-1, 0, -0.0842869878f},
+    {-1, 0, -0.348601252f},
+    {0, 4722, 0.986992121f},
+    {-1, 0, -0.45686242f},
+    {-1, 0, -0.352053791f},
+    {43, 4733, 1.02001345f},
+    {42, 4728, 1.27033794f},
+    {28, 4727, 1.01540959f},
+    {-1, 0, -0.410703242f},
+    {-1, 0, -0.237995401f},
+    {0, 4732, 0.992193222f},
+    {43, 4731, 1.01283598f},
+    {-1, 0, -0.474878341f},
+    {-1, 0, -0.536108971f},
+    {-1, 0, -0.41184327f},
+    {43, 4741, 1.03347719f},
+    {12, 4738, 1.27780342f},
+    {44, 4737, 0.453830808f},
+    {-1, 0, -0.468513757f},
+    {-1, 0, -0.540011704f},
+    {0, 4740, 0.986992121f},
+    {-1, 0, -0.613769293f},
+    {-1, 0, -0.556087792f},
+    {2, 4743, 1.27698696f},
+    {-1, 0, -0.592930913f},
+    {2, 4745, 1.28713977f},
+    {-1, 0, -0.651414931f},
+    {-1, 0, -0.690834045f},
+    {4, 4784, 0.362586498f},
+    {41, 4763, 1.29554284f},
+    {4, 4760, 0.32010591f},
+    {43, 4753, 1.01679003f},
+    {33, 4752, 1.0161401f},
+    {-1, 0, 0.185984895f},
+    {-1, 0, 0.00527533423f},
+    {30, 4757, 0.985252738f},
+    {48, 4756, 1.02144539f},
+    {-1, 0, -0.151768997f},
+    {-1, 0, -0.273946822f},
+    {43, 4759, 1.03028905f},
+    {-1, 0, 0.00617521023f},
+    {-1, 0, -0.105941616f},
+    {8, 4762, 1.03245306f},
+    {-1, 0, -0.356222868f},
+    {-1, 0, -0.170773804f},
+    {43, 4771, 1.0268327f},
+    {4, 4766, 0.309403807f},
+    {-1, 0, -0.131039262f},
+    {0, 4770, 0.977297843f},
+    {43, 4769, 1.02001345f},
+    {-1, 0, -0.427730501f},
+    {-1, 0, -0.500502348f},
+    {-1, 0, -0.316486448f},
+    {30, 4777, 0.985252738f},
+    {43, 4776, 1.04502404f},
+    {0, 4775, 0.973408639f},
+    {-1, 0, -0.58192122f},
+    {-1, 0, -0.505159497f},
+    {-1, 0, -0.668862224f},
+    {43, 4781, 1.04502404f},
+    {11, 4780, 1.29816902f},
+    {-1, 0, -0.206864506f},
+    {-1, 0, -0.386120588f},
+    {31, 4783, 1.29940259f},
+    {-1, 0, -0.428237766f},
+    {-1, 0, -0.583859384f},
+    {1, 4798, 1.27741158f},
+    {43, 4787, 1.01679003f},
+    {-1, 0, -0.347844779f},
+    {2, 4793, 1.24169278f},
+    {33, 4790, 1.05425978f},
+    {-1, 0, -0.346207142f},
+    {12, 4792, 1.24334729f},
+    {-1, 0, -0.459841698f},
+    {-1, 0, -0.573459148f},
+    {43, 4797, 1.04105961f},
+    {0, 4796, 0.99445498f},
+    {-1, 0, -0.58069998f},
+    {-1, 0, -0.488972008f},
+    {-1, 0, -0.690964401f},
+    {42, 4814, 1.29992652f},
+    {43, 4807, 1.02001345f},
+    {0, 4804, 0.977297843f},
+    {4, 4803, 0.487102389f},
+    {-1, 0, -0.545941651f},
+    {-1, 0, -0.660894513f},
+    {43, 4806, 1.01283598f},
+    {-1, 0, -0.427768469f},
+    {-1, 0, -0.535368741f},
+    {4, 4811, 0.499599695f},
+    {43, 4810, 1.03028905f},
+    {-1, 0, -0.596544325f},
+    {-1, 0, -0.667501569f},
+    {5, 4813, 0.0818039998f},
+    {-1, 0, -0.677713871f},
+    {-1, 0, -0.746247113f},
+    {4, 4822, 0.487102389f},
+    {43, 4819, 1.03028905f},
+    {0, 4818, 0.977297843f},
+    {-1, 0, -0.679171324f},
+    {-1, 0, -0.57648766f},
+    {11, 4821, 1.30915761f},
+    {-1, 0, -0.71276325f},
+    {-1, 0, -0.799134791f},
+    {41, 4826, 1.30553532f},
+    {18, 4825, 1.02087224f},
+    {-1, 0, -0.788505673f},
+    {-1, 0, -0.740365267f},
+    {41, 4828, 1.31125546f},
+    {-1, 0, -0.809275806f},
+    {-1, 0, -0.841849625f},
+    {1, 4899, 1.25511467f},
+    {5, 4864, 0.109949999f},
+    {44, 4851, 0.406275392f},
+    {43, 4842, 1.00576568f},
+    {5, 4839, 0.0986139998f},
+    {34, 4838, 0.324240088f},
+    {0, 4837, 0.983975112f},
+    {-1, 0, 0.00552526722f},
+    {-1, 0, 0.0681572184f},
+    {-1, 0, -0.153720081f},
+    {2, 4841, 1.24169278f},
+    {-1, 0, -0.143198326f},
+    {-1, 0, -0.371098071f},
+    {31, 4846, 1.25290132f},
+    {41, 4845, 1.26484537f},
+    {-1, 0, -0.21322155f},
+    {-1, 0, -0.386340022f},
+    {15, 4848, 0.0917880014f},
+    {-1, 0, -0.339752316f},
+    {43, 4850, 1.01283598f},
+    {-1, 0, -0.396808833f},
+    {-1, 0, -0.52097553f},
+    {31, 4853, 1.2391299f},
+    {-1, 0, -0.345262796f},
+    {35, 4861, 0.101549998f},
+    {43, 4858, 1.00576568f},
+    {4, 4857, 0.544686675f},
+    {-1, 0, -0.380175829f},
+    {-1, 0, -0.517381191f},
+    {2, 4860, 1.22706056f},
+    {-1, 0, -0.505474508f},
+    {-1, 0, -0.60835737f},
+    {8, 4863, 1.04917681f},
+    {-1, 0, -0.748760104f},
+    {-1, 0, -0.54702878f},
+    {5, 4890, 0.183211997f},
+    {1, 4881, 1.24192643f},
+    {4, 4874, 0.412739813f},
+    {3, 4871, 1.02126205f},
+    {14, 4870, 0.311086804f},
+    {-1, 0, -0.300403178f},
+    {-1, 0, -0.480316937f},
+    {33, 4873, 1.00121045f},
+    {-1, 0, -0.516190827f},
+    {-1, 0, -0.630192995f},
+    {35, 4878, 0.121069998f},
+    {42, 4877, 1.27033794f},
+    {-1, 0, -0.586545825f},
+    {-1, 0, -0.651431799f},
+    {4, 4880, 0.510396779f},
+    {-1, 0, -0.691906631f},
+    {-1, 0, -0.793161333f},
+    {14, 4885, 0.311086804f},
+    {33, 4884, 1.005018f},
+    {-1, 0, -0.495771259f},
+    {-1, 0, -0.694732487f},
+    {4, 4889, 0.461454749f},
+    {0, 4888, 0.989027202f},
+    {-1, 0, -0.848663747f},
+    {-1, 0, -0.717707574f},
+    {-1, 0, -0.95226872f},
+    {4, 4898, 0.386916608f},
+    {33, 4893, 1.00121045f},
+    {-1, 0, -0.669795454f},
+    {14, 4897, 0.340759307f},
+    {23, 4896, 1.07271385f},
+    {-1, 0, -0.732927978f},
+    {-1, 0, -0.841019392f},
+    {-1, 0, -0.843896687f},
+    {-1, 0, -0.903203011f},
+    {15, 4937, 0.0941419974f},
+    {41, 4914, 1.28075159f},
+    {4, 4911, 0.375998706f},
+    {43, 4904, 0.993731499f},
+    {-1, 0, 0.0248220079f},
+    {0, 4908, 0.976062536f},
+    {33, 4907, 1.00856853f},
+    {-1, 0, -0.384937406f},
+    {-1, 0, -0.567688823f},
+    {43, 4910, 1.02001345f},
+    {-1, 0, -0.226495996f},
+    {-1, 0, -0.385751188f},
+    {43, 4913, 1.00576568f},
+    {-1, 0, -0.510890305f},
+    {-1, 0, -0.727128565f},
+    {43, 4924, 1.01283598f},
+    {43, 4919, 1.00191236f},
+    {4, 4918, 0.362586498f},
+    {-1, 0, -0.3442882f},
+    {-1, 0, -0.538868964f},
+    {0, 4923, 0.980734169f},
+    {4, 4922, 0.362586498f},
+    {-1, 0, -0.608236611f},
+    {-1, 0, -0.702614546f},
+    {-1, 0, -0.501508892f},
+    {0, 4932, 0.987992644f},
+    {4, 4929, 0.362586498f},
+    {42, 4928, 1.29510391f},
+    {-1, 0, -0.616886556f},
+    {-1, 0, -0.754000723f},
+    {43, 4931, 1.0268327f},
+    {-1, 0, -0.788717985f},
+    {-1, 0, -0.837249815f},
+    {43, 4934, 1.0268327f},
+    {-1, 0, -0.50767076f},
+    {42, 4936, 1.29510391f},
+    {-1, 0, -0.610484421f},
+    {-1, 0, -0.718626738f},
+    {43, 4957, 0.993731499f},
+    {5, 4950, 0.116580002f},
+    {0, 4945, 0.978485048f},
+    {4, 4942, 0.301314652f},
+    {-1, 0, -0.51878655f},
+    {4, 4944, 0.39912051f},
+    {-1, 0, -0.669373751f},
+    {-1, 0, -0.799529672f},
+    {4, 4947, 0.375998706f},
+    {-1, 0, -0.300275207f},
+    {45, 4949, 0.0999779999f},
+    {-1, 0, -0.464013189f},
+    {-1, 0, -0.574490607f},
+    {4, 4952, 0.338903695f},
+    {-1, 0, -0.747211754f},
+    {4, 4956, 0.431926012f},
+    {5, 4955, 0.133103997f},
+    {-1, 0, -0.853725135f},
+    {-1, 0, -0.90978986f},
+    {-1, 0, -0.939706802f},
+    {4, 4971, 0.32010591f},
+    {10, 4966, 0.994499147f},
+    {35, 4963, 0.113792002f},
+    {42, 4962, 1.2901274f},
+    {-1, 0, -0.71075505f},
+    {-1, 0, -0.802202165f},
+    {12, 4965, 1.26717949f},
+    {-1, 0, -0.764418125f},
+    {-1, 0, -0.853415489f},
+    {43, 4970, 1.02001345f},
+    {0, 4969, 0.997847199f},
+    {-1, 0, -0.625567377f},
+    {-1, 0, -0.492476314f},
+    {-1, 0, -0.728892744f},
+    {5, 4979, 0.109949999f},
+    {1, 4976, 1.27213871f},
+    {48, 4975, 1.00271976f},
+    {-1, 0, -0.604041576f},
+    {-1, 0, -0.768832326f},
+    {42, 4978, 1.29510391f},
+    {-1, 0, -0.843621254f},
+    {-1, 0, -0.887537003f},
+    {4, 4983, 0.461454749f},
+    {41, 4982, 1.27054095f},
+    {-1, 0, -0.882507145f},
+    {-1, 0, -0.924570143f},
+    {41, 4985, 1.27054095f},
+    {-1, 0, -0.953951895f},
+    {-1, 0, -0.969151258f},
+    {23, 5020, 1.06405568f},
+    {23, 4993, 1.03633714f},
+    {4, 4992, 0.0701334029f},
+    {8, 4991, 1.01925993f},
+    {-1, 0, 0.71139133f},
+    {-1, 0, 0.8216452f},
+    {-1, 0, 0.565580726f},
+    {0, 4997, 0.931889594f},
+    {20, 4996, 0.92770344f},
+    {-1, 0, 0.00048196892f},
+    {-1, 0, -0.35628888f},
+    {41, 5009, 1.38900673f},
+    {40, 5008, 0.991291523f},
+    {22, 5001, 1.42489457f},
+    {-1, 0, 0.186928988f},
+    {22, 5005, 1.44420481f},
+    {41, 5004, 1.33048368f},
+    {-1, 0, 0.399369538f},
+    {-1, 0, 0.309704691f},
+    {23, 5007, 1.05831933f},
+    {-1, 0, 0.50343591f},
+    {-1, 0, 0.399135411f},
+    {-1, 0, 0.560394049f},
+    {20, 5017, 0.937120914f},
+    {10, 5016, 0.967439651f},
+    {30, 5013, 0.891042471f},
+    {-1, 0, 0.375934988f},
+    {15, 5015, 0.033507999f},
+    {-1, 0, 0.306693912f},
+    {-1, 0, 0.217615798f},
+    {-1, 0, 0.139094815f},
+    {0, 5019, 0.967017829f},
+    {-1, 0, -0.0988968387f},
+    {-1, 0, 0.125756204f},
+    {41, 5188, 1.42646396f},
+    {11, 5027, 1.14978588f},
+    {41, 5024, 1.22035789f},
+    {-1, 0, 0.626830816f},
+    {11, 5026, 1.13417459f},
+    {-1, 0, 0.315784246f},
+    {-1, 0, 0.0721365139f},
+    {3, 5131, 1.13844168f},
+    {13, 5058, 1.05794728f},
+    {15, 5033, 0.0365119986f},
+    {0, 5032, 0.991121888f},
+    {-1, 0, -0.0645170733f},
+    {-1, 0, 0.233100832f},
+    {28, 5037, 0.955184042f},
+    {41, 5036, 1.3794868f},
+    {-1, 0, 0.16158089f},
+    {-1, 0, 0.0167665053f},
+    {41, 5047, 1.34398496f},
+    {24, 5042, 0.0828206986f},
+    {0, 5041, 0.993314385f},
+    {-1, 0, -0.0862789154f},
+    {-1, 0, 0.0714308321f},
+    {13, 5044, 1.0398066f},
+    {-1, 0, -0.0408403277f},
+    {23, 5046, 1.07779157f},
+    {-1, 0, -0.145827964f},
+    {-1, 0, -0.227317557f},
+    {5, 5053, 0.0650639981f},
+    {23, 5052, 1.09301412f},
+    {3, 5051, 1.01789939f},
+    {-1, 0, 0.00789626967f},
+    {-1, 0, -0.221683547f},
+    {-1, 0, -0.376031518f},
+    {28, 5055, 0.994894624f},
+    {-1, 0, -0.30287239f},
+    {13, 5057, 1.0398066f},
+    {-1, 0, -0.428092957f},
+    {-1, 0, -0.562418401f},
+    {33, 5086, 1.12451184f},
+    {30, 5075, 0.983253896f},
+    {3, 5072, 1.0923568f},
+    {23, 5067, 1.09874821f},
+    {5, 5066, 0.0558159985f},
+    {5, 5065, 0.0301660001f},
+    {-1, 0, -0.270036727f},
+    {-1, 0, -0.377896875f},
+    {-1, 0, -0.541781843f},
+    {4, 5069, 0.113779202f},
+    {-1, 0, -0.139212117f},
+    {0, 5071, 0.965028226f},
+    {-1, 0, -0.30338943f},
+    {-1, 0, -0.236439526f},
+    {1, 5074, 1.42496049f},
+    {-1, 0, -0.413034707f},
+    {-1, 0, -0.635942042f},
+    {1, 5077, 1.30845773f},
+    {-1, 0, -0.0223187059f},
+    {33, 5079, 1.10635662f},
+    {-1, 0, -0.114890181f},
+    {41, 5083, 1.39999998f},
+    {25, 5082, 0.0250979997f},
+    {-1, 0, -0.113091983f},
+    {-1, 0, -0.248528942f},
+    {18, 5085, 1.04580438f},
+    {-1, 0, -0.245635584f},
+    {-1, 0, -0.318497121f},
+    {25, 5108, 0.0314819999f},
+    {13, 5093, 1.08739161f},
+    {8, 5090, 1.01632047f},
+    {-1, 0, -0.262526304f},
+    {4, 5092, 0.350952208f},
+    {-1, 0, 0.0316912457f},
+    {-1, 0, -0.161682397f},
+    {3, 5101, 1.09785402f},
+    {41, 5098, 1.41196477f},
+    {30, 5097, 0.977863729f},
+    {-1, 0, -0.333446443f},
+    {-1, 0, -0.259074628f},
+    {38, 5100, 1.02511704f},
+    {-1, 0, -0.317523628f},
+    {-1, 0, -0.415898263f},
+    {30, 5105, 0.983253896f},
+    {20, 5104, 0.976509631f},
+    {-1, 0, -0.463679999f},
+    {-1, 0, -0.590953588f},
+    {1, 5107, 1.42496049f},
+    {-1, 0, -0.363096654f},
+    {-1, 0, -0.422379047f},
+    {5, 5122, 0.144385993f},
+    {0, 5115, 0.965028226f},
+    {13, 5112, 1.07234466f},
+    {-1, 0, -0.585824966f},
+    {5, 5114, 0.0435740016f},
+    {-1, 0, -0.641887665f},
+    {-1, 0, -0.764523089f},
+    {35, 5119, 0.0566219985f},
+    {23, 5118, 1.09874821f},
+    {-1, 0, -0.344012797f},
+    {-1, 0, -0.463553846f},
+    {41, 5121, 1.33048368f},
+    {-1, 0, -0.331307232f},
+    {-1, 0, -0.641212046f},
+    {13, 5128, 1.12411284f},
+    {12, 5125, 1.16265464f},
+    {-1, 0, -0.115062691f},
+    {4, 5127, 0.0797913f},
+    {-1, 0, -0.22918728f},
+    {-1, 0, -0.36741212f},
+    {3, 5130, 1.10585618f},
+    {-1, 0, -0.360298872f},
+    {-1, 0, -0.496178091f},
+    {20, 5159, 0.965969622f},
+    {30, 5134, 0.891042471f},
+    {-1, 0, 0.454430372f},
+    {33, 5144, 1.11390412f},
+    {28, 5141, 1.01034236f},
+    {20, 5138, 0.949032426f},
+    {-1, 0, 0.076091364f},
+    {0, 5140, 0.962941766f},
+    {-1, 0, -0.157821402f},
+    {-1, 0, -0.0189965814f},
+    {18, 5143, 0.983655751f},
+    {-1, 0, 0.370094806f},
+    {-1, 0, 0.160425812f},
+    {41, 5152, 1.41196477f},
+    {31, 5151, 1.4115808f},
+    {25, 5150, 0.0340000018f},
+    {0, 5149, 0.980734169f},
+    {-1, 0, -0.0711465776f},
+    {-1, 0, 0.0569530353f},
+    {-1, 0, -0.233697787f},
+    {-1, 0, 0.104472391f},
+    {0, 5156, 0.971916854f},
+    {22, 5155, 1.42489457f},
+    {-1, 0, -0.152299449f},
+    {-1, 0, -0.371356368f},
+    {20, 5158, 0.95636487f},
+    {-1, 0, 0.00113582169f},
+    {-1, 0, -0.157835186f},
+    {11, 5185, 1.47617376f},
+    {5, 5182, 0.0558159985f},
+    {30, 5177, 0.986227155f},
+    {35, 5170, 0.029716f},
+    {0, 5167, 0.984983087f},
+    {41, 5166, 1.39999998f},
+    {-1, 0, -0.1533508f},
+    {-1, 0, -0.29830417f},
+    {34, 5169, 0.324240088f},
+    {-1, 0, -0.0350289121f},
+    {-1, 0, -0.181504726f},
+    {42, 5174, 1.39885306f},
+    {32, 5173, 1.4113332f},
+    {-1, 0, -0.306236416f},
+    {-1, 0, -0.22573638f},
+    {38, 5176, 1.01413274f},
+    {-1, 0, -0.315885514f},
+    {-1, 0, -0.421657175f},
+    {4, 5179, 0.232080907f},
+    {-1, 0, 0.22205849f},
+    {48, 5181, 1.04950464f},
+    {-1, 0, -0.193104878f},
+    {-1, 0, 0.0210664738f},
+    {45, 5184, 0.183740005f},
+    {-1, 0, -0.475544751f},
+    {-1, 0, -0.565384984f},
+    {41, 5187, 1.38900673f},
+    {-1, 0, 0.336742699f},
+    {-1, 0, -0.0620286278f},
+    {35, 5332, 0.0381140001f},
+    {13, 5255, 1.12411284f},
+    {3, 5216, 1.13844168f},
+    {14, 5199, 0.136176005f},
+    {34, 5196, 0.105959699f},
+    {22, 5195, 1.44420481f},
+    {-1, 0, -0.475951046f},
+    {-1, 0, -0.283919424f},
+    {13, 5198, 1.05794728f},
+    {-1, 0, -0.573103309f},
+    {-1, 0, -0.777156234f},
+    {4, 5215, 0.39912051f},
+    {38, 5206, 1.00456011f},
+    {13, 5203, 1.11367428f},
+    {-1, 0, -0.162096888f},
+    {1, 5205, 1.41040313f},
+    {-1, 0, -0.217919737f},
+    {-1, 0, -0.375063092f},
+    {13, 5208, 1.06358767f},
+    {-1, 0, -0.255686253f},
+    {2, 5212, 1.3973012f},
+    {43, 5211, 1.16149867f},
+    {-1, 0, -0.2704449f},
+    {-1, 0, -0.453726768f},
+    {11, 5214, 1.41069651f},
+    {-1, 0, -0.497799665f},
+    {-1, 0, -0.400602102f},
+    {-1, 0, -0.621267021f},
+    {43, 5242, 1.16149867f},
+    {13, 5227, 1.10606813f},
+    {0, 5226, 0.985987306f},
+    {41, 5223, 1.47723091f},
+    {48, 5222, 1.0111258f},
+    {-1, 0, 0.0432120748f},
+    {-1, 0, 0.176317334f},
+    {12, 5225, 1.44375479f},
+    {-1, 0, -0.11178048f},
+    {-1, 0, -0.0310587399f},
+    {-1, 0, 0.189183384f},
+    {33, 5229, 1.11390412f},
+    {-1, 0, 0.0667804778f},
+    {10, 5237, 0.975037158f},
+    {30, 5234, 0.959955215f},
+    {0, 5233, 0.950959086f},
+    {-1, 0, -0.275790811f},
+    {-1, 0, -0.207236424f},
+    {13, 5236, 1.11367428f},
+    {-1, 0, -0.0349796154f},
+    {-1, 0, -0.143381819f},
+    {2, 5239, 1.41017509f},
+    {-1, 0, -0.192643791f},
+    {10, 5241, 0.983047485f},
+    {-1, 0, -0.308634251f},
+    {-1, 0, -0.391534805f},
+    {20, 5246, 0.871244848f},
+    {40, 5245, 0.903201103f},
+    {-1, 0, -0.328915447f},
+    {-1, 0, -0.0175151099f},
+    {0, 5248, 0.931889594f},
+    {-1, 0, -0.641525388f},
+    {30, 5252, 0.939255536f},
+    {20, 5251, 0.92770344f},
+    {-1, 0, -0.134453923f},
+    {-1, 0, -0.273320347f},
+    {10, 5254, 0.970711291f},
+    {-1, 0, -0.465253055f},
+    {-1, 0, -0.289181858f},
+    {33, 5285, 1.13908994f},
+    {33, 5258, 1.11390412f},
+    {-1, 0, -0.152211681f},
+    {19, 5284, 0.0f},
+    {15, 5273, 0.0263260007f},
+    {30, 5268, 0.975476205f},
+    {0, 5265, 0.957801342f},
+    {23, 5264, 1.09874821f},
+    {-1, 0, -0.456126511f},
+    {-1, 0, -0.581446648f},
+    {11, 5267, 1.44429564f},
+    {-1, 0, -0.435475945f},
+    {-1, 0, -0.247429326f},
+    {8, 5272, 1.01135957f},
+    {48, 5271, 1.03284669f},
+    {-1, 0, -0.426191539f},
+    {-1, 0, -0.350445718f},
+    {-1, 0, -0.261638224f},
+    {45, 5281, 0.0362179987f},
+    {0, 5278, 0.970383525f},
+    {20, 5277, 0.972529054f},
+    {-1, 0, -0.561218202f},
+    {-1, 0, -0.641235232f},
+    {18, 5280, 1.02608585f},
+    {-1, 0, -0.43394056f},
+    {-1, 0, -0.571435869f},
+    {38, 5283, 1.01250184f},
+    {-1, 0, -0.367298901f},
+    {-1, 0, -0.361064434f},
+    {-1, 0, -0.193272829f},
+    {8, 5325, 1.04917681f},
+    {25, 5308, 0.0250979997f},
+    {8, 5301, 1.01480412f},
+    {42, 5296, 1.47489381f},
+    {4, 5293, 0.272093087f},
+    {8, 5292, 0.987664461f},
+    {-1, 0, -0.588630319f},
+    {-1, 0, -0.524750769f},
+    {28, 5295, 1.01214743f},
+    {-1, 0, -0.642966509f},
+    {-1, 0, -0.604246795f},
+    {11, 5300, 1.44429564f},
+    {18, 5299, 1.02864432f},
+    {-1, 0, -0.689307392f},
+    {-1, 0, -0.718207479f},
+    {-1, 0, -0.619158268f},
+    {30, 5307, 0.977863729f},
+    {20, 5306, 0.98313874f},
+    {0, 5305, 0.960556686f},
+    {-1, 0, -0.414977372f},
+    {-1, 0, -0.52701056f},
+    {-1, 0, -0.608484983f},
+    {-1, 0, -0.417749077f},
+    {40, 5322, 0.987268031f},
+    {12, 5315, 1.47390151f},
+    {23, 5314, 1.16149867f},
+    {13, 5313, 1.16138828f},
+    {-1, 0, -0.725460172f},
+    {-1, 0, -0.769218087f},
+    {-1, 0, -0.845362484f},
+    {10, 5319, 0.947725415f},
+    {18, 5318, 0.976275802f},
+    {-1, 0, -0.596674621f},
+    {-1, 0, -0.677715719f},
+    {4, 5321, 0.142096698f},
+    {-1, 0, -0.798772633f},
+    {-1, 0, -0.680757105f},
+    {48, 5324, 1.04950464f},
+    {-1, 0, -0.541835487f},
+    {-1, 0, -0.678550839f},
+    {25, 5329, 0.0314819999f},
+    {22, 5328, 1.44420481f},
+    {-1, 0, -0.393190384f},
+    {-1, 0, -0.221768826f},
+    {40, 5331, 0.960635602f},
+    {-1, 0, -0.734189093f},
+    {-1, 0, -0.454984039f},
+    {18, 5374, 0.976275802f},
+    {43, 5365, 1.23134112f},
+    {14, 5352, 0.0924076512f},
+    {3, 5345, 1.13844168f},
+    {40, 5344, 0.974451244f},
+    {28, 5339, 0.969537735f},
+    {-1, 0, -0.236199081f},
+    {33, 5341, 1.13908994f},
+    {-1, 0, -0.371600211f},
+    {20, 5343, 0.871244848f},
+    {-1, 0, -0.466441005f},
+    {-1, 0, -0.614408076f},
+    {-1, 0, -0.133457124f},
+    {20, 5351, 0.943891644f},
+    {13, 5348, 1.0824337f},
+    {-1, 0, 0.162137166f},
+    {10, 5350, 0.947725415f},
+    {-1, 0, 0.0244361665f},
+    {-1, 0, -0.130468994f},
+    {-1, 0, -0.377563536f},
+    {4, 5364, 0.119360849f},
+    {10, 5363, 0.952147901f},
+    {3, 5358, 1.10585618f},
+    {11, 5357, 1.47617376f},
+    {-1, 0, -0.528779507f},
+    {-1, 0, -0.443614841f},
+    {34, 5360, 0.0965090021f},
+    {-1, 0, -0.661096811f},
+    {38, 5362, 1.03717005f},
+    {-1, 0, -0.561666846f},
+    {-1, 0, -0.604556143f},
+    {-1, 0, -0.338993013f},
+    {-1, 0, -0.745929182f},
+    {28, 5367, 0.969537735f},
+    {-1, 0, -0.536475122f},
+    {11, 5369, 1.47617376f},
+    {-1, 0, -0.844111383f},
+    {41, 5373, 1.47723091f},
+    {28, 5372, 1.00637281f},
+    {-1, 0, -0.605333626f},
+    {-1, 0, -0.710962176f},
+    {-1, 0, -0.786009371f},
+    {0, 5412, 0.962941766f},
+    {38, 5385, 1.00456011f},
+    {3, 5380, 1.08224201f},
+    {18, 5379, 1.02348042f},
+    {-1, 0, -0.39020583f},
+    {-1, 0, -0.626200259f},
+    {4, 5384, 0.113779202f},
+    {28, 5383, 0.969537735f},
+    {-1, 0, -0.577900112f},
+    {-1, 0, -0.70737195f},
+    {-1, 0, -0.817929268f},
+    {0, 5393, 0.893471003f},
+    {34, 5392, 0.0843309984f},
+    {28, 5389, 1.08404231f},
+    {-1, 0, -0.910749793f},
+    {20, 5391, 0.967827559f},
+    {-1, 0, -0.955999434f},
+    {-1, 0, -0.976938844f},
+    {-1, 0, -0.828430593f},
+    {25, 5401, 0.0539540015f},
+    {13, 5396, 1.09273791f},
+    {-1, 0, -0.595864713f},
+    {8, 5400, 1.02847731f},
+    {18, 5399, 0.993654907f},
+    {-1, 0, -0.689866185f},
+    {-1, 0, -0.786893785f},
+    {-1, 0, -0.607114553f},
+    {4, 5409, 0.133862898f},
+    {41, 5406, 1.44549811f},
+    {12, 5405, 1.42451668f},
+    {-1, 0, -0.798318386f},
+    {-1, 0, -0.722517133f},
+    {22, 5408, 1.44420481f},
+    {-1, 0, -0.858986259f},
+    {-1, 0, -0.795794189f},
+    {18, 5411, 1.00058889f},
+    {-1, 0, -0.897134781f},
+    {-1, 0, -0.921985269f},
+    {5, 5426, 0.058600001f},
+    {41, 5423, 1.47723091f},
+    {4, 5422, 0.170051694f},
+    {48, 5417, 1.03024542f},
+    {-1, 0, -0.294894367f},
+    {48, 5421, 1.05405533f},
+    {21, 5420, 1.3429358f},
+    {-1, 0, -0.494312108f},
+    {-1, 0, -0.379410475f},
+    {-1, 0, -0.610367358f},
+    {-1, 0, -0.619042516f},
+    {22, 5425, 1.42489457f},
+    {-1, 0, -0.7442469f},
+    {-1, 0, -0.572089195f},
+    {41, 5428, 1.44549811f},
+    {-1, 0, -0.694549382f},
+    {-1, 0, -0.789050937f},
+};
+
+}  // namespace distilled
+
+#endif  // DISTILLED_ACTOR_TABLES_HH
@@ -0,0 +1,148 @@
+#include "flow_table.hh"
+
+#include <algorithm>
+#include <stdexcept>
+
+/* idle timers fire at most 1/64 of the timeout late */
+static const uint64_t kIdleTimerTicks = 64;
+
+FlowTable::FlowTable(uint64_t idle_timeout_us, uint32_t max_flows)
+    : idle_timeout_us_(idle_timeout_us),
+      max_flows_(std::min(std::max<uint32_t>(max_flows, 1), kMaxFlows)),
+      contexts_(),
+      generations_(),
+      last_seen_us_(),
+      newer_(),
+      older_(),
+      newest_(kNone),
+      oldest_(kNone),
+      free_(),
+      size_(0),
+      evicted_(0),
+      idle_timers_(std::max<uint64_t>(idle_timeout_us / kIdleTimerTicks,
+                                      1000)),
+      expired_() {}
+
+int FlowTable::insert(uint64_t now_us) {
+  if (full()) {
+    // the least recently seen flow makes room
+    release(oldest_);
+    evicted_++;
+  }
+  uint32_t slot;
+  if (not free_.empty()) {
+    slot = free_.back();
+    free_.pop_back();
+  } else {
+    if (contexts_.size() == kMaxFlows) {
+      throw std::runtime_error("flow table is full");
+    }
+    slot = contexts_.size();
+    contexts_.emplace_back(0);
+    generations_.push_back(0);
+    last_seen_us_.push_back(0);
+    newer_.push_back(kNone);
+    older_.push_back(kNone);
+  }
+  const uint32_t generation = ++generations_[slot];
+  const int handle =
+      static_cast<int>(((generation & kGenerationMask) << kSlotBits) | slot);
+  contexts_[slot] = FlowContext(handle);
+  last_seen_us_[slot] = now_us;
+  link_front(slot);
+  size_++;
+  if (idle_timeout_us_ > 0) {
+    idle_timers_.schedule(handle, now_us + idle_timeout_us_);
+  }
+  return handle;
+}
+
+FlowContext* FlowTable::find(int handle) {
+  const uint32_t slot = FlowTable::slot(handle);
+  if (handle < 0 or slot >= contexts_.size()) {
+    return nullptr;
+  }
+  const uint32_t generation = generations_[slot];
+  if ((generation & 1) == 0 or (generation & kGenerationMask) !=
+                                   static_cast<uint32_t>(handle) >> kSlotBits) {
+    return nullptr;
+  }
+  return &contexts_[slot];
+}
+
+FlowContext* FlowTable::touch(int handle, uint64_t now_us) {
+  FlowContext* context = find(handle);
+  if (context != nullptr) {
+    const uint32_t slot = FlowTable::slot(handle);
+    // the idle timer is not moved; it finds the new time when it fires
+    last_seen_us_[slot] = now_us;
+    if (newest_ != slot) {
+      unlink(slot);
+      link_front(slot);
+    }
+  }
+  return context;
+}
+
+bool FlowTable::erase(int handle) {
+  if (find(handle) == nullptr) {
+    return false;
+  }
+  release(slot(handle));
+  return true;
+}
+
+size_t FlowTable::reap(uint64_t now_us) {
+  if (idle_timeout_us_ == 0) {
+    return 0;
+  }
+  expired_.clear();
+  idle_timers_.advance(now_us, expired_);
+  size_t reaped = 0;
+  for (const uint64_t id : expired_) {
+    const int handle = static_cast<int>(id);
+    // the flow ended, or its slot was reused
+    if (find(handle) == nullptr) {
+      continue;
+    }
+    const uint64_t idle_until = last_seen_us_[slot(handle)] + idle_timeout_us_;
+    if (idle_until > now_us) {
+      idle_timers_.schedule(handle, idle_until);
+    } else {
+      release(slot(handle));
+      reaped++;
+    }
+  }
+  return reaped;
+}
+
+void FlowTable::link_front(uint32_t slot) {
+  older_[slot] = newest_;
+  newer_[slot] = kNone;
+  if (newest_ != kNone) {
+    newer_[newest_] = slot;
+  } else {
+    oldest_ = slot;
+  }
+  newest_ = slot;
+}
+
+void FlowTable::unlink(uint32_t slot) {
+  if (newer_[slot] != kNone) {
+    older_[newer_[slot]] = older_[slot];
+  } else {
+    newest_ = older_[slot];
+  }
+  if (older_[slot] != kNone) {
+    newer_[older_[slot]] = newer_[slot];
+  } else {
+    oldest_ = newer_[slot];
+  }
+}
+
+void FlowTable::release(uint32_t slot) {
+  unlink(slot);
+  generations_[slot]++;
+  free_.push_back(slot);
+  size_--;
+}
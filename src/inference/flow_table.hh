@@ -0,0 +1,90 @@
+#ifndef FLOW_TABLE_HH
+#define FLOW_TABLE_HH
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "context.hh"
+#include "timer_wheel.hh"
+
+/**
+ * @brief The contexts of the live flows, in one contiguous array.
+ *
+ * A flow is named by the handle the server issues at START: its slot in
+ * the array in the low kSlotBits bits, and the generation of the slot
+ * above them. A lookup is an index and a compare, with no hashing. A slot
+ * is reused after its flow ends, with the next generation, so a handle
+ * kept after END (or made up by a client) is detected as stale instead of
+ * reaching another flow's context.
+ *
+ * Clients that die never send END, so the table also bounds itself: a
+ * flow not seen for the idle timeout is reaped, and a flow started when
+ * the table is full evicts the least recently seen one.
+ */
+class FlowTable {
+ public:
+  static constexpr int kSlotBits = 20;
+  // flows live at once
+  static constexpr uint32_t kMaxFlows = 1u << kSlotBits;
+
+  /* `idle_timeout_us` 0 keeps idle flows forever */
+  FlowTable(uint64_t idle_timeout_us = 0, uint32_t max_flows = kMaxFlows);
+
+  /* a context for a new flow; returns its handle (non-negative) */
+  int insert(uint64_t now_us);
+
+  /* the context of `handle`, or nullptr if the flow is unknown or ended;
+   * valid until the next insert() */
+  FlowContext* find(int handle);
+
+  /* find(), and marks the flow as seen at `now_us` */
+  FlowContext* touch(int handle, uint64_t now_us);
+
+  /* returns false if the flow is unknown or ended */
+  bool erase(int handle);
+
+  /* ends the flows idle since before `now_us` - idle timeout; returns how
+   * many */
+  size_t reap(uint64_t now_us);
+
+  size_t size() const { return size_; }
+  bool full() const { return size_ == max_flows_; }
+  // flows ended by insert() to make room
+  uint64_t evicted() const { return evicted_; }
+
+  static uint32_t slot(int handle) { return handle & (kMaxFlows - 1); }
+
+ private:
+  // generations that fit in a handle without making it negative
+  static constexpr uint32_t kGenerationMask = (1u << (31 - kSlotBits)) - 1;
+  // end of the recency list
+  static constexpr uint32_t kNone = UINT32_MAX;
+
+  void link_front(uint32_t slot);
+  void unlink(uint32_t slot);
+  void release(uint32_t slot);
+
+  uint64_t idle_timeout_us_;
+  uint32_t max_flows_;
+
+  std::vector<FlowContext> contexts_;
+  // per slot; odd while the slot holds a flow
+  std::vector<uint32_t> generations_;
+  std::vector<uint64_t> last_seen_us_;
+  // the live flows, the most recently seen first
+  std::vector<uint32_t> newer_;
+  std::vector<uint32_t> older_;
+  uint32_t newest_;
+  uint32_t oldest_;
+  // slots to reuse, the last freed first (its context is still in cache)
+  std::vector<uint32_t> free_;
+  size_t size_;
+  uint64_t evicted_;
+
+  // one timer per flow, at its last seen time + the idle timeout
+  TimerWheel idle_timers_;
+  std::vector<uint64_t> expired_;
+};
+
+#endif  // FLOW_TABLE_HH
@@ -2,26 +2,41 @@
 #include <signal.h>
 
 #include <iostream>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 
 #include <boost/asio.hpp>
 
+#include "config.h"
 #include "define.hh"
+#include "inference_service.hh"
 #include "server.hh"
-#include "tf_inference.hh"
+#include "stats.hh"
 #include "udp_server.hh"
 #include "unix_socket_server.hh"
+#ifdef HAVE_IO_URING
+#include "io_uring.hh"
+#include "uring_server.hh"
+#endif
 
 void signal_handler(int sig) {
   std::cout << "Signal " << sig << " received" << std::endl;
-  TFInference::Get()->stop();
+  InferenceService::Get()->stop();
   exit(0);
 }
 
 void usage_error(char** argv) {
   std::cerr << "Usage: " << argv[0] << " [-g|--graph] <graph-file> "
-            << "[-c|--checkpoint] <checkpoint-path> [-b|--batch] BATCH_MODE\n";
+            << "[-c|--checkpoint] <checkpoint-path> [-b|--batch] BATCH_MODE "
+            << "[-h|--channel] udp|unix [-s|--stats-socket] PATH "
+            << "[-i|--stats-interval] SECONDS "
+#ifdef HAVE_IO_URING
+            << "[-u|--io-uring] "
+#endif
+            << "[-t|--flow-idle-timeout] SECONDS [-m|--max-flows] N "
+            << "[-e|--gate-epsilon] FRACTION [-a|--gate-max-stale] MS "
+            << "[-k|--backend] tf|tree|compiled\n";
   exit(1);
 }
 
@@ -34,10 +49,27 @@ int main(int argc, char** argv) {
                          {"checkpoint", required_argument, nullptr, 'c'},
                          {"batch", optional_argument, nullptr, 'b'},
                          {"channel", optional_argument, nullptr, 'h'},
+                         {"stats-socket", required_argument, nullptr, 's'},
+                         {"stats-interval", required_argument, nullptr, 'i'},
+#ifdef HAVE_IO_URING
+                         {"io-uring", no_argument, nullptr, 'u'},
+#endif
+                         {"flow-idle-timeout", required_argument, nullptr, 't'},
+                         {"max-flows", required_argument, nullptr, 'm'},
+                         {"gate-epsilon", required_argument, nullptr, 'e'},
+                         {"gate-max-stale", required_argument, nullptr, 'a'},
+                         {"backend", required_argument, nullptr, 'k'},
                          {0, 0, nullptr, 0}};
+  // statistics are served on this socket; dumped to stderr every interval
+  std::string stats_socket_path = "/tmp/astraea-stats.sock";
+  int stats_interval = 0;
+#ifdef HAVE_IO_URING
+  // serve the channel from an io_uring instead of boost::asio
+  bool io_uring = false;
+#endif
 
   int opt;
-  while ((opt = getopt_long(argc, argv, "b:g:c:h:", opts, nullptr)) != -1) {
+  while ((opt = getopt_long(argc, argv, "b:g:c:h:s:i:ut:m:e:a:k:", opts, nullptr)) != -1) {
     switch (opt) {
     case 'b':
       batchMode = atoi(optarg);
@@ -51,6 +83,32 @@ int main(int argc, char** argv) {
     case 'h':
       channel = optarg;
       break;
+    case 's':
+      stats_socket_path = optarg;
+      break;
+    case 'i':
+      stats_interval = atoi(optarg);
+      break;
+#ifdef HAVE_IO_URING
+    case 'u':
+      io_uring = true;
+      break;
+#endif
+    case 't':
+      flowIdleTimeout = atoi(optarg);
+      break;
+    case 'm':
+      maxFlows = atoi(optarg);
+      break;
+    case 'e':
+      gateEpsilon = atof(optarg);
+      break;
+    case 'a':
+      gateMaxStale = atoi(optarg);
+      break;
+    case 'k':
+      backendName = optarg;
+      break;
     case '?':
       usage_error(argv);
       return 1;
@@ -60,24 +118,54 @@ int main(int argc, char** argv) {
     }
   }
 
-  std::cout << "Graph path: " << graphPath << std::endl;
-  std::cout << "Checkpoint path: " << checkpointPath << std::endl;
+  std::cout << "Backend: " << backendName << std::endl;
+  if (backendName == "tf") {
+    std::cout << "Graph path: " << graphPath << std::endl;
+    std::cout << "Checkpoint path: " << checkpointPath << std::endl;
+  }
   if (batchMode) {
     std::cout << "Batch mode enabled" << std::endl;
   }
   std::cout << "Communication Channel: " << channel << std::endl;
+  if (gateEpsilon > 0) {
+    std::cout << "Event gate: epsilon " << gateEpsilon << ", max stale "
+              << gateMaxStale << "ms" << std::endl;
+  }
   signal(SIGTERM, signal_handler);
   signal(SIGINT, signal_handler);
 
-  TFInference::Get();
-  std::vector<float> input(50, 0);
+  // load the backend and warm it up before the first flow
+  InferenceBackend& backend = InferenceService::Get()->backend();
+  std::vector<float> input(kNNInputSize, 0);
   for (int i = 0; i < 100; ++i) {
-    auto state = input;
-    TFInference::Get()->inference_imdt(0, std::move(state), [](float, const std::string&) {});
+    float action;
+    backend.infer(input.data(), 1, &action);
   }
+  InferenceStats::Get()->reset();
   // launch UDP server
   try {
     boost::asio::io_service io_service;
+    ::unlink(stats_socket_path.c_str());
+    StatsServer stats_server(io_service, stats_socket_path,
+                             std::chrono::seconds(stats_interval));
+    stats_server.start();
+#ifdef HAVE_IO_URING
+    if (io_uring) {
+      if (not IOUring::available()) {
+        throw std::runtime_error(
+            "--io-uring needs io_uring with multishot receives (Linux 6.0 or "
+            "later)");
+      }
+      std::string socket_path = "/tmp/astraea.sock";
+      ::unlink(socket_path.c_str());
+      UringServer server(channel, socket_path);
+      // the stats endpoint keeps its own thread
+      std::thread stats_thread([&io_service]() { io_service.run(); });
+      stats_thread.detach();
+      server.start();
+      return 0;
+    }
+#endif
     if (channel == "udp") {
       UdpServer server(io_service);
       server.start();
@@ -0,0 +1,19 @@
+#include "inference_backend.hh"
+
+#include <stdexcept>
+
+#include "define.hh"
+#include "native_backend.hh"
+#include "tf_backend.hh"
+
+std::unique_ptr<InferenceBackend> InferenceBackend::create(
+    const std::string& name) {
+  if (name == "tf") {
+    return std::make_unique<TFSessionBackend>(graphPath, checkpointPath);
+  } else if (name == "tree") {
+    return std::make_unique<TreeBackend>();
+  } else if (name == "compiled") {
+    return std::make_unique<CompiledBackend>();
+  }
+  throw std::runtime_error("Unknown inference backend: " + name);
+}
@@ -0,0 +1,37 @@
+#ifndef INFERENCE_BACKEND_HH
+#define INFERENCE_BACKEND_HH
+
+#include <memory>
+#include <string>
+
+/**
+ * @brief An engine that runs the actor: states in, actions out.
+ *
+ * The servers and the batch loop (InferenceService) only see this interface,
+ * so the engine is picked at startup (infer --backend) and benchmarked with
+ * the same harness (bench_inference) whatever it is:
+ *   tf        the TensorFlow session on the exported graph (TFSessionBackend)
+ *   tree      the regression tree distilled from the actor (DistilledActor)
+ *   compiled  the actor compiled ahead of time from its checkpoint
+ *             (CompiledActor)
+ */
+class InferenceBackend {
+ public:
+  virtual ~InferenceBackend() {}
+
+  /* the backend called `name`, loaded and warmed up; throws
+   * std::runtime_error for an unknown name or a model that does not load */
+  static std::unique_ptr<InferenceBackend> create(const std::string& name);
+
+  virtual std::string name() const = 0;
+
+  /* the actions of `batch` states of kNNInputSize features, one after the
+   * other in `states`; may be called from one thread at a time */
+  virtual void infer(const float* states, size_t batch, float* actions) = 0;
+
+  /* whether a batch costs less per state than single states, i.e. whether
+   * queueing steps for the batch loop pays off */
+  virtual bool batches() const { return false; }
+};
+
+#endif  // INFERENCE_BACKEND_HH
@@ -0,0 +1,119 @@
+#include "inference_service.hh"
+
+#include "current_time.hh"
+#include "stats.hh"
+
+/* sends a reply, keeping a failed send from taking the caller down */
+static void reply(const ResponseCallback& send_response, float action,
+                  const StepTiming& timing) {
+  try {
+    send_response(action, "", timing);
+  } catch (const std::exception& e) {
+    std::cerr << "Error sending response: " << e.what() << std::endl;
+  }
+}
+
+InferenceService::InferenceService(std::unique_ptr<InferenceBackend> backend,
+                                   bool batch)
+    : backend_(std::move(backend)),
+      inference_req_queue_(),
+      mutex_(),
+      cv_(),
+      inference_thread_(nullptr),
+      keep_running_(true) {
+  // spawn a new thread to run the inference session
+  if (batch and backend_->batches()) {
+    inference_thread_ =
+        new std::thread(&InferenceService::inference_loop, this);
+  }
+}
+
+void InferenceService::stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    keep_running_ = false;
+  }
+  cv_.notify_all();
+  if (inference_thread_) {
+    inference_thread_->join();
+    delete inference_thread_;
+    inference_thread_ = nullptr;
+  }
+}
+
+void InferenceService::decide(std::vector<float>&& state,
+                              ResponseCallback&& send_response) {
+  if (inference_thread_) {
+    submit_inference_request(std::move(state), std::move(send_response));
+  } else {
+    infer_now(std::move(state), std::move(send_response));
+  }
+}
+
+void InferenceService::infer_now(std::vector<float>&& state,
+                                 ResponseCallback&& send_response) {
+  StepTiming timing;
+  float action;
+  timing.infer_start_us = steadyTime_microseconds();
+  backend_->infer(state.data(), 1, &action);
+  timing.infer_end_us = steadyTime_microseconds();
+  auto stats = InferenceStats::Get();
+  stats->batch_size.record(1);
+  stats->forward_us.record(timing.infer_end_us - timing.infer_start_us);
+#ifdef DEBUG
+  std::cout << "Inference: state: " << print_state(state)
+            << ", action: " << action << std::endl;
+#endif
+  reply(send_response, action, timing);
+}
+
+void InferenceService::submit_inference_request(
+    std::vector<float>&& state, ResponseCallback&& send_response) {
+  // store the inference request
+  std::lock_guard<std::mutex> lock(mutex_);
+  inference_req_queue_.push_back(
+      {std::move(state), std::move(send_response), steadyTime_microseconds()});
+  cv_.notify_all();
+}
+
+void InferenceService::inference_loop() {
+  // the states of a batch, one after the other, as the backend takes them
+  std::vector<float> states;
+  std::vector<float> actions;
+  // this loop check the inference request queue at a fixed interval
+  while (keep_running_.load()) {
+    std::vector<InferenceRequest> requests;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      // wait until there is at least one request
+      cv_.wait(lock, [this] {
+        return (!keep_running_.load()) || (!inference_req_queue_.empty());
+      });
+      requests.swap(inference_req_queue_);
+    }
+    if (requests.size() > 0) {
+      auto stats = InferenceStats::Get();
+      const uint64_t dequeued_us = steadyTime_microseconds();
+      stats->batches.add();
+      stats->batch_size.record(requests.size());
+      states.clear();
+      for (auto& req : requests) {
+        stats->queue_wait_us.record(dequeued_us - req.enqueued_us);
+        states.insert(states.end(), req.state.begin(), req.state.end());
+      }
+      actions.resize(requests.size());
+      StepTiming timing;
+      timing.infer_start_us = steadyTime_microseconds();
+      backend_->infer(states.data(), requests.size(), actions.data());
+      timing.infer_end_us = steadyTime_microseconds();
+      stats->forward_us.record(timing.infer_end_us - timing.infer_start_us);
+      // outside the lock: the callbacks may be slow, and must not hold up
+      // submit_inference_request()
+      for (size_t i = 0; i < requests.size(); ++i) {
+        timing.enqueued_us = requests[i].enqueued_us;
+        reply(requests[i].send_response, actions[i], timing);
+      }
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(kBatchInterval));
+  }
+}
@@ -0,0 +1,76 @@
+#ifndef INFERENCE_SERVICE_HH
+#define INFERENCE_SERVICE_HH
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "define.hh"
+#include "inference_backend.hh"
+
+/**
+ * @brief Decides the steps of the servers on the backend chosen at startup.
+ *
+ * In batch mode, and for a backend that batches, the steps are queued and a
+ * thread runs them through the backend together every kBatchInterval.
+ * Otherwise each step is decided at once, on the server's thread.
+ */
+class InferenceService {
+ public:
+  static InferenceService* Get() {
+    static InferenceService service(InferenceBackend::create(backendName),
+                                    batchMode);
+    return &service;
+  }
+
+  InferenceBackend& backend() { return *backend_; }
+
+  /* decides the step of a formatted state; the reply goes out through
+   * send_response, at once or from the batch thread */
+  void decide(std::vector<float>&& state, ResponseCallback&& send_response);
+
+  void stop();
+
+ private:
+  InferenceService(std::unique_ptr<InferenceBackend> backend, bool batch);
+  // disallow copy and assign
+  InferenceService(const InferenceService&) = delete;
+  InferenceService& operator=(const InferenceService&) = delete;
+  ~InferenceService() { stop(); }
+
+  void infer_now(std::vector<float>&& state,
+                 ResponseCallback&& send_response);
+  void submit_inference_request(std::vector<float>&& state,
+                                ResponseCallback&& send_response);
+
+  /**
+   * @brief The main inference loop
+   * This function runs the batch inference service. It operates in a new thread
+   * and stores a queue of inference requests.
+   *
+   */
+  void inference_loop();
+
+  struct InferenceRequest {
+    std::vector<float> state;
+    // bound to the message of this step: a flow may have several queued
+    ResponseCallback send_response;
+    // when it was queued, for the queue wait histogram
+    uint64_t enqueued_us;
+  };
+  std::unique_ptr<InferenceBackend> backend_;
+  // for batch inference
+  std::vector<InferenceRequest> inference_req_queue_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+
+  // for batch inference
+  std::thread* inference_thread_;
+  // flag to indicate whether stop
+  std::atomic<bool> keep_running_;
+};
+
+#endif  // INFERENCE_SERVICE_HH
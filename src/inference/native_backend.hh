@@ -0,0 +1,50 @@
+#ifndef NATIVE_BACKEND_HH
+#define NATIVE_BACKEND_HH
+
+#include <stdexcept>
+
+#include "compiled_actor.hh"
+#include "define.hh"
+#include "distilled_actor.hh"
+#include "inference_backend.hh"
+
+/* the distilled tree: a walk per state, tens of nanoseconds */
+class TreeBackend : public InferenceBackend {
+ public:
+  TreeBackend() {
+    if (not DistilledActor::available()) {
+      throw std::runtime_error(
+          "no distilled actor compiled in: run python/distill_actor.py and "
+          "rebuild");
+    }
+  }
+
+  std::string name() const override { return "tree"; }
+
+  void infer(const float* states, size_t batch, float* actions) override {
+    for (size_t i = 0; i < batch; i++) {
+      actions[i] = DistilledActor::act(states + i * kNNInputSize);
+    }
+  }
+};
+
+/* the actor generated as C++ by python/generate_actor.py at build time */
+class CompiledBackend : public InferenceBackend {
+ public:
+  CompiledBackend() {
+    if (CompiledActor::kInputSize != kNNInputSize) {
+      throw std::runtime_error("the compiled actor takes " +
+                               std::to_string(CompiledActor::kInputSize) +
+                               " features, not " +
+                               std::to_string(kNNInputSize));
+    }
+  }
+
+  std::string name() const override { return "compiled"; }
+
+  void infer(const float* states, size_t batch, float* actions) override {
+    CompiledActor::act(states, batch, actions);
+  }
+};
+
+#endif  // NATIVE_BACKEND_HH
@@ -4,12 +4,17 @@
 #include <string>
 
 #include "context.hh"
+#include "current_time.hh"
 #include "define.hh"
+#include "flow_table.hh"
+#include "stats.hh"
 
 class FlowContext;
 class Server {
  public:
-  Server() {}
+  Server()
+      : flow_table(static_cast<uint64_t>(flowIdleTimeout) * 1000000,
+                   maxFlows) {}
   virtual ~Server() {}
   virtual void start() = 0;
 
@@ -19,24 +24,87 @@ class Server {
   virtual void handle_congestion_control(int flow_id, json& data,
                                          ResponseCallback&& send_response) = 0;
 
+  /**
+   * @brief Build the reply to an ALIVE message.
+   *
+   * The step id of the request is echoed so the client can drop stale
+   * replies. If the client is tracing (the request carries "t_send"), the
+   * hop timestamps of the step are attached as "trace":
+   * [received, enqueued, inference start, inference end, reply], all from
+   * the steady clock in microseconds.
+   */
+  static std::string make_action_reply(const json& request, float action,
+                                       uint64_t received_us,
+                                       const StepTiming& timing) {
+    int cwnd = request["state"]["cwnd"];
+    json reply;
+    reply["cwnd"] = map_action(action, cwnd);
+    reply["flow_id"] = request["flow_id"];
+    if (request.count("step")) {
+      reply["step"] = request["step"];
+    }
+    if (request.count("t_send")) {
+      reply["trace"] = {received_us, timing.enqueued_us,
+                        timing.infer_start_us, timing.infer_end_us,
+                        steadyTime_microseconds()};
+    }
+    return reply.dump();
+  }
+
+  /* START: a new flow; returns its id */
+  int open_flow() {
+    const uint64_t now_us = steadyTime_microseconds();
+    reap_idle_flows(now_us);
+    if (flow_table.full()) {
+      InferenceStats::Get()->flows_evicted.add();
+    }
+    return flow_table.insert(now_us);
+  }
+
+  /* ALIVE: the context of the flow, or nullptr if it ended */
+  FlowContext* touch_flow(int flow_id) {
+    const uint64_t now_us = steadyTime_microseconds();
+    reap_idle_flows(now_us);
+    return flow_table.touch(flow_id, now_us);
+  }
+
+  /* the event gate: answers a step that needs no decision with the window
+   * it has, without inference; returns whether it did */
+  static bool skip_decision(FlowContext* context, const json& state,
+                            ResponseCallback& send_response) {
+    if (context->needs_decision(state, steadyTime_microseconds())) {
+      return false;
+    }
+    InferenceStats::Get()->decisions_skipped.add();
+    // action 0 maps to the current window
+    send_response(0, "", StepTiming());
+    return true;
+  }
+
+  void reap_idle_flows(uint64_t now_us) {
+    const size_t reaped = flow_table.reap(now_us);
+    if (reaped > 0) {
+      InferenceStats::Get()->flows_reaped.add(reaped);
+    }
+  }
+
   virtual void handle_flow_removal(int flow_id) {
-    if (flow_contexts.find(flow_id) == flow_contexts.end()) {
+    if (not flow_table.erase(flow_id)) {
       std::cerr << "Flow " << flow_id << " does not exist" << std::endl;
-      return;
     }
-    delete flow_contexts[flow_id];
-    flow_contexts.erase(flow_id);
   }
 
  protected:
-  // per flow inference context
-  std::unordered_map<int, FlowContext*> flow_contexts;
+  // per flow inference context, by the flow ids the server issues
+  FlowTable flow_table;
   enum class MessageType {
     INIT = 0,
     START = 1,
     END = 2,
     ALIVE = 3,
-    OBSERVE = 4
+    OBSERVE = 4,
+    // switches a stream to tagged frames for many flows (serialization.hh)
+    MUX = 5
   };
 };
 
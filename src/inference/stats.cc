@@ -0,0 +1,136 @@
+#include "stats.hh"
+
+#include <boost/bind.hpp>
+
+static json histogram_to_json(const Histogram& histogram) {
+  const HistogramSnapshot snap = histogram.snapshot();
+  json out;
+  out["count"] = snap.count();
+  out["mean"] = snap.mean();
+  out["min"] = snap.min();
+  out["p50"] = snap.percentile(0.5);
+  out["p90"] = snap.percentile(0.9);
+  out["p99"] = snap.percentile(0.99);
+  out["p999"] = snap.percentile(0.999);
+  out["max"] = snap.max();
+  return out;
+}
+
+InferenceStats::InferenceStats()
+    : queue_wait_us(),
+      batch_size(),
+      forward_us(),
+      serialize_us(),
+      send_us(),
+      end_to_end_us(),
+      requests(),
+      decisions_skipped(),
+      replies(),
+      batches(),
+      flows_started(),
+      flows_ended(),
+      flows_reaped(),
+      flows_evicted(),
+      unknown_flows(),
+      send_errors(),
+      replies_dropped(),
+      started_(std::chrono::steady_clock::now()) {}
+
+json InferenceStats::to_json() const {
+  json out;
+  out["uptime_s"] = std::chrono::duration_cast<std::chrono::seconds>(
+                        std::chrono::steady_clock::now() - started_)
+                        .count();
+  out["counters"] = {
+      {"requests", requests.value()},
+      {"decisions_skipped", decisions_skipped.value()},
+      {"replies", replies.value()},
+      {"batches", batches.value()},
+      {"flows_started", flows_started.value()},
+      {"flows_ended", flows_ended.value()},
+      {"flows_reaped", flows_reaped.value()},
+      {"flows_evicted", flows_evicted.value()},
+      {"unknown_flows", unknown_flows.value()},
+      {"send_errors", send_errors.value()},
+      {"replies_dropped", replies_dropped.value()},
+  };
+  out["histograms"] = {
+      {"queue_wait_us", histogram_to_json(queue_wait_us)},
+      {"batch_size", histogram_to_json(batch_size)},
+      {"forward_us", histogram_to_json(forward_us)},
+      {"serialize_us", histogram_to_json(serialize_us)},
+      {"send_us", histogram_to_json(send_us)},
+      {"end_to_end_us", histogram_to_json(end_to_end_us)},
+  };
+  return out;
+}
+
+void InferenceStats::reset() {
+  for (Histogram* h : {&queue_wait_us, &batch_size, &forward_us,
+                       &serialize_us, &send_us, &end_to_end_us}) {
+    h->reset();
+  }
+  for (Counter* c : {&requests, &decisions_skipped, &replies, &batches,
+                     &flows_started, &flows_ended, &flows_reaped,
+                     &flows_evicted, &unknown_flows, &send_errors,
+                     &replies_dropped}) {
+    c->reset();
+  }
+  started_ = std::chrono::steady_clock::now();
+}
+
+StatsServer::StatsServer(boost::asio::io_service& io_service,
+                         const std::string& socket_path,
+                         const std::chrono::seconds dump_interval)
+    : io_service_(io_service),
+      acceptor_(io_service,
+                boost::asio::local::stream_protocol::endpoint(socket_path)),
+      dump_timer_(io_service),
+      dump_interval_(dump_interval) {}
+
+void StatsServer::start() {
+  auto socket = std::make_shared<Socket>(io_service_);
+  acceptor_.async_accept(*socket,
+                         boost::bind(&StatsServer::handle_accept, this, socket,
+                                     boost::asio::placeholders::error));
+  if (dump_interval_.count() > 0) {
+    schedule_dump();
+  }
+}
+
+void StatsServer::handle_accept(std::shared_ptr<Socket> socket,
+                                const boost::system::error_code& error) {
+  if (error) {
+    std::cerr << "Stats accept error: " << error.message() << std::endl;
+    return;
+  }
+  auto document =
+      std::make_shared<std::string>(InferenceStats::Get()->to_json().dump(2));
+  document->push_back('\n');
+  boost::asio::async_write(
+      *socket, boost::asio::buffer(*document),
+      [socket, document](const boost::system::error_code&, std::size_t) {
+        boost::system::error_code ignored;
+        socket->close(ignored);
+      });
+
+  auto next = std::make_shared<Socket>(io_service_);
+  acceptor_.async_accept(*next,
+                         boost::bind(&StatsServer::handle_accept, this, next,
+                                     boost::asio::placeholders::error));
+}
+
+void StatsServer::schedule_dump() {
+  dump_timer_.expires_after(dump_interval_);
+  dump_timer_.async_wait(boost::bind(&StatsServer::handle_dump, this,
+                                     boost::asio::placeholders::error));
+}
+
+void StatsServer::handle_dump(const boost::system::error_code& error) {
+  if (error) {
+    return;
+  }
+  std::cerr << "[stats] " << InferenceStats::Get()->to_json().dump()
+            << std::endl;
+  schedule_dump();
+}
@@ -0,0 +1,95 @@
+#ifndef STATS_HH
+#define STATS_HH
+
+#include <chrono>
+#include <string>
+
+#include <boost/asio.hpp>
+
+#include "define.hh"
+#include "histogram.hh"
+
+/**
+ * @brief Process-wide counters and latency histograms of the inference
+ * service. All latencies are in microseconds.
+ */
+class InferenceStats {
+ public:
+  static InferenceStats* Get() {
+    static InferenceStats stats;
+    return &stats;
+  }
+
+  json to_json() const;
+  // drop everything recorded so far, e.g. the warm-up inferences
+  void reset();
+
+  // time a request waits in the batch queue
+  Histogram queue_wait_us;
+  // requests served by one forward pass
+  Histogram batch_size;
+  // backend inference, for both batch and immediate inference
+  Histogram forward_us;
+  // building the reply message
+  Histogram serialize_us;
+  // writing the reply to the socket
+  Histogram send_us;
+  // request received -> reply sent
+  Histogram end_to_end_us;
+
+  Counter requests;
+  // steps answered by the event gate without inference
+  Counter decisions_skipped;
+  Counter replies;
+  Counter batches;
+  Counter flows_started;
+  Counter flows_ended;
+  // flows that went silent without END, and flows pushed out of a full table
+  Counter flows_reaped;
+  Counter flows_evicted;
+  Counter unknown_flows;
+  Counter send_errors;
+  // dropped from the write queue of a client that does not keep up, or gone
+  Counter replies_dropped;
+
+ private:
+  InferenceStats();
+  InferenceStats(const InferenceStats&) = delete;
+  InferenceStats& operator=(const InferenceStats&) = delete;
+
+  std::chrono::steady_clock::time_point started_;
+};
+
+/**
+ * @brief Local stats endpoint.
+ *
+ * Every connection to the Unix socket receives the current statistics as
+ * one JSON document and is then closed, e.g.
+ *   socat - UNIX-CONNECT:/tmp/astraea-stats.sock
+ * With a non-zero dump interval the same document is also printed to
+ * stderr periodically.
+ */
+class StatsServer {
+ public:
+  StatsServer(boost::asio::io_service& io_service,
+              const std::string& socket_path,
+              const std::chrono::seconds dump_interval);
+
+  void start();
+
+ private:
+  using Socket = boost::asio::local::stream_protocol::socket;
+
+  void handle_accept(std::shared_ptr<Socket> socket,
+                     const boost::system::error_code& error);
+  void schedule_dump();
+  void handle_dump(const boost::system::error_code& error);
+
+ private:
+  boost::asio::io_service& io_service_;
+  boost::asio::local::stream_protocol::acceptor acceptor_;
+  boost::asio::steady_timer dump_timer_;
+  std::chrono::seconds dump_interval_;
+};
+
+#endif  // STATS_HH
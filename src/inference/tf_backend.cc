@@ -0,0 +1,125 @@
+#include "tf_backend.hh"
+
+#include <cstring>
+#include <stdexcept>
+
+#include "define.hh"
+
+TFSessionBackend::TFSessionBackend(const std::string& graph_path,
+                                   const std::string& checkpoint_path,
+                                   const ActorTensors& tensors)
+    : session_(),
+      tensors_(tensors),
+      train_flag_(tensorflow::DT_BOOL, tensorflow::TensorShape()) {
+  *train_flag_.flat<bool>().data() = false;
+  create_session();
+  tensorflow::Status status =
+      LoadModel(session_.get(), graph_path, checkpoint_path);
+  if (!status.ok()) {
+    throw std::runtime_error("cannot load " + graph_path + ": " +
+                             status.ToString());
+  }
+  // perform a dummy inference to warm up the session
+  std::vector<float> state(kNNInputSize, 0.0);
+  float action;
+  infer(state.data(), 1, &action);
+}
+
+void TFSessionBackend::infer(const float* states, size_t batch,
+                             float* actions) {
+  std::vector<tensorflow::Tensor> output;
+  forward(prepare_batch_input(states, batch), output);
+  const float* values = output[0].flat<float>().data();
+  std::memcpy(actions, values, batch * sizeof(float));
+}
+
+tensorflow::Tensor TFSessionBackend::prepare_batch_input(const float* states,
+                                                         int batch) {
+  tensorflow::TensorShape input_shape({batch, kNNInputSize});
+  tensorflow::Tensor tmp(tensorflow::DT_FLOAT, input_shape);
+  // the states are laid out as the rows of the tensor already
+  std::memcpy(tmp.flat<float>().data(), states,
+              batch * kNNInputSize * sizeof(float));
+  return tmp;
+}
+
+void TFSessionBackend::forward(const tensorflow::Tensor& input,
+                               std::vector<tensorflow::Tensor>& output) {
+  TensorDict feedDict = {
+      {tensors_.state, input},
+      {tensors_.is_training, train_flag_},
+  };
+  tensorflow::Status status =
+      session_->Run(feedDict, {tensors_.action}, {}, &output);
+  if (!status.ok()) {
+    std::cout << status.ToString() << "\n";
+    throw std::runtime_error("Error during inference");
+  }
+}
+
+void TFSessionBackend::create_session() {
+  tensorflow::SessionOptions options;
+
+  tensorflow::ConfigProto* config = &options.config;
+  config->set_allow_soft_placement(true);
+  tensorflow::Session* session = nullptr;
+  tensorflow::Status status = NewSession(options, &session);
+  if (!status.ok()) {
+    throw std::runtime_error("cannot create a TensorFlow session: " +
+                             status.ToString());
+  }
+  session_.reset(session);
+  std::cout << "Session successfully created.\n";
+}
+
+tensorflow::Status TFSessionBackend::LoadModel(tensorflow::Session* sess,
+                                               std::string graph_fn,
+                                               std::string checkpoint_fn) {
+  tensorflow::Status status;
+
+  // Read in the protobuf graph we exported
+  tensorflow::MetaGraphDef graph_def;
+  status = ReadBinaryProto(tensorflow::Env::Default(), graph_fn, &graph_def);
+  if (status != tensorflow::Status::OK()) {
+    std::cout << status.ToString() << std::endl;
+    return status;
+  }
+
+  // create the graph in the current session
+  status = sess->Create(graph_def.graph_def());
+  if (status != tensorflow::Status::OK()) {
+    std::cout << status.ToString() << std::endl;
+    return status;
+  }
+
+  // restore model from checkpoint, iff checkpoint is given
+  if (checkpoint_fn != "") {
+    const std::string restore_op_name = graph_def.saver_def().restore_op_name();
+    const std::string filename_tensor_name =
+        graph_def.saver_def().filename_tensor_name();
+
+    tensorflow::Tensor filename_tensor(tensorflow::DT_STRING,
+                                       tensorflow::TensorShape());
+    filename_tensor.scalar<std::string>()() = checkpoint_fn;
+
+    TensorDict feed_dict = {{filename_tensor_name, filename_tensor}};
+    status = sess->Run(feed_dict, {}, {restore_op_name}, nullptr);
+    if (status != tensorflow::Status::OK()) {
+      std::cout << status.ToString() << std::endl;
+      return status;
+    }
+  } else {
+    // virtual Status Run(const std::vector<std::pair<string, Tensor> >&
+    // inputs,
+    //                  const std::vector<string>& output_tensor_names,
+    //                  const std::vector<string>& target_node_names,
+    //                  std::vector<Tensor>* outputs) = 0;
+    status = sess->Run({}, {}, {"init"}, nullptr);
+    if (status != tensorflow::Status::OK()) {
+      std::cout << status.ToString() << std::endl;
+      return status;
+    }
+  }
+
+  return tensorflow::Status::OK();
+}
\ No newline at end of file
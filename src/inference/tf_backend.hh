@@ -0,0 +1,62 @@
+#ifndef TF_BACKEND_HH
+#define TF_BACKEND_HH
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <tensorflow/core/platform/env.h>
+#include <tensorflow/core/protobuf/meta_graph.pb.h>
+#include <tensorflow/core/public/session.h>
+
+#include "inference_backend.hh"
+typedef std::vector<std::pair<std::string, tensorflow::Tensor>> TensorDict;
+
+/* the tensors of the actor in the exported graph (Actor.build in
+ * python/agent/agent.py) */
+struct ActorTensors {
+  std::string state = "s0:0";
+  std::string is_training = "Actor_is_training:0";
+  std::string action = "actor/Mul:0";
+};
+
+/**
+ * @brief The actor run by a TensorFlow session on the exported graph.
+ *
+ * A session run has a fixed cost of tens of microseconds whatever the batch,
+ * so this backend is the one the batch loop pays off for.
+ */
+class TFSessionBackend : public InferenceBackend {
+ public:
+  TFSessionBackend(const std::string& graph_path,
+                   const std::string& checkpoint_path,
+                   const ActorTensors& tensors = ActorTensors());
+  // disallow copy and assign
+  TFSessionBackend(const TFSessionBackend&) = delete;
+  TFSessionBackend& operator=(const TFSessionBackend&) = delete;
+
+  std::string name() const override { return "tf"; }
+  void infer(const float* states, size_t batch, float* actions) override;
+  bool batches() const override { return true; }
+
+  /* the input tensor of `batch` states */
+  static tensorflow::Tensor prepare_batch_input(const float* states,
+                                                int batch);
+
+  /* the session run alone, on a prepared input */
+  void forward(const tensorflow::Tensor& input,
+               std::vector<tensorflow::Tensor>& output);
+
+ private:
+  void create_session();
+
+  tensorflow::Status LoadModel(tensorflow::Session* sess, std::string graph_fn,
+                               std::string checkpoint_fn = "");
+
+  std::unique_ptr<tensorflow::Session> session_;
+  const ActorTensors tensors_;
+  // fed as false: the batch norms use their moving averages
+  tensorflow::Tensor train_flag_;
+};
+
+#endif  // TF_BACKEND_HH
@@ -1,5 +1,9 @@
 #include "udp_server.hh"
 
+#include "current_time.hh"
+#include "inference_service.hh"
+#include "stats.hh"
+
 UdpServer::UdpServer(boost::asio::io_service& io_service)
     : Server(),
       socket_(io_service, boost::asio::ip::udp::endpoint(
@@ -17,40 +21,33 @@ void UdpServer::start() {
 void UdpServer::handle_flow_init(int& flow_id,
                                  ResponseCallback&& send_response) {
   std::string response;
-  if (flow_contexts.find(flow_id) != flow_contexts.end()) {
-    // generate a random one if already exists
-    flow_id = rand();
-    // std::cout << "Flow " << flow_id
-    //           << " already exists, generate a new one: " << flow_id
-    //           << std::endl;
-  }
-  flow_contexts[flow_id] = new FlowContext(flow_id);
+  // the client goes on with the id issued here
+  flow_id = open_flow();
   json reply;
   reply["flow_id"] = flow_id;
   response = reply.dump();
-  send_response(-1, response);
+  send_response(-1, response, StepTiming());
 }
 
 void UdpServer::handle_congestion_control(int flow_id, json& data,
                                           ResponseCallback&& send_response) {
-  if (unlikely(flow_contexts.find(flow_id) == flow_contexts.end())) {
+  FlowContext* context = touch_flow(flow_id);
+  if (unlikely(context == nullptr)) {
     std::cerr << "Flow " << flow_id << " does not exist" << std::endl;
+    InferenceStats::Get()->unknown_flows.add();
     return;
   }
-  auto context = flow_contexts[flow_id];
   auto state = context->format_state(data["state"]);
-  if (!batchMode) {
-    TFInference::Get()->inference_imdt(flow_id, std::move(state),
-                                       std::move(send_response));
-  } else {
-    TFInference::Get()->submit_inference_request(flow_id, std::move(state),
-                                                 std::move(send_response));
+  if (skip_decision(context, data["state"], send_response)) {
+    return;
   }
+  InferenceService::Get()->decide(std::move(state), std::move(send_response));
 }
 
 void UdpServer::handle_receive(const boost::system::error_code& error,
                                std::size_t bytes_transferred) {
   if (!error) {
+    const uint64_t received_us = steadyTime_microseconds();
     std::string info;
     std::string response;
     info.resize(2);
@@ -74,18 +71,22 @@ void UdpServer::handle_receive(const boost::system::error_code& error,
     int flow_id = data.at("flow_id");
     ResponseCallback send_response =
         std::bind(&UdpServer::send_response, this, remote_endpoint_, data,
-                  std::placeholders::_1, std::placeholders::_2);
+                  received_us, std::placeholders::_1, std::placeholders::_2,
+                  std::placeholders::_3);
     switch (type) {
     case MessageType::START: {
       std::cout << "Register flow " << flow_id << std::endl;
+      InferenceStats::Get()->flows_started.add();
       handle_flow_init(flow_id, std::move(send_response));
       break;
     }
     case MessageType::ALIVE: {
+      InferenceStats::Get()->requests.add();
       handle_congestion_control(flow_id, data, std::move(send_response));
       break;
     }
     case MessageType::END: {
+      InferenceStats::Get()->flows_ended.add();
       handle_flow_removal(flow_id);
       break;
     }
@@ -97,31 +98,36 @@ void UdpServer::handle_receive(const boost::system::error_code& error,
 }
 
 void UdpServer::send_response(boost::asio::ip::udp::endpoint remote_endpoint,
-                              const json data, float action,
-                              const std::string& info) {
+                              const json data, uint64_t received_us,
+                              float action, const std::string& info,
+                              const StepTiming& timing) {
+  auto stats = InferenceStats::Get();
+  const uint64_t serialize_start_us = steadyTime_microseconds();
   std::string response;
   if (info != "") {
     response = put_field(info.length()) + info;
   } else {
-    int cwnd = data["state"]["cwnd"];
-    auto new_cwnd = map_action(action, cwnd);
-    json reply;
-    reply["cwnd"] = new_cwnd;
-    reply["flow_id"] = data["flow_id"];
-    response = put_field(reply.dump().length()) + reply.dump();
+    const std::string reply =
+        make_action_reply(data, action, received_us, timing);
+    response = put_field(reply.length()) + reply;
   }
 #ifdef DEBUG
-  std::cout << "Original cwnd: " << cwnd << ", action: " << action
-            << ", new cwnd: " << new_cwnd << std::endl;
-  std::cout << "Flow " << data["flow_id"] << "Action: " << reply.dump(4)
-            << std::endl;
-  std::cout << "Sending response: " << std::endl;
-  std::cout << response << std::endl;
+  std::cout << "Flow " << data["flow_id"] << " action: " << action
+            << ", sending response: " << response << std::endl;
 #endif
+  const uint64_t send_start_us = steadyTime_microseconds();
+  stats->serialize_us.record(send_start_us - serialize_start_us);
   auto len = socket_.send_to(boost::asio::buffer(response), remote_endpoint);
+  const uint64_t sent_us = steadyTime_microseconds();
+  stats->send_us.record(sent_us - send_start_us);
   if (unlikely(len != response.length())) {
     std::cerr << "UDP Send Error: " << len << " bytes sent, "
               << response.length() << " bytes expected" << std::endl;
+    stats->send_errors.add();
+  }
+  if (info == "") {
+    stats->replies.add();
+    stats->end_to_end_us.record(sent_us - received_us);
   }
 }
 
@@ -30,8 +30,8 @@ class UdpServer : public Server {
                       std::size_t bytes_transferred);
 
   void send_response(boost::asio::ip::udp::endpoint remote_endpoint,
-                     const json data, float action,
-                     const std::string& info = "");
+                     const json data, uint64_t received_us, float action,
+                     const std::string& info, const StepTiming& timing);
 
   void handle_send(const boost::system::error_code& error,
                    std::size_t bytes_transferred);
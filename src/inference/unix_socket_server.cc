@@ -1,5 +1,16 @@
 #include "unix_socket_server.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#include "current_time.hh"
+#include "inference_service.hh"
 #include "serialization.hh"
+#include "stats.hh"
+
+/* replies queued per session before the oldest are dropped */
+static const std::size_t kMaxQueuedBytes = 1 << 20;
 
 UnixSocketServer::UnixSocketServer(boost::asio::io_service& io_service,
                                    const std::string& socket_path)
@@ -28,7 +39,48 @@ void UnixSocketServer::handle_accept(std::shared_ptr<Session> new_session,
   }
 }
 
-Session::Session(boost::asio::io_service& io_service) : socket_(io_service) {}
+void UnixSocketServer::handle_flow_init(int& flow_id,
+                                        ResponseCallback&& send_response) {
+  // the client goes on with the id issued here
+  flow_id = open_flow();
+  json reply;
+  reply["flow_id"] = flow_id;
+  std::string response = reply.dump();
+  send_response(-1, response, StepTiming());
+}
+
+void UnixSocketServer::handle_congestion_control(
+    int flow_id, json& data, ResponseCallback&& send_response) {
+  FlowContext* context = touch_flow(flow_id);
+  if (unlikely(context == nullptr)) {
+    std::cerr << "Flow " << flow_id << " does not exist" << std::endl;
+    InferenceStats::Get()->unknown_flows.add();
+    return;
+  }
+  auto state = context->format_state(data["state"]);
+  if (skip_decision(context, data["state"], send_response)) {
+    return;
+  }
+  InferenceService::Get()->decide(std::move(state), std::move(send_response));
+}
+
+Session::Session(boost::asio::io_service& io_service)
+    : socket_(io_service),
+      recv_buffer_(),
+      message_length_buffer_(),
+      message_length_(0),
+      mux_(false),
+      inbox_(),
+      inbox_end_(0),
+      outbox_mutex_(),
+      outbox_(),
+      outbox_bytes_(0),
+      flushing_(false),
+      in_burst_(false),
+      closing_(false),
+      writing_(),
+      write_start_us_(0),
+      server_(nullptr) {}
 
 boost::asio::local::stream_protocol::socket& Session::socket() {
   return socket_;
@@ -58,109 +110,233 @@ void Session::handle_read_length(const boost::system::error_code& error) {
 
 void Session::handle_read_message(const boost::system::error_code& error,
                                   std::size_t expected_length) {
-  bool stop = false;
   if (!error) {
-    std::string message(recv_buffer_.data(), expected_length);
-    // std::cout << "Received message: " << message << std::endl;
-    std::string response;
-    json data = json::parse(message);
-#ifdef DEBUG
-    std::cout << "Received message: " << std::endl;
-    std::cout << data.dump(4) << std::endl;
-#endif
-    MessageType type = data.at("type");
-    int flow_id = data.at("flow_id");
-    ResponseCallback send_response =
-        std::bind(&Session::send_response, this, data, std::placeholders::_1,
-                  std::placeholders::_2);
-    switch (type) {
-    case MessageType::START: {
-      std::cout << "Register flow " << flow_id << std::endl;
-      handle_flow_init(flow_id, std::move(send_response));
-      break;
-    }
-    case MessageType::ALIVE: {
-      handle_congestion_control(flow_id, data, std::move(send_response));
-      break;
-    }
-    case MessageType::END: {
-      std::cout << "Remove flow " << flow_id << std::endl;
-      handle_flow_removal(flow_id);
-      stop = true;
-      break;
-    }
-    default:
-      break;
-    }
-    if (!stop) {
-      start();
+    const bool stop =
+        handle_message(recv_buffer_.data(), expected_length, 0);
+    if (stop) {
+      close_when_flushed();
+    } else if (mux_) {
+      inbox_.resize(2 * (MUX_HEADER_SIZE + MAX_MESSAGE_SIZE));
+      start_burst();
     } else {
-      // close this socket
-      socket_.close();
+      start();
     }
   } else {
     std::cerr << "Error reading message: " << error.message() << std::endl;
   }
 }
 
-void Session::handle_flow_init(int& flow_id, ResponseCallback&& send_response) {
-  auto& flow_contexts = server_->flow_contexts;
-  if (flow_contexts.find(flow_id) != flow_contexts.end()) {
-    std::cerr << "Flow " << flow_id << " already exists" << std::endl;
-    flow_id = rand();
-  }
-  flow_contexts[flow_id] = new FlowContext(flow_id);
-  json reply;
-  reply["flow_id"] = flow_id;
-  std::string response = reply.dump();
-  send_response(-1, response);
+void Session::start_burst() {
+  socket_.async_read_some(
+      boost::asio::buffer(inbox_.data() + inbox_end_,
+                          inbox_.size() - inbox_end_),
+      boost::bind(&Session::handle_burst, shared_from_this(),
+                  boost::asio::placeholders::error,
+                  boost::asio::placeholders::bytes_transferred()));
 }
 
-void Session::handle_congestion_control(int flow_id, json& data,
-                                        ResponseCallback&& send_response) {
-  auto& flow_contexts = server_->flow_contexts;
-  if (unlikely(flow_contexts.find(flow_id) == flow_contexts.end())) {
-    std::cerr << "Flow " << flow_id << " does not exist" << std::endl;
+void Session::handle_burst(const boost::system::error_code& error,
+                           std::size_t bytes_transferred) {
+  if (error) {
+    if (error != boost::asio::error::eof) {
+      std::cerr << "Error reading message: " << error.message() << std::endl;
+    }
     return;
   }
-  auto context = flow_contexts[flow_id];
-  auto state = context->format_state(data["state"]);
-  if (!batchMode) {
-    TFInference::Get()->inference_imdt(flow_id, std::move(state),
-                                       std::move(send_response));
-  } else {
-    TFInference::Get()->submit_inference_request(flow_id, std::move(state),
-                                                 std::move(send_response));
+  inbox_end_ += bytes_transferred;
+  {
+    std::lock_guard<std::mutex> lock(outbox_mutex_);
+    in_burst_ = true;
+  }
+  // every whole frame that has arrived
+  std::size_t offset = 0;
+  while (inbox_end_ - offset >= MUX_HEADER_SIZE) {
+    const char* frame = inbox_.data() + offset;
+    const uint16_t length = get_uint16(frame);
+    if (inbox_end_ - offset < MUX_HEADER_SIZE + length) {
+      break;
+    }
+    handle_message(frame + MUX_HEADER_SIZE, length, get_uint32(frame + 2));
+    offset += MUX_HEADER_SIZE + length;
   }
+  std::memmove(inbox_.data(), inbox_.data() + offset, inbox_end_ - offset);
+  inbox_end_ -= offset;
+  bool flush_now = false;
+  {
+    std::lock_guard<std::mutex> lock(outbox_mutex_);
+    in_burst_ = false;
+    if (not outbox_.empty() and not flushing_) {
+      flushing_ = flush_now = true;
+    }
+  }
+  if (flush_now) {
+    flush();
+  }
+  start_burst();
 }
 
-void Session::handle_flow_removal(int flow_id) {
-  server_->handle_flow_removal(flow_id);
+bool Session::handle_message(const char* data, std::size_t length,
+                             uint32_t tag) {
+  const uint64_t received_us = steadyTime_microseconds();
+  json message = json::parse(data, data + length);
+#ifdef DEBUG
+  std::cout << "Received message: " << std::endl;
+  std::cout << message.dump(4) << std::endl;
+#endif
+  typedef UnixSocketServer::MessageType MessageType;
+  MessageType type = message.at("type");
+  if (type == MessageType::MUX) {
+    mux_ = true;
+    return false;
+  }
+  int flow_id = message.at("flow_id");
+  ResponseCallback send_response =
+      std::bind(&Session::send_response, shared_from_this(), tag, message,
+                received_us, std::placeholders::_1, std::placeholders::_2,
+                std::placeholders::_3);
+  switch (type) {
+  case MessageType::START: {
+    std::cout << "Register flow " << flow_id << std::endl;
+    InferenceStats::Get()->flows_started.add();
+    server_->handle_flow_init(flow_id, std::move(send_response));
+    break;
+  }
+  case MessageType::ALIVE: {
+    InferenceStats::Get()->requests.add();
+    server_->handle_congestion_control(flow_id, message,
+                                       std::move(send_response));
+    break;
+  }
+  case MessageType::END: {
+    std::cout << "Remove flow " << flow_id << std::endl;
+    InferenceStats::Get()->flows_ended.add();
+    server_->handle_flow_removal(flow_id);
+    // the other flows of a multiplexed connection go on
+    return not mux_;
+  }
+  default:
+    break;
+  }
+  return false;
 }
 
-void Session::send_response(const json data, float action,
-                            const std::string& info) {
+void Session::send_response(uint32_t tag, const json data,
+                            uint64_t received_us, float action,
+                            const std::string& info,
+                            const StepTiming& timing) {
+  const uint64_t serialize_start_us = steadyTime_microseconds();
+  const std::string reply =
+      info != "" ? info
+                 : UnixSocketServer::make_action_reply(data, action,
+                                                       received_us, timing);
   std::string response;
-  if (info != "") {
-    response = put_field(info.length()) + info;
+  if (mux_) {
+    response.resize(MUX_HEADER_SIZE);
+    put_mux_header(reply.length(), tag, response.data());
+    response += reply;
   } else {
-    int cwnd = data["state"]["cwnd"];
-    auto new_cwnd = map_action(action, cwnd);
-    json reply;
-    reply["cwnd"] = new_cwnd;
-    reply["flow_id"] = data["flow_id"];
-    response = put_field(reply.dump().length()) + reply.dump();
+    response = put_field(reply.length()) + reply;
   }
 #ifdef DEBUG
-  std::cout << "Original cwnd: " << cwnd << ", action: " << action
-            << ", new cwnd: " << new_cwnd << std::endl;
-  std::cout << "Action: " << reply.dump(4) << std::endl;
-  std::cout << "Sending response: " << std::endl;
-  std::cout << response << std::endl;
+  std::cout << "Flow " << data["flow_id"] << " action: " << action
+            << ", sending response: " << response << std::endl;
 #endif
-  auto len = socket_.send(boost::asio::buffer(response));
-  if (unlikely(len != response.length())) {
-    std::cerr << "UNIX Socket Send Error: " << len << " bytes sent, "
-              << response.length() << " bytes expected" << std::endl;
+  InferenceStats::Get()->serialize_us.record(steadyTime_microseconds() -
+                                             serialize_start_us);
+  deliver(std::move(response), info == "" ? received_us : 0);
+}
+
+void Session::deliver(std::string&& response, uint64_t received_us) {
+  bool post_flush = false;
+  {
+    std::lock_guard<std::mutex> lock(outbox_mutex_);
+    outbox_bytes_ += response.length();
+    outbox_.push_back({std::move(response), received_us});
+    while (outbox_bytes_ > kMaxQueuedBytes) {
+      // the oldest action but the newest reply; the client waits for the
+      // replies to START, so they stay
+      auto oldest = std::find_if(
+          outbox_.begin(), std::prev(outbox_.end()),
+          [](const QueuedReply& reply) { return reply.received_us != 0; });
+      if (oldest == std::prev(outbox_.end())) {
+        break;
+      }
+      outbox_bytes_ -= oldest->bytes.length();
+      outbox_.erase(oldest);
+      InferenceStats::Get()->replies_dropped.add();
+    }
+    // a burst flushes its replies at its end
+    if (not in_burst_ and not flushing_) {
+      flushing_ = post_flush = true;
+    }
+  }
+  if (post_flush) {
+    boost::asio::post(socket_.get_executor(),
+                      boost::bind(&Session::flush, shared_from_this()));
+  }
+}
+
+void Session::flush() {
+  {
+    std::lock_guard<std::mutex> lock(outbox_mutex_);
+    if (outbox_.empty()) {
+      flushing_ = false;
+      if (closing_) {
+        socket_.close();
+      }
+      return;
+    }
+    writing_.assign(std::make_move_iterator(outbox_.begin()),
+                    std::make_move_iterator(outbox_.end()));
+    outbox_.clear();
+    outbox_bytes_ = 0;
+  }
+  if (not socket_.is_open()) {
+    // the client is gone; so is the point of its replies
+    writing_.clear();
+    flush();
+    return;
+  }
+  std::vector<boost::asio::const_buffer> buffers;
+  buffers.reserve(writing_.size());
+  for (const auto& reply : writing_) {
+    buffers.push_back(boost::asio::buffer(reply.bytes));
+  }
+  write_start_us_ = steadyTime_microseconds();
+  boost::asio::async_write(
+      socket_, buffers,
+      boost::bind(&Session::handle_write, shared_from_this(),
+                  boost::asio::placeholders::error,
+                  boost::asio::placeholders::bytes_transferred()));
+}
+
+void Session::handle_write(const boost::system::error_code& error,
+                           std::size_t bytes_transferred) {
+  auto stats = InferenceStats::Get();
+  const uint64_t sent_us = steadyTime_microseconds();
+  stats->send_us.record(sent_us - write_start_us_);
+  if (unlikely(error)) {
+    std::cerr << "UNIX Socket Send Error: " << error.message() << ", "
+              << bytes_transferred << " bytes sent" << std::endl;
+    stats->send_errors.add();
+    boost::system::error_code ignored;
+    socket_.close(ignored);
+  } else {
+    for (const auto& reply : writing_) {
+      if (reply.received_us != 0) {
+        stats->replies.add();
+        stats->end_to_end_us.record(sent_us - reply.received_us);
+      }
+    }
+  }
+  writing_.clear();
+  flush();
+}
+
+void Session::close_when_flushed() {
+  std::lock_guard<std::mutex> lock(outbox_mutex_);
+  closing_ = true;
+  if (not flushing_) {
+    socket_.close();
   }
 }
@@ -1,68 +1,114 @@
 #ifndef UNIX_SOCKET_SERVER_HH
 #define UNIX_SOCKET_SERVER_HH
 
+#include <deque>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <boost/asio.hpp>
 #include <boost/bind.hpp>
 
 #include "server.hh"
 
-class UnixSocketServer;
-class Session : public std::enable_shared_from_this<Session>, Server {
+class Session;
+class UnixSocketServer : public Server {
  public:
-  Session(boost::asio::io_service& io_service);
-
-  boost::asio::local::stream_protocol::socket& socket();
+  friend class Session;
+  UnixSocketServer(boost::asio::io_service& io_service,
+                   const std::string& socket_path);
 
   virtual void start() override;
 
-  void set_udp_server(UnixSocketServer* server) { server_ = server; }
-
  protected:
   virtual void handle_flow_init(int& flow_id,
                                 ResponseCallback&& send_response) override;
   virtual void handle_congestion_control(
       int flow_id, json& data, ResponseCallback&& send_response) override;
 
-  virtual void handle_flow_removal(int flow_id) override;
-
  private:
-  void handle_read_length(const boost::system::error_code& error);
-  void handle_read_message(const boost::system::error_code& error,
-                           std::size_t expected_length);
-  void send_response(const json data, float action, const std::string& info);
+  void handle_accept(std::shared_ptr<Session> new_session,
+                     const boost::system::error_code& error);
 
  private:
-  boost::asio::local::stream_protocol::socket socket_;
-  std::array<char, 1024> recv_buffer_;
-  std::array<char, 2> message_length_buffer_;
-  uint16_t message_length_;
-  // per flow inference context
-  UnixSocketServer* server_;
+  boost::asio::io_service& io_service_;
+  boost::asio::local::stream_protocol::acceptor acceptor_;
 };
 
-class UnixSocketServer : public Server {
+/**
+ * One client connection. It carries the messages of one flow, or after a
+ * MUX message the tagged frames of many flows: then every read takes all
+ * the frames that have arrived.
+ *
+ * Replies never block the thread producing them (e.g. the batch inference
+ * thread): they are queued, and the I/O thread writes everything queued
+ * with one gather-write. The queue is bounded; a client that does not read
+ * loses its oldest actions, which it would discard as stale anyway. Replies
+ * to START are never dropped: the client waits for them.
+ *
+ * The flows live in the UnixSocketServer, shared by all its sessions; a
+ * session only moves their messages.
+ */
+class Session : public std::enable_shared_from_this<Session> {
  public:
-  friend class Session;
-  UnixSocketServer(boost::asio::io_service& io_service,
-                   const std::string& socket_path);
+  Session(boost::asio::io_service& io_service);
+  // disallow copy and assign
+  Session(const Session&) = delete;
+  Session& operator=(const Session&) = delete;
 
-  virtual void start() override;
+  boost::asio::local::stream_protocol::socket& socket();
 
- protected:
-  virtual void handle_flow_init(int& flow_id,
-                                ResponseCallback&& send_response) override {}
-  virtual void handle_congestion_control(
-      int flow_id, json& data, ResponseCallback&& send_response) override {}
+  void start();
+
+  void set_udp_server(UnixSocketServer* server) { server_ = server; }
 
  private:
-  void handle_accept(std::shared_ptr<Session> new_session,
-                     const boost::system::error_code& error);
+  void handle_read_length(const boost::system::error_code& error);
+  void handle_read_message(const boost::system::error_code& error,
+                           std::size_t expected_length);
+  void start_burst();
+  void handle_burst(const boost::system::error_code& error,
+                    std::size_t bytes_transferred);
+  /* returns whether the connection ends */
+  bool handle_message(const char* data, std::size_t length, uint32_t tag);
+  void send_response(uint32_t tag, const json data, uint64_t received_us,
+                     float action, const std::string& info,
+                     const StepTiming& timing);
+  /* `received_us` is 0 unless the reply carries an action */
+  void deliver(std::string&& response, uint64_t received_us);
+  /* on the I/O thread; writes what is queued unless a write is going on */
+  void flush();
+  void handle_write(const boost::system::error_code& error,
+                    std::size_t bytes_transferred);
+  /* close once the queued replies are written */
+  void close_when_flushed();
 
  private:
-  boost::asio::io_service& io_service_;
-  boost::asio::local::stream_protocol::acceptor acceptor_;
+  boost::asio::local::stream_protocol::socket socket_;
+  std::array<char, 1024> recv_buffer_;
+  std::array<char, 2> message_length_buffer_;
+  uint16_t message_length_;
+  bool mux_;
+  // tagged frames read, the first inbox_end_ bytes not yet parsed
+  std::vector<char> inbox_;
+  std::size_t inbox_end_;
+  struct QueuedReply {
+    std::string bytes;
+    uint64_t received_us;
+  };
+  std::mutex outbox_mutex_;
+  std::deque<QueuedReply> outbox_;
+  std::size_t outbox_bytes_;
+  // set while a flush is posted or a write is going on
+  bool flushing_;
+  // a burst is being parsed; its replies are flushed at its end
+  bool in_burst_;
+  bool closing_;
+  // replies of the write going on (I/O thread only)
+  std::vector<QueuedReply> writing_;
+  uint64_t write_start_us_;
+  // handles the messages, with the flows of every session
+  UnixSocketServer* server_;
 };
 
 #endif  // UNIX_SOCKET_SERVER_HH
\ No newline at end of file
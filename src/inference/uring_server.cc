@@ -0,0 +1,409 @@
+#include "uring_server.hh"
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include "current_time.hh"
+#include "exception.hh"
+#include "inference_service.hh"
+#include "ipc_socket.hh"
+#include "serialization.hh"
+#include "stats.hh"
+
+/* user_data: the kind of operation in the top byte, e.g. the fd below */
+enum Operation : uint64_t { RECEIVE = 1, ACCEPT, CONNECTION, WAKE, SEND };
+
+static uint64_t tag(Operation operation, uint64_t value = 0) {
+  return uint64_t(operation) << 56 | value;
+}
+
+/* the registered fds */
+static const int kSocket = 0;
+static const int kWake = 1;
+
+static const uint16_t kBufferGroup = 0;
+
+static std::unique_ptr<FileDescriptor> make_socket(
+    const bool udp, const std::string& socket_path) {
+  if (udp) {
+    // not UDPSocket: its header clashes with boost's <netinet/tcp.h>
+    auto socket = std::make_unique<FileDescriptor>(
+        SystemCall("socket", ::socket(AF_INET, SOCK_DGRAM, 0)));
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(PORT);
+    SystemCall("bind", ::bind(socket->fd_num(),
+                              reinterpret_cast<sockaddr*>(&address),
+                              sizeof(address)));
+    return socket;
+  }
+  auto socket = std::make_unique<IPCSocket>();
+  socket->bind(socket_path);
+  socket->listen();
+  return socket;
+}
+
+UringServer::UringServer(const std::string& channel,
+                         const std::string& socket_path)
+    : Server(),
+      udp_(channel == "udp"),
+      socket_(),
+      wake_(SystemCall("eventfd", eventfd(0, EFD_CLOEXEC))),
+      ring_(1024),
+      buffers_(ring_, kBufferGroup, 512, 4096),
+      receive_header_(),
+      wake_count_(0),
+      loop_thread_(),
+      connections_(),
+      next_generation_(0),
+      queue_mutex_(),
+      queue_(),
+      sending_(),
+      next_reply_(0) {
+  if (channel != "udp" and channel != "unix") {
+    throw std::runtime_error("Unknown communication channel: " + channel);
+  }
+  socket_ = make_socket(udp_, socket_path);
+  const int fds[2] = {socket_->fd_num(), wake_.fd_num()};
+  ring_.register_files(fds, 2);
+  receive_header_.msg_namelen = sizeof(sockaddr_in);
+}
+
+void UringServer::start() {
+  loop_thread_ = std::this_thread::get_id();
+  if (udp_) {
+    arm_receive();
+  } else {
+    arm_accept();
+  }
+  arm_wake();
+  while (true) {
+    // replies queued last round go out with the wait for the next requests
+    ring_.submit(1);
+    ring_.drain([this](const io_uring_cqe& cqe) { handle_completion(cqe); });
+    flush_replies();
+  }
+}
+
+void UringServer::arm_receive() {
+  ring_.prep_recvmsg_multishot(kSocket, &receive_header_, kBufferGroup,
+                               tag(RECEIVE))
+      .flags |= IOSQE_FIXED_FILE;
+}
+
+void UringServer::arm_accept() {
+  ring_.prep_accept_multishot(kSocket, tag(ACCEPT)).flags |= IOSQE_FIXED_FILE;
+}
+
+void UringServer::arm_connection(const int fd) {
+  ring_.prep_recv_multishot(fd, kBufferGroup, tag(CONNECTION, fd));
+}
+
+void UringServer::arm_wake() {
+  ring_.prep_read(kWake, &wake_count_, sizeof(wake_count_), tag(WAKE)).flags |=
+      IOSQE_FIXED_FILE;
+}
+
+void UringServer::handle_completion(const io_uring_cqe& cqe) {
+  if (cqe.user_data == BufferGroup::PROVIDE_TAG) {
+    std::cerr << "Providing buffers failed: " << strerror(-cqe.res)
+              << std::endl;
+    return;
+  }
+  const Operation operation = Operation(cqe.user_data >> 56);
+  const uint64_t value = cqe.user_data & ((uint64_t(1) << 56) - 1);
+  // multishot operations end without IORING_CQE_F_MORE, e.g. on ENOBUFS
+  const bool more = cqe.flags & IORING_CQE_F_MORE;
+
+  switch (operation) {
+  case RECEIVE:
+    if (cqe.flags & IORING_CQE_F_BUFFER) {
+      const uint16_t id = BufferGroup::buffer_id(cqe);
+      handle_datagram(buffers_.buffer(id));
+      buffers_.recycle(id);
+    } else if (cqe.res < 0 and cqe.res != -ENOBUFS) {
+      std::cerr << "UDP receive error: " << strerror(-cqe.res) << std::endl;
+    }
+    if (not more) {
+      arm_receive();
+    }
+    break;
+  case ACCEPT:
+    if (cqe.res >= 0) {
+      Connection& connection = connections_[cqe.res] = Connection();
+      connection.generation = ++next_generation_;
+      arm_connection(cqe.res);
+    } else {
+      std::cerr << "Accept error: " << strerror(-cqe.res) << std::endl;
+    }
+    if (not more) {
+      arm_accept();
+    }
+    break;
+  case CONNECTION: {
+    const int fd = value;
+    if (cqe.flags & IORING_CQE_F_BUFFER) {
+      const uint16_t id = BufferGroup::buffer_id(cqe);
+      handle_stream(fd, buffers_.buffer(id), cqe.res);
+      buffers_.recycle(id);
+    }
+    if (more) {
+      break;
+    }
+    if (cqe.res == -ENOBUFS or cqe.res > 0) {
+      arm_connection(fd);
+    } else {
+      // closed by the client, or cancelled after END
+      connections_.erase(fd);
+      ::close(fd);
+    }
+    break;
+  }
+  case WAKE:
+    arm_wake();
+    break;
+  case SEND:
+    finish_reply(value, cqe.res);
+    break;
+  default:
+    break;
+  }
+}
+
+void UringServer::handle_datagram(const char* buffer) {
+  const auto* out = reinterpret_cast<const io_uring_recvmsg_out*>(buffer);
+  if (out->flags & MSG_TRUNC) {
+    std::cout << "Incomplete message received" << std::endl;
+    return;
+  }
+  sockaddr_in peer{};
+  memcpy(&peer, buffer + sizeof(*out),
+         std::min<size_t>(out->namelen, sizeof(peer)));
+  const char* payload = buffer + sizeof(*out) + receive_header_.msg_namelen +
+                        receive_header_.msg_controllen;
+  // a datagram is one whole message
+  if (out->payloadlen < 2 or
+      get_uint16(payload) != out->payloadlen - 2) {
+    std::cout << "Incomplete message received" << std::endl;
+    return;
+  }
+  Origin origin;
+  origin.peer = peer;
+  handle_message(payload + 2, out->payloadlen - 2, origin);
+}
+
+void UringServer::handle_stream(const int fd, const char* data,
+                                size_t length) {
+  Connection& connection = connections_[fd];
+  std::string& partial = connection.partial;
+  if (not partial.empty()) {
+    partial.append(data, length);
+    data = partial.data();
+    length = partial.size();
+  }
+  // whole messages are parsed from the receive buffer in place
+  size_t offset = 0;
+  while (true) {
+    // a MUX message switches the framing of what follows
+    const size_t header = connection.mux ? MUX_HEADER_SIZE : 2;
+    if (length - offset < header) {
+      break;
+    }
+    const uint16_t message_length = get_uint16(data + offset);
+    if (length - offset - header < message_length) {
+      break;
+    }
+    Origin origin;
+    origin.fd = fd;
+    origin.generation = connection.generation;
+    origin.mux = connection.mux;
+    origin.tag = connection.mux ? get_uint32(data + offset + 2) : 0;
+    handle_message(data + offset + header, message_length, origin);
+    offset += header + message_length;
+  }
+  const std::string rest(data + offset, length - offset);
+  partial = rest;
+}
+
+void UringServer::handle_message(const char* data, const size_t length,
+                                 Origin origin) {
+  const uint64_t received_us = steadyTime_microseconds();
+  json message = json::parse(data, data + length);
+#ifdef DEBUG
+  std::cout << "Received message: " << std::endl;
+  std::cout << message.dump(4) << std::endl;
+#endif
+  MessageType type = message.at("type");
+  if (type == MessageType::MUX) {
+    if (origin.fd >= 0) {
+      connections_[origin.fd].mux = true;
+    }
+    return;
+  }
+  int flow_id = message.at("flow_id");
+  ResponseCallback send_response =
+      std::bind(&UringServer::send_response, this, origin, message,
+                received_us, std::placeholders::_1, std::placeholders::_2,
+                std::placeholders::_3);
+  switch (type) {
+  case MessageType::START: {
+    std::cout << "Register flow " << flow_id << std::endl;
+    InferenceStats::Get()->flows_started.add();
+    handle_flow_init(flow_id, std::move(send_response));
+    break;
+  }
+  case MessageType::ALIVE: {
+    InferenceStats::Get()->requests.add();
+    handle_congestion_control(flow_id, message, std::move(send_response));
+    break;
+  }
+  case MessageType::END: {
+    std::cout << "Remove flow " << flow_id << std::endl;
+    InferenceStats::Get()->flows_ended.add();
+    handle_flow_removal(flow_id);
+    if (origin.fd >= 0 and not origin.mux) {
+      // the receive ends, and then the connection is closed
+      ring_.prep_cancel(tag(CONNECTION, origin.fd), 0);
+    }
+    break;
+  }
+  default:
+    break;
+  }
+}
+
+void UringServer::handle_flow_init(int& flow_id,
+                                   ResponseCallback&& send_response) {
+  // the client goes on with the id issued here
+  flow_id = open_flow();
+  json reply;
+  reply["flow_id"] = flow_id;
+  send_response(-1, reply.dump(), StepTiming());
+}
+
+void UringServer::handle_congestion_control(
+    int flow_id, json& data, ResponseCallback&& send_response) {
+  FlowContext* context = touch_flow(flow_id);
+  if (unlikely(context == nullptr)) {
+    std::cerr << "Flow " << flow_id << " does not exist" << std::endl;
+    InferenceStats::Get()->unknown_flows.add();
+    return;
+  }
+  auto state = context->format_state(data["state"]);
+  if (skip_decision(context, data["state"], send_response)) {
+    return;
+  }
+  InferenceService::Get()->decide(std::move(state), std::move(send_response));
+}
+
+void UringServer::send_response(const Origin& origin, const json& data,
+                                uint64_t received_us, float action,
+                                const std::string& info,
+                                const StepTiming& timing) {
+  const uint64_t serialize_start_us = steadyTime_microseconds();
+  const bool is_action = info == "";
+  const std::string message =
+      is_action ? make_action_reply(data, action, received_us, timing) : info;
+  Reply reply;
+  reply.origin = origin;
+  if (origin.mux) {
+    reply.message.resize(MUX_HEADER_SIZE);
+    put_mux_header(message.length(), origin.tag, reply.message.data());
+    reply.message += message;
+  } else {
+    reply.message = put_field(message.length()) + message;
+  }
+  reply.received_us.push_back(is_action ? received_us : 0);
+  reply.queued_us = steadyTime_microseconds();
+  InferenceStats::Get()->serialize_us.record(reply.queued_us -
+                                             serialize_start_us);
+
+  bool wake = false;
+  {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    wake = queue_.empty() and std::this_thread::get_id() != loop_thread_;
+    queue_.push_back(std::move(reply));
+  }
+  if (wake) {
+    // the loop is waiting in the kernel; later replies ride along
+    const uint64_t one = 1;
+    SystemCall("write eventfd", ::write(wake_.fd_num(), &one, sizeof(one)));
+  }
+}
+
+void UringServer::flush_replies() {
+  std::vector<Reply> replies;
+  {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    replies.swap(queue_);
+  }
+  // one send per connection, in the order of the replies
+  std::unordered_map<int, Reply*> by_connection;
+  for (Reply& queued : replies) {
+    if (queued.origin.fd < 0) {
+      const uint64_t id = next_reply_++;
+      Reply& reply = sending_[id] = std::move(queued);
+      reply.iov = {reply.message.data(), reply.message.size()};
+      reply.header.msg_name = &reply.origin.peer;
+      reply.header.msg_namelen = sizeof(reply.origin.peer);
+      reply.header.msg_iov = &reply.iov;
+      reply.header.msg_iovlen = 1;
+      ring_.prep_sendmsg(kSocket, &reply.header, tag(SEND, id)).flags |=
+          IOSQE_FIXED_FILE;
+      continue;
+    }
+    // the connection may have closed, and its fd gone to a new one
+    auto connection = connections_.find(queued.origin.fd);
+    if (connection == connections_.end() or
+        connection->second.generation != queued.origin.generation) {
+      InferenceStats::Get()->replies_dropped.add();
+      continue;
+    }
+    auto it = by_connection.find(queued.origin.fd);
+    if (it == by_connection.end()) {
+      by_connection[queued.origin.fd] = &queued;
+      continue;
+    }
+    it->second->message += queued.message;
+    it->second->received_us.push_back(queued.received_us.front());
+  }
+  for (auto& [fd, merged] : by_connection) {
+    const uint64_t id = next_reply_++;
+    Reply& reply = sending_[id] = std::move(*merged);
+    ring_.prep_send(fd, reply.message.data(), reply.message.size(),
+                    tag(SEND, id));
+  }
+}
+
+void UringServer::finish_reply(const uint64_t id, const int result) {
+  auto it = sending_.find(id);
+  if (it == sending_.end()) {
+    return;
+  }
+  const Reply& reply = it->second;
+  auto stats = InferenceStats::Get();
+  const uint64_t sent_us = steadyTime_microseconds();
+  // includes the wait for the round that submits it
+  stats->send_us.record(sent_us - reply.queued_us);
+  if (unlikely(result < 0 or size_t(result) != reply.message.length())) {
+    std::cerr << (reply.origin.fd >= 0 ? "UNIX Socket" : "UDP")
+              << " Send Error: "
+              << (result < 0 ? strerror(-result)
+                             : std::to_string(result) + " bytes sent")
+              << std::endl;
+    stats->send_errors.add();
+  } else {
+    for (const uint64_t received_us : reply.received_us) {
+      if (received_us != 0) {
+        stats->replies.add();
+        stats->end_to_end_us.record(sent_us - received_us);
+      }
+    }
+  }
+  sending_.erase(it);
+}
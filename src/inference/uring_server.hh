@@ -0,0 +1,112 @@
+#ifndef URING_SERVER_HH
+#define URING_SERVER_HH
+
+#include <netinet/in.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "file_descriptor.hh"
+#include "io_uring.hh"
+#include "server.hh"
+
+/**
+ * @brief The udp or unix channel served from one io_uring.
+ *
+ * Requests arrive through one multishot receive (udp), or one multishot
+ * accept and a multishot receive per connection (unix), into buffers
+ * provided to the kernel, so a request costs no syscall of its own.
+ * Replies are queued, also from the batch inference thread, and handed to
+ * the kernel together in the syscall that waits for the next requests; the
+ * replies to one connection go out in one send.
+ */
+class UringServer : public Server {
+ public:
+  /* `channel` is "udp" (port PORT) or "unix" (socket at `socket_path`) */
+  UringServer(const std::string& channel, const std::string& socket_path);
+
+  UringServer(const UringServer&) = delete;
+  UringServer& operator=(const UringServer&) = delete;
+
+  /* serve forever on the calling thread */
+  virtual void start() override;
+
+ protected:
+  virtual void handle_flow_init(int& flow_id,
+                                ResponseCallback&& send_response) override;
+  virtual void handle_congestion_control(
+      int flow_id, json& data, ResponseCallback&& send_response) override;
+
+ private:
+  // where a request came from, and so where its reply goes
+  struct Origin {
+    // connection, or -1 for a datagram from `peer`
+    int fd = -1;
+    // of the connection: once it closes, its fd goes to the next one
+    uint64_t generation = 0;
+    sockaddr_in peer{};
+    // tagged frames (MUX), with the tag of the request
+    bool mux = false;
+    uint32_t tag = 0;
+  };
+
+  // replies being sent; the kernel reads them in place
+  struct Reply {
+    Origin origin{};
+    msghdr header{};
+    iovec iov{};
+    std::string message{};
+    // one per reply in `message`; 0 unless it carries an action
+    std::vector<uint64_t> received_us{};
+    uint64_t queued_us = 0;
+  };
+
+  struct Connection {
+    // bytes of a message split across receives
+    std::string partial{};
+    bool mux = false;
+    uint64_t generation = 0;
+  };
+
+  void arm_receive();
+  void arm_accept();
+  void arm_connection(const int fd);
+  void arm_wake();
+
+  void handle_completion(const io_uring_cqe& cqe);
+  void handle_datagram(const char* buffer);
+  void handle_stream(const int fd, const char* data, size_t length);
+  void handle_message(const char* data, const size_t length,
+                      Origin origin);
+  void send_response(const Origin& origin, const json& data,
+                     uint64_t received_us, float action,
+                     const std::string& info, const StepTiming& timing);
+  void flush_replies();
+  void finish_reply(const uint64_t id, const int result);
+
+ private:
+  bool udp_;
+  std::unique_ptr<FileDescriptor> socket_;
+  FileDescriptor wake_;
+  IOUring ring_;
+  BufferGroup buffers_;
+  // header of the multishot recvmsg: room for the source address
+  msghdr receive_header_;
+  uint64_t wake_count_;
+  std::thread::id loop_thread_;
+
+  std::unordered_map<int, Connection> connections_;
+  uint64_t next_generation_;
+
+  std::mutex queue_mutex_;
+  std::vector<Reply> queue_;
+  // in flight, by id; the nodes do not move
+  std::unordered_map<uint64_t, Reply> sending_;
+  uint64_t next_reply_;
+};
+
+#endif  // URING_SERVER_HH
@@ -0,0 +1,480 @@
+#include <getopt.h>
+#include <signal.h>
+#include <sys/epoll.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "control_interval.hh"
+#include "current_time.hh"
+#include "deepcc_backend.hh"
+#include "exception.hh"
+#include "histogram.hh"
+#include "inference_transport.hh"
+#include "json.hpp"
+#include "logging.hh"
+#include "tcp_info.hh"
+
+using namespace std;
+using json = nlohmann::json;
+
+/* define message type */
+enum class MessageType {
+  INIT = 0,
+  START = 1,
+  END = 2,
+  ALIVE = 3,
+  OBSERVE = 4,
+  MUX = 5
+};
+
+template <typename E>
+constexpr typename std::underlying_type<E>::type to_underlying(E e) noexcept {
+  return static_cast<typename std::underlying_type<E>::type>(e);
+}
+
+std::atomic<bool> running(true);
+
+void signal_handler(int) { running = false; }
+
+/* produces the TCP state of one flow at every control step */
+class StateSource {
+ public:
+  virtual ~StateSource() {}
+  /* `cwnd` is the window last assigned by the inference service */
+  virtual json next(uint32_t cwnd) = 0;
+};
+
+/**
+ * Closed-loop toy path: a bottleneck of random capacity and base RTT with
+ * one BDP of buffer. Queueing delay, throughput and losses follow the cwnd
+ * assigned by the service, so the model sees plausible inputs.
+ */
+class SyntheticState : public StateSource {
+ public:
+  SyntheticState(mt19937& rng, uint64_t interval_us)
+      : rng_(rng),
+        interval_us_(interval_us),
+        capacity_pps_(uniform_real_distribution<double>(500, 20000)(rng)),
+        base_rtt_us_(uniform_int_distribution<uint32_t>(5000, 150000)(rng)),
+        max_tput_(0) {}
+
+  json next(uint32_t cwnd) override {
+    static constexpr uint32_t kMss = 1448;
+    const double bdp = capacity_pps_ * base_rtt_us_ / 1e6;
+    const double queue = max(0.0, cwnd - bdp);
+    const double dropped = max(0.0, queue - bdp);
+    normal_distribution<double> noise(1.0, 0.05);
+    const double rtt_us =
+        (base_rtt_us_ + min(queue, bdp) / capacity_pps_ * 1e6) *
+        max(0.5, noise(rng_));
+    const double tput_pps = min(capacity_pps_, cwnd / rtt_us * 1e6);
+
+    TCPDeepCCInfo info;
+    info.init();
+    info.min_rtt = base_rtt_us_;
+    info.avg_urtt = rtt_us;
+    info.cnt = max(1.0, tput_pps * interval_us_ / 1e6);
+    info.avg_thr = tput_pps * kMss;
+    info.thr_cnt = info.cnt;
+    info.cwnd = cwnd;
+    info.pacing_rate = min<double>(UINT32_MAX, tput_pps * kMss);
+    info.lost_bytes = dropped * kMss;
+    info.srtt_us = static_cast<u32>(rtt_us) << 3;
+    info.snd_ssthresh = cwnd;
+    info.packets_out = cwnd;
+    info.retrans_out = dropped;
+    info.max_packets_out = cwnd;
+    info.mss = kMss;
+    max_tput_ = max<uint64_t>(max_tput_, info.avg_thr);
+    return deepcc_state_json(info, max_tput_, interval_us_);
+  }
+
+ private:
+  mt19937& rng_;
+  uint64_t interval_us_;
+  double capacity_pps_;
+  uint32_t base_rtt_us_;
+  uint64_t max_tput_;
+};
+
+/* open-loop replay of a recorded flow; the assigned cwnd is ignored */
+class ReplayState : public StateSource {
+ public:
+  ReplayState(const vector<TCPDeepCCInfo>& recorded, size_t offset,
+              uint64_t interval_us)
+      : rows_(recorded),
+        next_(offset % rows_.size()),
+        interval_us_(interval_us),
+        max_tput_(0) {}
+
+  json next(uint32_t) override {
+    const TCPDeepCCInfo& info = rows_[next_];
+    next_ = (next_ + 1) % rows_.size();
+    max_tput_ = max<uint64_t>(max_tput_, info.avg_thr);
+    return deepcc_state_json(info, max_tput_, interval_us_);
+  }
+
+ private:
+  const vector<TCPDeepCCInfo>& rows_;
+  size_t next_;
+  uint64_t interval_us_;
+  uint64_t max_tput_;
+};
+
+struct Flow {
+  // null when the flows share a MuxTransport; the tag is the flow's index
+  unique_ptr<InferenceTransport> transport{};
+  unique_ptr<StateSource> source{};
+  // issued by the server at START
+  int flow_id = -1;
+  uint32_t cwnd = 10;
+  int step = 0;
+  // step awaiting a reply, or 0
+  int pending_step = 0;
+  uint64_t sent_us = 0;
+  // of the last state sent; sets the adaptive interval
+  uint64_t srtt_us = 0;
+};
+
+struct Report {
+  Histogram latency_us{};
+  uint64_t requests = 0;
+  uint64_t decisions = 0;
+  uint64_t late = 0;
+  uint64_t stale = 0;
+  uint64_t errors = 0;
+};
+
+/* over `mux`, the message is only queued */
+void send_message(Flow& flow, size_t index, MuxTransport* mux,
+                  const json& message) {
+  if (mux) {
+    mux->queue(index, message.dump());
+  } else {
+    flow.transport->send_message(message.dump());
+  }
+}
+
+void send_alive(Flow& flow, size_t index, MuxTransport* mux,
+                Report& report) {
+  json message;
+  message["type"] = to_underlying(MessageType::ALIVE);
+  message["flow_id"] = flow.flow_id;
+  message["step"] = ++flow.step;
+  message["state"] = flow.source->next(flow.cwnd);
+  flow.srtt_us = ControlInterval::srtt_us(message["state"]);
+  flow.sent_us = steadyTime_microseconds();
+  send_message(flow, index, mux, message);
+  flow.pending_step = flow.step;
+  report.requests++;
+}
+
+void handle_reply(Flow& flow, string_view message, Report& report) {
+  const uint64_t now = steadyTime_microseconds();
+  json reply = json::parse(message.begin(), message.end());
+  const int step = reply.value("step", flow.pending_step);
+  if (step != flow.pending_step or flow.pending_step == 0) {
+    report.stale++;
+    return;
+  }
+  flow.cwnd = max(1, reply.at("cwnd").get<int>());
+  flow.pending_step = 0;
+  report.decisions++;
+  report.latency_us.record(now - flow.sent_us);
+}
+
+/* epoll token of the multiplexed connection */
+static const uint64_t kMuxEvent = UINT64_MAX;
+
+/* every reply that has arrived on the multiplexed connection */
+void handle_mux_replies(MuxTransport& mux, vector<Flow>& flows,
+                        Report& report) {
+  try {
+    mux.receive();
+    uint32_t tag;
+    string_view message;
+    while (mux.next(tag, message)) {
+      if (tag >= flows.size()) {
+        report.errors++;
+        continue;
+      }
+      try {
+        handle_reply(flows[tag], message, report);
+      } catch (const exception& e) {
+        report.errors++;
+        LOG(WARNING) << "Flow " << flows[tag].flow_id << ": " << e.what();
+      }
+    }
+  } catch (const exception& e) {
+    report.errors++;
+    LOG(WARNING) << "Multiplexed connection: " << e.what();
+  }
+}
+
+void print_report(const Report& report, double seconds, size_t flows) {
+  const HistogramSnapshot latency = report.latency_us.snapshot();
+  cout << fixed << setprecision(1);
+  cout << "flows:         " << flows << "\n"
+       << "duration:      " << seconds << " s\n"
+       << "requests:      " << report.requests << "\n"
+       << "decisions:     " << report.decisions << " ("
+       << report.decisions / seconds << " /s)\n"
+       << "late replies:  " << report.late << "\n"
+       << "stale replies: " << report.stale << "\n"
+       << "errors:        " << report.errors << "\n"
+       << "latency (us):  mean " << latency.mean() << ", p50 "
+       << latency.percentile(0.5) << ", p99 " << latency.percentile(0.99)
+       << ", p999 " << latency.percentile(0.999) << ", max "
+       << latency.max() << endl;
+}
+
+void usage_error(const string& program_name) {
+  cerr << "Usage: " << program_name << " [OPTION]..." << endl;
+  cerr << endl;
+  cerr << "Options = --channel=unix|udp --target=PATH|HOST:PORT --flows=N "
+          "--interval=MS --duration=SECONDS --replay=PERF_LOG --seed=N "
+          "--mux --adaptive-interval=MULTIPLIER[:MIN_MS:MAX_MS]"
+       << endl;
+  cerr << endl;
+  cerr << "Simulates N flows against a running infer service and reports "
+          "decisions per second and reply latency." << endl
+       << "Default channel is unix (/tmp/astraea.sock); " << endl
+       << "Default is 100 flows, 20ms interval, 10s; " << endl
+       << "States are synthetic unless --replay gives a client perf log; "
+       << endl
+       << "--mux carries every flow over one unix connection; " << endl
+       << "--adaptive-interval steps each flow every MULTIPLIER smoothed "
+          "RTTs, within [MIN_MS, MAX_MS] (default 5 and 200); "
+       << endl;
+
+  throw runtime_error("invalid arguments");
+}
+
+int main(int argc, char** argv) {
+  signal(SIGTERM, signal_handler);
+  signal(SIGINT, signal_handler);
+  signal(SIGPIPE, SIG_IGN);
+
+  const option command_line_options[] = {
+      {"channel", required_argument, nullptr, 'h'},
+      {"target", required_argument, nullptr, 'a'},
+      {"flows", required_argument, nullptr, 'n'},
+      {"interval", required_argument, nullptr, 't'},
+      {"duration", required_argument, nullptr, 'd'},
+      {"replay", required_argument, nullptr, 'r'},
+      {"seed", required_argument, nullptr, 's'},
+      {"mux", no_argument, nullptr, 'm'},
+      {"adaptive-interval", required_argument, nullptr, 'v'},
+      {0, 0, nullptr, 0}};
+
+  string channel = "unix", target, replay_path, adaptive_interval;
+  size_t num_flows = 100;
+  uint64_t interval_us = 20000;
+  double duration = 10;
+  unsigned seed = 1;
+  bool multiplex = false;
+  while (true) {
+    const int opt = getopt_long(argc, argv, "", command_line_options, nullptr);
+    if (opt == -1) { /* end of options */
+      break;
+    }
+    switch (opt) {
+    case 'h':
+      channel = optarg;
+      break;
+    case 'a':
+      target = optarg;
+      break;
+    case 'n':
+      num_flows = stoul(optarg);
+      break;
+    case 't':
+      interval_us = stod(optarg) * 1000;
+      break;
+    case 'd':
+      duration = stod(optarg);
+      break;
+    case 'r':
+      replay_path = optarg;
+      break;
+    case 's':
+      seed = stoul(optarg);
+      break;
+    case 'm':
+      multiplex = true;
+      break;
+    case 'v':
+      adaptive_interval = optarg;
+      break;
+    default:
+      usage_error(argv[0]);
+    }
+  }
+  if (num_flows == 0 or interval_us == 0 or
+      (multiplex and channel != "unix")) {
+    usage_error(argv[0]);
+  }
+
+  ControlInterval intervals(interval_us);
+  if (not adaptive_interval.empty()) {
+    intervals.set_adaptive(adaptive_interval);
+  }
+
+  mt19937 rng(seed);
+  /* rows of a client --perf-log, shared by every replaying flow */
+  vector<TCPDeepCCInfo> recorded;
+  if (not replay_path.empty()) {
+    recorded = read_recorded_deepcc_info(replay_path);
+    LOG(INFO) << "Replaying " << recorded.size() << " recorded steps";
+  }
+
+  /* register every flow; START is answered synchronously */
+  vector<Flow> flows(num_flows);
+  unique_ptr<MuxTransport> mux;
+  if (multiplex) {
+    mux = make_unique<MuxTransport>(target.empty() ? "/tmp/astraea.sock"
+                                                   : target);
+  }
+  FileDescriptor epoll_fd(SystemCall("epoll_create1", epoll_create1(0)));
+  for (size_t i = 0; i < num_flows; i++) {
+    Flow& flow = flows[i];
+    json start;
+    start["type"] = to_underlying(MessageType::START);
+    start["flow_id"] = static_cast<int>(i);
+    if (mux) {
+      // the replies are collected below, in one round trip for all
+      send_message(flow, i, mux.get(), start);
+    } else {
+      flow.transport = InferenceTransport::connect(channel, target);
+      flow.transport->send_message(start.dump());
+      flow.flow_id =
+          json::parse(flow.transport->recv_message()).at("flow_id");
+    }
+    if (not recorded.empty()) {
+      flow.source.reset(new ReplayState(
+          recorded, i * recorded.size() / num_flows, interval_us));
+    } else {
+      flow.source.reset(new SyntheticState(rng, interval_us));
+    }
+    if (mux) {
+      continue;
+    }
+    epoll_event ev = {};
+    ev.events = EPOLLIN;
+    ev.data.u64 = i;
+    SystemCall("epoll_ctl", epoll_ctl(epoll_fd.fd_num(), EPOLL_CTL_ADD,
+                                      flow.transport->fd_num(), &ev));
+  }
+  if (mux) {
+    mux->flush();
+    for (size_t registered = 0; registered < num_flows; registered++) {
+      uint32_t tag;
+      const string_view reply = mux->recv_view(tag);
+      flows.at(tag).flow_id =
+          json::parse(reply.begin(), reply.end()).at("flow_id");
+    }
+    epoll_event ev = {};
+    ev.events = EPOLLIN;
+    ev.data.u64 = kMuxEvent;
+    SystemCall("epoll_ctl", epoll_ctl(epoll_fd.fd_num(), EPOLL_CTL_ADD,
+                                      mux->fd_num(), &ev));
+  }
+  LOG(INFO) << "Registered " << num_flows << " flows over " << channel
+            << (mux ? " (multiplexed)" : "") << ", control interval is "
+            << intervals.to_string();
+
+  /* ticks are spread evenly over one interval */
+  using Tick = pair<uint64_t, size_t>;
+  priority_queue<Tick, vector<Tick>, greater<Tick>> ticks;
+  const uint64_t started_us = steadyTime_microseconds();
+  for (size_t i = 0; i < num_flows; i++) {
+    ticks.push({started_us + interval_us * i / num_flows, i});
+  }
+  const uint64_t end_us = started_us + duration * 1e6;
+
+  Report report;
+  vector<epoll_event> events(min<size_t>(num_flows, 1024));
+  while (running and steadyTime_microseconds() < end_us) {
+    const uint64_t now = steadyTime_microseconds();
+    while (not ticks.empty() and ticks.top().first <= now) {
+      const size_t i = ticks.top().second;
+      const uint64_t due = ticks.top().first;
+      ticks.pop();
+      Flow& flow = flows[i];
+      if (flow.pending_step != 0) {
+        /* the last decision did not arrive within one interval */
+        report.late++;
+      }
+      try {
+        send_alive(flow, i, mux.get(), report);
+      } catch (const exception& e) {
+        report.errors++;
+        LOG(WARNING) << "Flow " << flow.flow_id << ": " << e.what();
+      }
+      ticks.push({due + intervals.next_us(flow.srtt_us), i});
+    }
+    if (mux) {
+      // the requests of this round in one write
+      try {
+        mux->flush();
+      } catch (const exception& e) {
+        report.errors++;
+        LOG(WARNING) << "Multiplexed connection: " << e.what();
+      }
+    }
+
+    const uint64_t wait_us =
+        ticks.top().first > now ? ticks.top().first - now : 0;
+    const int n = epoll_wait(epoll_fd.fd_num(), events.data(), events.size(),
+                             (wait_us + 999) / 1000);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw unix_error("epoll_wait");
+    }
+    for (int k = 0; k < n; k++) {
+      if (events[k].data.u64 == kMuxEvent) {
+        handle_mux_replies(*mux, flows, report);
+        continue;
+      }
+      Flow& flow = flows[events[k].data.u64];
+      try {
+        handle_reply(flow, flow.transport->recv_view(), report);
+      } catch (const exception& e) {
+        report.errors++;
+        LOG(WARNING) << "Flow " << flow.flow_id << ": " << e.what();
+      }
+    }
+  }
+  const double elapsed = (steadyTime_microseconds() - started_us) / 1e6;
+
+  for (size_t i = 0; i < num_flows; i++) {
+    json end;
+    end["type"] = to_underlying(MessageType::END);
+    end["flow_id"] = flows[i].flow_id;
+    try {
+      send_message(flows[i], i, mux.get(), end);
+    } catch (const exception& e) {
+      LOG(WARNING) << "Flow " << flows[i].flow_id << ": " << e.what();
+    }
+  }
+  if (mux) {
+    try {
+      mux->flush();
+    } catch (const exception& e) {
+      LOG(WARNING) << "Multiplexed connection: " << e.what();
+    }
+  }
+
+  print_report(report, elapsed, num_flows);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,159 @@
+#include "async_logger.hh"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+/* how long the writer sleeps when every ring is empty */
+static constexpr auto kIdleSleep = std::chrono::milliseconds(1);
+
+void LogRing::copy_in(uint64_t pos, const char* src, size_t len) {
+  const size_t offset = pos & (kCapacity - 1);
+  const size_t first = std::min(len, kCapacity - offset);
+  std::memcpy(buf_ + offset, src, first);
+  std::memcpy(buf_, src + first, len - first);
+}
+
+void LogRing::copy_out(uint64_t pos, char* dst, size_t len) const {
+  const size_t offset = pos & (kCapacity - 1);
+  const size_t first = std::min(len, kCapacity - offset);
+  std::memcpy(dst, buf_ + offset, first);
+  std::memcpy(dst + first, buf_, len - first);
+}
+
+bool LogRing::push(const char* data, uint32_t len) {
+  const uint64_t head = head_.load(std::memory_order_relaxed);
+  const uint64_t tail = tail_.load(std::memory_order_acquire);
+  const size_t needed = sizeof(len) + len;
+  if (kCapacity - (head - tail) < needed) {
+    return false;
+  }
+  copy_in(head, reinterpret_cast<const char*>(&len), sizeof(len));
+  copy_in(head + sizeof(len), data, len);
+  head_.store(head + needed, std::memory_order_release);
+  return true;
+}
+
+size_t LogRing::drain(std::string& out) {
+  const uint64_t head = head_.load(std::memory_order_acquire);
+  uint64_t tail = tail_.load(std::memory_order_relaxed);
+  const size_t before = out.size();
+  while (tail < head) {
+    uint32_t len;
+    copy_out(tail, reinterpret_cast<char*>(&len), sizeof(len));
+    const size_t at = out.size();
+    out.resize(at + len);
+    copy_out(tail + sizeof(len), &out[at], len);
+    tail += sizeof(len) + len;
+  }
+  tail_.store(tail, std::memory_order_release);
+  return out.size() - before;
+}
+
+AsyncLogger* AsyncLogger::Get() {
+  /* never destroyed: detached threads may still log during exit */
+  static AsyncLogger* logger = new AsyncLogger();
+  return logger;
+}
+
+AsyncLogger::AsyncLogger() {
+  if (not LogAsyncFromEnv()) {
+    return;
+  }
+  running_.store(true, std::memory_order_release);
+  writer_ = std::thread(&AsyncLogger::writer_loop, this);
+  std::atexit([]() { AsyncLogger::Get()->stop(); });
+}
+
+LogRing& AsyncLogger::local_ring() {
+  /* marks the ring retired so the writer can drop it once drained */
+  struct Holder {
+    std::shared_ptr<LogRing> ring;
+    Holder() : ring() {}
+    ~Holder() {
+      if (ring) ring->retired.store(true, std::memory_order_release);
+    }
+  };
+  thread_local Holder holder;
+  if (not holder.ring) {
+    holder.ring = std::make_shared<LogRing>();
+    std::lock_guard<std::mutex> lock(rings_mutex_);
+    rings_.push_back(holder.ring);
+  }
+  return *holder.ring;
+}
+
+static void write_fully(const char* data, size_t len) {
+  while (len > 0) {
+    const ssize_t n = ::write(STDERR_FILENO, data, len);
+    if (n <= 0) {
+      return; /* nowhere left to report it */
+    }
+    data += n;
+    len -= n;
+  }
+}
+
+void AsyncLogger::submit(const std::string& line) {
+  if (not enabled() or line.size() > LogRing::kCapacity / 2 or
+      not local_ring().push(line.data(), line.size())) {
+    write_fully(line.data(), line.size());
+  }
+}
+
+size_t AsyncLogger::drain_all() {
+  std::lock_guard<std::mutex> drain_lock(drain_mutex_);
+  std::vector<std::shared_ptr<LogRing>> rings;
+  {
+    std::lock_guard<std::mutex> lock(rings_mutex_);
+    rings = rings_;
+  }
+  out_.clear();
+  for (auto& ring : rings) {
+    ring->drain(out_);
+  }
+  write_fully(out_.data(), out_.size());
+
+  /* forget rings whose thread has exited and that have nothing left */
+  std::lock_guard<std::mutex> lock(rings_mutex_);
+  for (auto it = rings_.begin(); it != rings_.end();) {
+    if ((*it)->retired.load(std::memory_order_acquire) and (*it)->empty()) {
+      it = rings_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  return out_.size();
+}
+
+void AsyncLogger::writer_loop() {
+  while (running_.load(std::memory_order_acquire)) {
+    if (drain_all() == 0) {
+      std::this_thread::sleep_for(kIdleSleep);
+    }
+  }
+}
+
+void AsyncLogger::flush() {
+  if (enabled()) {
+    drain_all();
+  }
+}
+
+void AsyncLogger::stop() {
+  if (not running_.exchange(false)) {
+    return;
+  }
+  if (writer_.joinable()) {
+    writer_.join();
+  }
+  drain_all();
+}
+
+bool LogAsyncFromEnv() {
+  const char* env_var_val = getenv("LOG_ASYNC");
+  return env_var_val != nullptr && std::strtol(env_var_val, nullptr, 10) > 0;
+}
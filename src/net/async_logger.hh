@@ -0,0 +1,87 @@
+#ifndef ASYNC_LOGGER_HH
+#define ASYNC_LOGGER_HH
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Single-producer/single-consumer byte ring owned by one logging
+ * thread. Records are stored as [u32 length][payload] and may wrap around.
+ */
+class LogRing {
+ public:
+  static constexpr size_t kCapacity = 1 << 16;
+
+  /* producer side; returns false if the record does not fit */
+  bool push(const char* data, uint32_t len);
+
+  /* consumer side; appends all pending payloads to out */
+  size_t drain(std::string& out);
+
+  bool empty() const {
+    return head_.load(std::memory_order_acquire) ==
+           tail_.load(std::memory_order_relaxed);
+  }
+
+  /* set when the owning thread exits */
+  std::atomic<bool> retired{false};
+
+ private:
+  void copy_in(uint64_t pos, const char* src, size_t len);
+  void copy_out(uint64_t pos, char* dst, size_t len) const;
+
+  alignas(64) std::atomic<uint64_t> head_{0};
+  alignas(64) std::atomic<uint64_t> tail_{0};
+  char buf_[kCapacity];
+};
+
+/**
+ * @brief Asynchronous sink for LogMessage, enabled by LOG_ASYNC=1.
+ *
+ * Logging threads only copy the formatted line into their own ring; a
+ * background thread drains every ring to stderr. A record that does not
+ * fit (ring full or oversized line) is written synchronously instead.
+ */
+class AsyncLogger {
+ public:
+  static AsyncLogger* Get();
+
+  bool enabled() const { return running_.load(std::memory_order_acquire); }
+
+  /* queue one formatted line from the calling thread */
+  void submit(const std::string& line);
+
+  /* write out everything queued so far */
+  void flush();
+
+  /* drain and join the writer; later submits are written synchronously */
+  void stop();
+
+ private:
+  AsyncLogger();
+  AsyncLogger(const AsyncLogger&) = delete;
+  AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+  LogRing& local_ring();
+  void writer_loop();
+  /* returns the number of bytes written */
+  size_t drain_all();
+
+ private:
+  std::atomic<bool> running_{false};
+  std::mutex rings_mutex_{};
+  std::vector<std::shared_ptr<LogRing>> rings_{};
+  /* serializes drains between the writer thread and flush() */
+  std::mutex drain_mutex_{};
+  std::string out_{};
+  std::thread writer_{};
+};
+
+bool LogAsyncFromEnv();
+
+#endif  // ASYNC_LOGGER_HH
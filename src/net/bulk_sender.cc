@@ -0,0 +1,87 @@
+#include "bulk_sender.hh"
+
+#include <cerrno>
+#include <cstring>
+
+#include "logging.hh"
+
+using namespace std;
+
+/* user_data of the operations */
+static const uint64_t kSend = 0;
+static const uint64_t kTick = 1;
+static const uint64_t kCancel = 2;
+
+BulkSender::BulkSender(FileDescriptor& fd, const size_t chunk,
+                       const unsigned depth)
+    : ring_(2 * depth + 2),
+      payload_(chunk, 'a'),
+      depth_(depth),
+      tick_({0, 100 * 1000 * 1000}),
+      tick_armed_(false) {
+  const int fds[1] = {fd.fd_num()};
+  ring_.register_files(fds, 1);
+  const iovec iov[1] = {{payload_.data(), payload_.size()}};
+  ring_.register_buffers(iov, 1);
+}
+
+uint64_t BulkSender::run(const atomic<bool>& running) {
+  uint64_t bytes = 0;
+  // a send completes once with its result, then once more when the kernel
+  // is done with the buffer
+  unsigned in_flight = 0, notifications = 0;
+  bool failed = false, cancelled = false;
+
+  while (true) {
+    if (running.load() and not failed) {
+      while (in_flight < depth_) {
+        io_uring_sqe& sqe = ring_.prep_send_zc(0, payload_.data(),
+                                               payload_.size(), kSend, 0);
+        sqe.flags |= IOSQE_FIXED_FILE;
+        // retry short sends in the kernel
+        sqe.msg_flags = MSG_WAITALL;
+        in_flight++;
+        notifications++;
+      }
+    } else if (in_flight > 0 and not cancelled) {
+      ring_.prep_cancel(kSend, kCancel);
+      cancelled = true;
+    }
+    if (in_flight == 0 and notifications == 0) {
+      break;
+    }
+    if (not tick_armed_) {
+      ring_.prep_timeout(&tick_, kTick);
+      tick_armed_ = true;
+    }
+
+    ring_.submit(1);
+    ring_.drain([&](const io_uring_cqe& cqe) {
+      switch (cqe.user_data) {
+      case kTick:
+        tick_armed_ = false;
+        break;
+      case kSend:
+        if (cqe.flags & IORING_CQE_F_NOTIF) {
+          notifications--;
+          break;
+        }
+        in_flight--;
+        if (not(cqe.flags & IORING_CQE_F_MORE)) {
+          // no notification follows
+          notifications--;
+        }
+        if (cqe.res >= 0) {
+          bytes += cqe.res;
+        } else if (cqe.res != -ECANCELED and not failed) {
+          LOG(WARNING) << "BulkSender: send failed: " << strerror(-cqe.res);
+          failed = true;
+        }
+        break;
+      default:
+        break;
+      }
+    });
+  }
+  return bytes;
+}
@@ -0,0 +1,42 @@
+#ifndef BULK_SENDER_HH
+#define BULK_SENDER_HH
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "file_descriptor.hh"
+#include "io_uring.hh"
+
+/**
+ * @brief Filler traffic on a connected socket, sent with io_uring.
+ *
+ * Keeps `depth` zero-copy sends of `chunk` bytes in flight, all from one
+ * registered buffer on a registered fd, and refills them with one syscall
+ * per round, which also waits for the completions. The payload never
+ * changes, so a chunk is sent again before the kernel reports it done.
+ */
+class BulkSender {
+ public:
+  BulkSender(FileDescriptor& fd, const size_t chunk = 64 * 1024,
+             const unsigned depth = 8);
+
+  BulkSender(const BulkSender&) = delete;
+  BulkSender& operator=(const BulkSender&) = delete;
+
+  /**
+   * Send until `running` is cleared or a send fails (e.g. the peer went
+   * away), then wait for the outstanding sends. Returns the bytes sent.
+   */
+  uint64_t run(const std::atomic<bool>& running);
+
+ private:
+  IOUring ring_;
+  std::string payload_;
+  unsigned depth_;
+  // wakes run() up to check `running` while the sends are blocked
+  __kernel_timespec tick_;
+  bool tick_armed_;
+};
+
+#endif  // BULK_SENDER_HH
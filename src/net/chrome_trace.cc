@@ -0,0 +1,54 @@
+#include "chrome_trace.hh"
+
+#include <stdexcept>
+
+using namespace std;
+
+ChromeTrace::ChromeTrace(const string& path) : out_(path), first_(true) {
+  if (not out_.good()) {
+    throw runtime_error(path + ": error opening for writing");
+  }
+  out_ << "[";
+}
+
+ChromeTrace::~ChromeTrace() { close(); }
+
+void ChromeTrace::emit(const string& event) {
+  lock_guard<mutex> lock(mutex_);
+  if (not out_.is_open()) {
+    return;
+  }
+  out_ << (first_ ? "\n" : ",\n") << event;
+  first_ = false;
+}
+
+void ChromeTrace::complete(const string& name, const string& category,
+                           int pid, int tid, uint64_t ts_us, uint64_t dur_us,
+                           const string& args) {
+  emit("{\"name\":\"" + name + "\",\"cat\":\"" + category +
+       "\",\"ph\":\"X\",\"pid\":" + to_string(pid) +
+       ",\"tid\":" + to_string(tid) + ",\"ts\":" + to_string(ts_us) +
+       ",\"dur\":" + to_string(dur_us) + ",\"args\":" + args + "}");
+}
+
+void ChromeTrace::instant(const string& name, const string& category, int pid,
+                          int tid, uint64_t ts_us, const string& args) {
+  emit("{\"name\":\"" + name + "\",\"cat\":\"" + category +
+       "\",\"ph\":\"i\",\"s\":\"t\",\"pid\":" + to_string(pid) +
+       ",\"tid\":" + to_string(tid) + ",\"ts\":" + to_string(ts_us) +
+       ",\"args\":" + args + "}");
+}
+
+void ChromeTrace::name_thread(int pid, int tid, const string& name) {
+  emit("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" + to_string(pid) +
+       ",\"tid\":" + to_string(tid) + ",\"args\":{\"name\":\"" + name +
+       "\"}}");
+}
+
+void ChromeTrace::close() {
+  lock_guard<mutex> lock(mutex_);
+  if (out_.is_open()) {
+    out_ << "\n]\n";
+    out_.close();
+  }
+}
@@ -0,0 +1,47 @@
+#ifndef CHROME_TRACE_HH
+#define CHROME_TRACE_HH
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+/**
+ * @brief Writer of the Chrome trace event format (JSON array form), which
+ * can be opened in Perfetto (ui.perfetto.dev) or chrome://tracing.
+ *
+ * Timestamps are in microseconds. Events are streamed to the file as they
+ * come; the closing bracket is optional in this format, so a trace cut
+ * short by a signal still loads.
+ */
+class ChromeTrace {
+ public:
+  explicit ChromeTrace(const std::string& path);
+  ~ChromeTrace();
+
+  ChromeTrace(const ChromeTrace&) = delete;
+  ChromeTrace& operator=(const ChromeTrace&) = delete;
+
+  /* a slice from ts_us to ts_us + dur_us; args must be a JSON object */
+  void complete(const std::string& name, const std::string& category,
+                int pid, int tid, uint64_t ts_us, uint64_t dur_us,
+                const std::string& args = "{}");
+
+  /* a point event on the thread's track */
+  void instant(const std::string& name, const std::string& category, int pid,
+               int tid, uint64_t ts_us, const std::string& args = "{}");
+
+  /* label the track of (pid, tid) */
+  void name_thread(int pid, int tid, const std::string& name);
+
+  void close();
+
+ private:
+  void emit(const std::string& event);
+
+  std::mutex mutex_{};
+  std::ofstream out_;
+  bool first_;
+};
+
+#endif  // CHROME_TRACE_HH
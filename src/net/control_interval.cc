@@ -0,0 +1,65 @@
+#include "control_interval.hh"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+
+ControlInterval::ControlInterval(uint64_t fixed_us)
+    : fixed_us_(fixed_us),
+      adaptive_(false),
+      multiplier_(1),
+      min_us_(5000),
+      max_us_(200000) {}
+
+void ControlInterval::set_adaptive(const string& spec) {
+  vector<string> fields;
+  stringstream ss(spec);
+  for (string field; getline(ss, field, ':');) {
+    fields.push_back(field);
+  }
+  auto invalid = [&spec]() {
+    return runtime_error(
+        "adaptive interval must be MULTIPLIER[:MIN_MS:MAX_MS]: " + spec);
+  };
+  if (fields.size() != 1 and fields.size() != 3) {
+    throw invalid();
+  }
+  try {
+    multiplier_ = stod(fields[0]);
+    if (fields.size() == 3) {
+      min_us_ = stod(fields[1]) * 1000;
+      max_us_ = stod(fields[2]) * 1000;
+    }
+  } catch (const invalid_argument&) {
+    throw invalid();
+  }
+  if (multiplier_ <= 0 or min_us_ == 0 or min_us_ > max_us_) {
+    throw invalid();
+  }
+  adaptive_ = true;
+}
+
+uint64_t ControlInterval::next_us(uint64_t srtt_us) const {
+  if (not adaptive_ or srtt_us == 0) {
+    return fixed_us_;
+  }
+  return clamp<uint64_t>(multiplier_ * srtt_us, min_us_, max_us_);
+}
+
+uint64_t ControlInterval::srtt_us(const nlohmann::json& state) {
+  return state.value("srtt_us", uint64_t(0)) >> 3;
+}
+
+string ControlInterval::to_string() const {
+  ostringstream out;
+  if (adaptive_) {
+    out << multiplier_ << " x srtt within [" << min_us_ / 1000.0 << ", "
+        << max_us_ / 1000.0 << "] ms";
+  } else {
+    out << fixed_us_ / 1000.0 << " ms";
+  }
+  return out.str();
+}
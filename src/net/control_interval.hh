@@ -0,0 +1,45 @@
+#ifndef CONTROL_INTERVAL_HH
+#define CONTROL_INTERVAL_HH
+
+#include <cstdint>
+#include <string>
+
+#include "json.hpp"
+
+/**
+ * @brief The time from one control step of a flow to its next.
+ *
+ * Fixed by default. An adaptive interval follows the flow's smoothed RTT,
+ * since its state cannot change much within one RTT: `multiplier` RTTs,
+ * within [min, max]. A 1 ms flow is then steered every few ms and a 300 ms
+ * flow a few times a second, and the inference load follows. Until the
+ * first RTT sample it is the fixed interval.
+ */
+class ControlInterval {
+ public:
+  explicit ControlInterval(uint64_t fixed_us);
+
+  /* MULTIPLIER[:MIN_MS:MAX_MS], e.g. "1" or "2:5:200" */
+  void set_adaptive(const std::string& spec);
+
+  bool adaptive() const { return adaptive_; }
+  uint64_t fixed_us() const { return fixed_us_; }
+  uint64_t min_us() const { return min_us_; }
+
+  /* the interval after a step whose state had `srtt_us` (0: unknown) */
+  uint64_t next_us(uint64_t srtt_us) const;
+
+  /* the smoothed RTT of a state message in us (the kernel keeps it << 3) */
+  static uint64_t srtt_us(const nlohmann::json& state);
+
+  std::string to_string() const;
+
+ private:
+  uint64_t fixed_us_;
+  bool adaptive_;
+  double multiplier_;
+  uint64_t min_us_;
+  uint64_t max_us_;
+};
+
+#endif  // CONTROL_INTERVAL_HH
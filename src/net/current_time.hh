@@ -22,4 +22,11 @@ inline uint64_t currentTime_nanoseconds() {
       .count();
 }
 
+/* for measuring intervals; unaffected by wall-clock adjustments */
+inline uint64_t steadyTime_microseconds() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
 #endif /* CURRENT_TIME_HH */
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include "deepcc_backend.hh"
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "common.hh"
+#include "exception.hh"
+#include "perf_log_reader.hh"
+#include "timestamp.hh"
+
+using namespace std;
+
+void KernelDeepCCBackend::enable(int val) {
+  SystemCall("setsockopt", ::setsockopt(fd_, IPPROTO_TCP, TCP_DEEPCC_ENABLE,
+                                        &val, sizeof(val)));
+}
+
+TCPDeepCCInfo KernelDeepCCBackend::get_info() {
+  TCPDeepCCInfo info;
+  socklen_t optlen = sizeof(info);
+  SystemCall("getsockopt", ::getsockopt(fd_, IPPROTO_TCP, TCP_DEEPCC_INFO,
+                                        &info, &optlen));
+  return info;
+}
+
+void KernelDeepCCBackend::set_cwnd(int cwnd) {
+  SystemCall("setsockopt",
+             ::setsockopt(fd_, IPPROTO_TCP, TCP_CWND, &cwnd, sizeof(cwnd)));
+}
+
+uint64_t KernelDeepCCBackend::now_us() { return timestamp_usecs(); }
+
+ReplayDeepCCBackend::ReplayDeepCCBackend(const vector<TCPDeepCCInfo>& rows,
+                                         uint64_t step_us)
+    : rows_(rows), next_(0), step_us_(step_us), now_us_(0) {
+  if (rows_.empty()) {
+    throw runtime_error("ReplayDeepCCBackend: no rows to replay");
+  }
+}
+
+TCPDeepCCInfo ReplayDeepCCBackend::get_info() {
+  now_us_ += step_us_;
+  const TCPDeepCCInfo info = rows_[next_];
+  next_ = (next_ + 1) % rows_.size();
+  return info;
+}
+
+vector<TCPDeepCCInfo> read_recorded_deepcc_info(const string& path) {
+  PerfLogReader reader(path);
+  auto column = [&](const string& name) {
+    return reader.read<uint64_t>(name);
+  };
+  const auto min_rtt = column("min_rtt"), avg_urtt = column("avg_urtt"),
+             cnt = column("cnt"), srtt_us = column("srtt_us"),
+             avg_thr = column("avg_thr"), thr_cnt = column("thr_cnt"),
+             pacing_rate = column("pacing_rate"),
+             loss_bytes = column("loss_bytes"),
+             packets_out = column("packets_out"),
+             retrans_out = column("retrans_out"),
+             max_packets_out = column("max_packets_out"),
+             cwnd = column("CWND in Kernel");
+  vector<TCPDeepCCInfo> rows;
+  for (size_t i = 0; i < reader.num_rows(); i++) {
+    TCPDeepCCInfo info;
+    info.init();
+    info.min_rtt = min_rtt[i];
+    info.avg_urtt = avg_urtt[i];
+    info.cnt = cnt[i];
+    /* the perf log keeps srtt in us, the kernel reports it << 3 */
+    info.srtt_us = srtt_us[i] << 3;
+    info.avg_thr = avg_thr[i];
+    info.thr_cnt = thr_cnt[i];
+    info.pacing_rate = pacing_rate[i];
+    info.lost_bytes = loss_bytes[i];
+    info.packets_out = packets_out[i];
+    info.retrans_out = retrans_out[i];
+    info.max_packets_out = max_packets_out[i];
+    info.cwnd = max<uint64_t>(cwnd[i], 1);
+    info.mss = 1448;
+    rows.push_back(info);
+  }
+  if (rows.empty()) {
+    throw runtime_error(path + ": no rows to replay");
+  }
+  return rows;
+}
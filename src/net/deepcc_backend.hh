@@ -0,0 +1,71 @@
+#ifndef DEEPCC_BACKEND_HH
+#define DEEPCC_BACKEND_HH
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "tcp_info.hh"
+
+/**
+ * @brief Where a DeepCCSocket reads its TCP statistics and sends its
+ * windows: the patched kernel, or a stand-in that needs no kernel patch.
+ */
+class DeepCCBackend {
+ public:
+  virtual ~DeepCCBackend() {}
+
+  /* TCP_DEEPCC_ENABLE */
+  virtual void enable(int val) = 0;
+  /* TCP_DEEPCC_INFO; like deepcc_get_info(), starts a new monitor interval */
+  virtual TCPDeepCCInfo get_info() = 0;
+  /* TCP_CWND */
+  virtual void set_cwnd(int cwnd) = 0;
+  /* clock of the statistics in us, for the time_delta of the state */
+  virtual uint64_t now_us() = 0;
+  /* whether the statistics come from the socket's own kernel state */
+  virtual bool in_kernel() const { return false; }
+};
+
+/* the patched kernel, through the socket options of `fd` */
+class KernelDeepCCBackend : public DeepCCBackend {
+ public:
+  explicit KernelDeepCCBackend(int fd) : fd_(fd) {}
+
+  void enable(int val) override;
+  TCPDeepCCInfo get_info() override;
+  void set_cwnd(int cwnd) override;
+  uint64_t now_us() override;
+  bool in_kernel() const override { return true; }
+
+ private:
+  int fd_;
+};
+
+/**
+ * Replays the TCP statistics recorded in a client --perf-log, one row per
+ * get_info(), from the start again after the last one. The windows set are
+ * ignored. Time advances by `step_us` per row, so a replay is the same
+ * every run.
+ */
+class ReplayDeepCCBackend : public DeepCCBackend {
+ public:
+  ReplayDeepCCBackend(const std::vector<TCPDeepCCInfo>& rows,
+                      uint64_t step_us);
+
+  void enable(int) override {}
+  TCPDeepCCInfo get_info() override;
+  void set_cwnd(int) override {}
+  uint64_t now_us() override { return now_us_; }
+
+ private:
+  std::vector<TCPDeepCCInfo> rows_;
+  size_t next_;
+  uint64_t step_us_;
+  uint64_t now_us_;
+};
+
+/* the rows of a perf log written by client_eval_batch(_udp) */
+std::vector<TCPDeepCCInfo> read_recorded_deepcc_info(const std::string& path);
+
+#endif  // DEEPCC_BACKEND_HH
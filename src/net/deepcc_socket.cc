@@ -4,8 +4,6 @@
 #include "logging.hh"
 #include "timestamp.hh"
 
-#define SECOND_TO_US 1000000
-
 using json = nlohmann::json;
 
 DeepCCSocket::DeepCCSocket() : TCPSocket() { init(); }
@@ -16,6 +14,7 @@ DeepCCSocket::DeepCCSocket(FileDescriptor&& fd) : TCPSocket(std::move(fd)) {
 
 void DeepCCSocket::init() {
   tcp_deepcc_enable = true;
+  backend_.reset(new KernelDeepCCBackend(fd_num()));
   max_tput_ = 0;
   last_observe_ts_ = 0;
   last_request_ts_ = 0;
@@ -34,8 +33,13 @@ DeepCCSocket DeepCCSocket::accept(void) {
       SystemCall("accept", ::accept(fd_num(), nullptr, nullptr))));
 }
 
+void DeepCCSocket::set_backend(std::unique_ptr<DeepCCBackend> backend) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  backend_ = std::move(backend);
+}
+
 void DeepCCSocket::enable_deepcc(int val) {
-  setsockopt(IPPROTO_TCP, TCP_DEEPCC_ENABLE, val);
+  backend_->enable(val);
   tcp_deepcc_enable = true;
 }
 
@@ -45,8 +49,7 @@ TCPDeepCCInfo DeepCCSocket::get_tcp_deepcc_info(TCPInfoRequestType type) {
   if (not tcp_deepcc_enable) {
     throw runtime_error("DeepCC hasn't been activated");
   }
-  struct TCPDeepCCInfo info;
-  getsockopt(IPPROTO_TCP, TCP_DEEPCC_INFO, info);
+  struct TCPDeepCCInfo info = backend_->get_info();
   // record max throughput
   max_tput_ = std::max(max_tput_, info.avg_thr);
   switch (type) {
@@ -73,7 +76,7 @@ TCPDeepCCInfo DeepCCSocket::get_tcp_deepcc_info(TCPInfoRequestType type) {
 
 json DeepCCSocket::get_tcp_deepcc_info_json(TCPInfoRequestType type) {
   uint64_t time_delta = 0;
-  auto now = timestamp_usecs();
+  auto now = backend_->now_us();
   switch (type) {
   case TCPInfoRequestType::REQUEST_ACTION:
     time_delta = now - last_request_ts_;
@@ -88,14 +91,8 @@ json DeepCCSocket::get_tcp_deepcc_info_json(TCPInfoRequestType type) {
   // timedelta in us
   time_delta = std::max(time_delta, u64(1));
   auto info = get_tcp_deepcc_info(type);
-  // loss ratio in bytes per second
-  auto loss_ratio = double(info.lost_bytes * SECOND_TO_US) / time_delta;
-  auto data = std::move(info.to_json());
   // we also want to know the observed max throughput
-  data["max_tput"] = max_tput_;
-  data["loss_ratio"] = loss_ratio;
-  data["time_delta"] = time_delta;
-  return data;
+  return deepcc_state_json(info, max_tput_, time_delta);
 }
 
 void DeepCCSocket::prepare_request_info(TCPDeepCCInfo& info) {
@@ -116,7 +113,7 @@ void DeepCCSocket::set_tcp_cwnd(int cwnd) {
   if (not tcp_deepcc_enable) {
     throw runtime_error("DeepCC hasn't been activated");
   }
-  setsockopt(IPPROTO_TCP, TCP_CWND, cwnd);
+  backend_->set_cwnd(cwnd);
 }
 
 /* get socket option */
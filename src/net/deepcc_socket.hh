@@ -4,10 +4,12 @@
 #include <linux/tcp.h>
 #include <sys/socket.h>
 
+#include <memory>
 #include <mutex>
 #include <queue>
 
 #include "address.hh"
+#include "deepcc_backend.hh"
 #include "exception.hh"
 #include "file_descriptor.hh"
 #include "socket.hh"
@@ -29,6 +31,12 @@ class DeepCCSocket : public TCPSocket {
   json get_tcp_deepcc_info_json(TCPInfoRequestType type);
   void set_tcp_cwnd(int cwnd);
   DeepCCSocket accept();
+
+  /* the kernel unless replaced, e.g. by a simulated link to run without the
+   * patched kernel */
+  void set_backend(std::unique_ptr<DeepCCBackend> backend);
+  const DeepCCBackend& backend() const { return *backend_; }
+
   /* get and set socket option */
   template <typename option_type>
   socklen_t getsockopt(const int level, const int option,
@@ -48,6 +56,7 @@ class DeepCCSocket : public TCPSocket {
 
  private:
   bool tcp_deepcc_enable;
+  std::unique_ptr<DeepCCBackend> backend_{};
   std::queue<TCPDeepCCInfo> queue_{};
   /* maximal observed throughput */
   uint64_t max_tput_;
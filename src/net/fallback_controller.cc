@@ -0,0 +1,23 @@
+#include "fallback_controller.hh"
+
+#include <algorithm>
+
+using namespace std;
+
+FallbackController::FallbackController() : steps_(0) {}
+
+int FallbackController::cwnd(const nlohmann::json& state) {
+  steps_++;
+  const int cwnd = state.value("cwnd", kMinCwnd);
+  if (state.value("loss_bytes", 0u) > 0) {
+    return max<int>(kMinCwnd, cwnd * kBackoff);
+  }
+  const uint64_t mss = max(state.value("mss_cache", 1448u), 1u);
+  // bytes per second * us
+  const double bdp = state.value("avg_thr", uint64_t(0)) / 1e6 *
+                     state.value("min_rtt", 0u) / mss;
+  if (bdp > 0 and cwnd + 1 > kInflightGain * bdp) {
+    return max<int>(kMinCwnd, min<double>(cwnd, kInflightGain * bdp));
+  }
+  return cwnd + 1;
+}
@@ -0,0 +1,36 @@
+#ifndef FALLBACK_CONTROLLER_HH
+#define FALLBACK_CONTROLLER_HH
+
+#include <cstdint>
+
+#include "json.hpp"
+
+/**
+ * @brief A native window for the control steps that get no action from the
+ * inference service in time.
+ *
+ * It works on the same state the step sent for inference: a loss backs the
+ * window off multiplicatively, otherwise it grows by one packet per step, up
+ * to twice the bandwidth-delay product of the step's throughput and min RTT
+ * (as BBR caps its inflight). Cheap enough to run on every missed step, so
+ * the window keeps moving while the service is overloaded.
+ */
+class FallbackController {
+ public:
+  FallbackController();
+
+  /* the cwnd in packets for a step with `state` */
+  int cwnd(const nlohmann::json& state);
+
+  /* steps decided here */
+  uint64_t steps() const { return steps_; }
+
+ private:
+  static constexpr int kMinCwnd = 4;
+  static constexpr double kBackoff = 0.7;
+  static constexpr double kInflightGain = 2;
+
+  uint64_t steps_;
+};
+
+#endif  // FALLBACK_CONTROLLER_HH
@@ -5,8 +5,6 @@
 #include <fcntl.h>
 #include <unistd.h>
 
-#include <cassert>
-
 #include "exception.hh"
 
 using namespace std;
@@ -77,42 +75,36 @@ string::const_iterator FileDescriptor::write(
     throw runtime_error("nothing to write");
   }
 
-  ssize_t bytes_written =
-      SystemCall("write", ::write(fd_, &*begin, end - begin));
-  if (bytes_written == 0) {
-    throw runtime_error("write returned 0");
-  }
-
-  register_write();
-
-  return begin + bytes_written;
+  return begin + write_from(&*begin, end - begin, false);
 }
 
 /* read method */
 string FileDescriptor::read(const size_t limit) {
   char buffer[BUFFER_SIZE];
 
-  ssize_t bytes_read =
-      SystemCall("read", ::read(fd_, buffer, min(BUFFER_SIZE, limit)));
+  return string(buffer, read_into(buffer, min(BUFFER_SIZE, limit)));
+}
+
+size_t FileDescriptor::read_into(char* buffer, const size_t length) {
+  ssize_t bytes_read = SystemCall("read", ::read(fd_, buffer, length));
   if (bytes_read == 0) {
     set_eof();
   }
 
   register_read();
 
-  return string(buffer, bytes_read);
+  return bytes_read;
 }
 
-/* read exactly some bytes */
-string FileDescriptor::read_exactly(const size_t length,
-                                    const bool fail_silently) {
-  std::string ret;
+size_t FileDescriptor::read_exactly_into(char* buffer, const size_t length,
+                                         const bool fail_silently) {
+  size_t done = 0;
 
-  while (ret.size() < length) {
-    ret.append(read(length - ret.size()));
+  while (done < length) {
+    done += read_into(buffer + done, length - done);
     if (eof()) {
       if (fail_silently) {
-        return ret;
+        return done;
       } else {
         throw std::runtime_error(
             "read_exactly: reached EOF before reaching target");
@@ -120,7 +112,75 @@ string FileDescriptor::read_exactly(const size_t length,
     }
   }
 
-  assert(ret.size() == length);
+  return done;
+}
+
+size_t FileDescriptor::write_from(const char* data, const size_t length,
+                                  const bool write_all) {
+  size_t done = 0;
+  if (length == 0) {
+    return 0;
+  }
+
+  do {
+    ssize_t bytes_written =
+        SystemCall("write", ::write(fd_, data + done, length - done));
+    if (bytes_written == 0) {
+      throw runtime_error("write returned 0");
+    }
+    register_write();
+    done += bytes_written;
+  } while (write_all and done < length);
+
+  return done;
+}
+
+size_t FileDescriptor::readv(const iovec* iov, const int iovcnt) {
+  ssize_t bytes_read = SystemCall("readv", ::readv(fd_, iov, iovcnt));
+  if (bytes_read == 0) {
+    set_eof();
+  }
+
+  register_read();
+
+  return bytes_read;
+}
+
+int FileDescriptor::consume_iovec(iovec*& iov, int iovcnt, size_t n) {
+  while (iovcnt > 0 and n >= iov->iov_len) {
+    n -= iov->iov_len;
+    iov++;
+    iovcnt--;
+  }
+  if (iovcnt > 0) {
+    iov->iov_base = static_cast<char*>(iov->iov_base) + n;
+    iov->iov_len -= n;
+  }
+  return iovcnt;
+}
+
+size_t FileDescriptor::writev(iovec* iov, int iovcnt, const bool write_all) {
+  size_t done = 0;
+
+  do {
+    ssize_t bytes_written = SystemCall("writev", ::writev(fd_, iov, iovcnt));
+    if (bytes_written == 0) {
+      throw runtime_error("writev returned 0");
+    }
+    register_write();
+    done += bytes_written;
+    iovcnt = consume_iovec(iov, iovcnt, bytes_written);
+  } while (write_all and iovcnt > 0);
+
+  return done;
+}
+
+/* read exactly some bytes */
+string FileDescriptor::read_exactly(const size_t length,
+                                    const bool fail_silently) {
+  std::string ret(length, 0);
+
+  ret.resize(read_exactly_into(&ret[0], length, fail_silently));
   return ret;
 }
 
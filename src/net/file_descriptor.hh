@@ -3,6 +3,8 @@
 #ifndef FILE_DESCRIPTOR_HH
 #define FILE_DESCRIPTOR_HH
 
+#include <sys/uio.h>
+
 #include <string>
 
 /* Unix file descriptors (sockets, files, etc.) */
@@ -21,6 +23,9 @@ class FileDescriptor {
   void register_write(void) { write_count_++; }
   void set_eof(void) { eof_ = true; }
 
+  /* skip the first `n` bytes of `iov`; returns how many entries are left */
+  static int consume_iovec(iovec*& iov, int iovcnt, size_t n);
+
  public:
   /* construct from fd number */
   FileDescriptor(const int fd);
@@ -52,6 +57,20 @@ class FileDescriptor {
   std::string::const_iterator write(const std::string::const_iterator& begin,
                                     const std::string::const_iterator& end);
 
+  /* the same without allocating: the caller owns the memory */
+  /* one read(); returns 0 (and sets eof) at the end of the stream */
+  size_t read_into(char* buffer, const size_t length);
+  /* returns fewer than `length` bytes only at EOF with fail_silently */
+  size_t read_exactly_into(char* buffer, const size_t length,
+                           const bool fail_silently = false);
+  virtual size_t write_from(const char* data, const size_t length,
+                            const bool write_all = true);
+
+  /* scatter-gather; with write_all, writev consumes `iov` as it goes */
+  size_t readv(const iovec* iov, const int iovcnt);
+  virtual size_t writev(iovec* iov, const int iovcnt,
+                        const bool write_all = true);
+
   /* set nonblocking/blocking behavior */
   void set_blocking(const bool block);
 
@@ -0,0 +1,161 @@
+#include "flow_stats.hh"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+/* Jain's fairness index */
+static double jain(const vector<double>& values) {
+  double sum = 0, sum_squares = 0;
+  for (double v : values) {
+    sum += v;
+    sum_squares += v * v;
+  }
+  return sum_squares > 0 ? sum * sum / (values.size() * sum_squares) : 1;
+}
+
+/* bits per microsecond are Mbit/s */
+static double mbps(uint64_t bytes, uint64_t us) {
+  return us ? bytes * 8.0 / us : 0;
+}
+
+FlowSampler::FlowSampler(const TCPReceiver& receiver,
+                         const FlowSamplerConfig& config)
+    : receiver_(receiver),
+      config_(config),
+      tracks_(receiver.max_flows()),
+      open_flows_(0),
+      samples_(),
+      window_goodputs_(),
+      jain_index_(1),
+      total_mbps_(0),
+      measuring_(false),
+      pending_(),
+      fair_since_us_(0),
+      converged_() {
+  if (config_.interval_us == 0 or config_.window == 0) {
+    throw runtime_error("FlowSampler: invalid configuration");
+  }
+}
+
+void FlowSampler::sample(uint64_t now_us) {
+  samples_.clear();
+  window_goodputs_.clear();
+  converged_.clear();
+
+  const size_t slots = min<uint64_t>(receiver_.flows_accepted(),
+                                     receiver_.max_flows());
+  for (size_t slot = 0; slot < slots; slot++) {
+    const FlowCounter& counter = receiver_.counter(slot);
+    const uint64_t id = counter.flow.load();
+    if (id == 0) {
+      continue;
+    }
+    const uint64_t closed_us = counter.closed_us.load();
+    const uint64_t bytes = counter.bytes.load();
+    if (counter.flow.load() != id) {
+      // the slot was taken by a new connection meanwhile; next time
+      continue;
+    }
+
+    Track& track = tracks_[slot];
+    if (track.flow != id) {
+      if (track.open) {
+        // closed and replaced between two samples
+        open_flows_--;
+        start_measurement(now_us, track.flow - 1, ConvergenceEvent::LEAVE);
+      }
+      const uint64_t opened_us = counter.opened_us.load();
+      track.flow = id;
+      track.open = closed_us == 0;
+      track.last_bytes = 0;
+      track.last_us = opened_us;
+      track.history.assign(config_.window, 0);
+      track.history_us.assign(config_.window, opened_us);
+      track.next = 0;
+      if (not track.open) {
+        // too short to be sampled
+        continue;
+      }
+      open_flows_++;
+      start_measurement(now_us, id - 1, ConvergenceEvent::JOIN);
+    }
+    if (not track.open) {
+      continue;
+    }
+
+    const uint64_t until_us = closed_us ? closed_us : now_us;
+    const double goodput =
+        mbps(bytes - track.last_bytes, until_us - track.last_us);
+    samples_.push_back({id - 1, goodput});
+    track.last_bytes = bytes;
+    track.last_us = until_us;
+
+    const double window_goodput = mbps(bytes - track.history[track.next],
+                                       until_us - track.history_us[track.next]);
+    track.history[track.next] = bytes;
+    track.history_us[track.next] = until_us;
+    track.next = (track.next + 1) % config_.window;
+
+    if (closed_us) {
+      track.open = false;
+      open_flows_--;
+      start_measurement(now_us, id - 1, ConvergenceEvent::LEAVE);
+    } else {
+      window_goodputs_.push_back(window_goodput);
+    }
+  }
+
+  vector<double> goodputs(samples_.size());
+  total_mbps_ = 0;
+  for (size_t i = 0; i < samples_.size(); i++) {
+    goodputs[i] = samples_[i].goodput_mbps;
+    total_mbps_ += goodputs[i];
+  }
+  jain_index_ = jain(goodputs);
+  update_measurement(now_us, jain(window_goodputs_));
+}
+
+void FlowSampler::start_measurement(uint64_t now_us, uint64_t flow,
+                                    ConvergenceEvent::Kind kind) {
+  if (measuring_ and pending_.time_us == now_us) {
+    // flows that come or go together make one event
+    pending_.flow = flow;
+    pending_.kind = kind;
+    pending_.flows = open_flows_;
+    return;
+  }
+  if (measuring_) {
+    pending_.convergence_ms = -1;
+    converged_.push_back(pending_);
+  }
+  pending_ = {now_us, flow, kind, open_flows_, 0};
+  measuring_ = true;
+  fair_since_us_ = 0;
+}
+
+void FlowSampler::update_measurement(uint64_t now_us, double window_jain) {
+  if (not measuring_) {
+    return;
+  }
+  if (open_flows_ == 0) {
+    // nothing left to share; the event is kept, as one that never converged
+    pending_.convergence_ms = -1;
+    converged_.push_back(pending_);
+    measuring_ = false;
+    return;
+  }
+  if (window_jain < config_.threshold) {
+    fair_since_us_ = 0;
+    return;
+  }
+  if (fair_since_us_ == 0) {
+    fair_since_us_ = now_us;
+  }
+  if (now_us - fair_since_us_ >= config_.hold_us) {
+    pending_.convergence_ms = (fair_since_us_ - pending_.time_us) / 1e3;
+    converged_.push_back(pending_);
+    measuring_ = false;
+  }
+}
@@ -0,0 +1,98 @@
+#ifndef FLOW_STATS_HH
+#define FLOW_STATS_HH
+
+#include <cstdint>
+#include <vector>
+
+#include "tcp_receiver.hh"
+
+struct FlowSamplerConfig {
+  uint64_t interval_us = 10000;
+  // samples averaged for convergence, so bursts within an RTT do not count
+  size_t window = 10;
+  // converged: Jain's index of the averaged goodputs stays above this ...
+  double threshold = 0.95;
+  // ... for this long
+  uint64_t hold_us = 1000000;
+};
+
+/* goodput of one open connection over the last interval */
+struct FlowSample {
+  uint64_t flow;
+  double goodput_mbps;
+};
+
+/* how long the flows took to share fairly after one joined or left */
+struct ConvergenceEvent {
+  enum Kind : uint64_t { LEAVE = 0, JOIN = 1 };
+
+  uint64_t time_us;
+  uint64_t flow;
+  Kind kind;
+  // open connections after the event
+  uint64_t flows;
+  // -1 if the next event came first, or the last flow left
+  double convergence_ms;
+};
+
+/**
+ * @brief Per-flow goodput and fairness of a TCPReceiver, sampled online.
+ *
+ * Every sample() reads the FlowCounter of each connection, so the workers
+ * pay nothing beyond their relaxed byte counts. It yields the goodput of
+ * every open connection over the last interval and Jain's index across
+ * them. A connection opening or closing starts a convergence measurement:
+ * the flows have converged once Jain's index of their goodputs, averaged
+ * over the last `window` samples, has stayed above `threshold` for
+ * `hold_us`. The convergence time runs from the event to the start of
+ * that period.
+ */
+class FlowSampler {
+ public:
+  FlowSampler(const TCPReceiver& receiver, const FlowSamplerConfig& config);
+
+  /* `now_us` on the steady clock, as the counters */
+  void sample(uint64_t now_us);
+
+  const std::vector<FlowSample>& samples() const { return samples_; }
+  double jain_index() const { return jain_index_; }
+  double total_mbps() const { return total_mbps_; }
+  /* measurements finished by the last sample() */
+  const std::vector<ConvergenceEvent>& converged() const {
+    return converged_;
+  }
+
+ private:
+  struct Track {
+    uint64_t flow = 0;
+    bool open = false;
+    uint64_t last_bytes = 0;
+    uint64_t last_us = 0;
+    // byte counts of the last `window` samples, oldest at `next`
+    std::vector<uint64_t> history{};
+    std::vector<uint64_t> history_us{};
+    size_t next = 0;
+  };
+
+  void start_measurement(uint64_t now_us, uint64_t flow,
+                         ConvergenceEvent::Kind kind);
+  void update_measurement(uint64_t now_us, double window_jain);
+
+  const TCPReceiver& receiver_;
+  FlowSamplerConfig config_;
+  std::vector<Track> tracks_;
+  uint64_t open_flows_;
+
+  std::vector<FlowSample> samples_;
+  std::vector<double> window_goodputs_;
+  double jain_index_;
+  double total_mbps_;
+
+  bool measuring_;
+  ConvergenceEvent pending_;
+  // 0 while the index is below the threshold
+  uint64_t fair_since_us_;
+  std::vector<ConvergenceEvent> converged_;
+};
+
+#endif  // FLOW_STATS_HH
@@ -0,0 +1,82 @@
+#include "histogram.hh"
+
+#include <algorithm>
+#include <cmath>
+
+size_t Histogram::bucket_index(uint64_t value) {
+  if (value < kSubBuckets) {
+    return value;
+  }
+  /* position of the leading one bit, at least kSubBucketBits here */
+  const unsigned exponent = 63 - __builtin_clzll(value);
+  const unsigned shift = exponent - kSubBucketBits;
+  const uint64_t sub = (value >> shift) - kSubBuckets;
+  return (shift + 1) * kSubBuckets + sub;
+}
+
+uint64_t Histogram::bucket_upper_bound(size_t index) {
+  if (index < kSubBuckets) {
+    return index;
+  }
+  const unsigned shift = index / kSubBuckets - 1;
+  const uint64_t sub = index % kSubBuckets;
+  const uint64_t lower = (kSubBuckets + sub) << shift;
+  return lower + ((uint64_t(1) << shift) - 1);
+}
+
+void Histogram::record(uint64_t value) {
+  buckets_[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+  count_.fetch_add(1, std::memory_order_relaxed);
+  sum_.fetch_add(value, std::memory_order_relaxed);
+
+  uint64_t seen = min_.load(std::memory_order_relaxed);
+  while (value < seen and
+         not min_.compare_exchange_weak(seen, value,
+                                        std::memory_order_relaxed)) {
+  }
+  seen = max_.load(std::memory_order_relaxed);
+  while (value > seen and
+         not max_.compare_exchange_weak(seen, value,
+                                        std::memory_order_relaxed)) {
+  }
+}
+
+HistogramSnapshot Histogram::snapshot() const {
+  HistogramSnapshot snap;
+  snap.buckets_.resize(kNumBuckets);
+  /* recorders may race with us; derive the count from the buckets copied */
+  for (size_t i = 0; i < kNumBuckets; i++) {
+    snap.buckets_[i] = buckets_[i].load(std::memory_order_relaxed);
+    snap.count_ += snap.buckets_[i];
+  }
+  snap.sum_ = sum_.load(std::memory_order_relaxed);
+  snap.min_ = min_.load(std::memory_order_relaxed);
+  snap.max_ = max_.load(std::memory_order_relaxed);
+  return snap;
+}
+
+void Histogram::reset() {
+  for (auto& bucket : buckets_) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+  count_.store(0, std::memory_order_relaxed);
+  sum_.store(0, std::memory_order_relaxed);
+  min_.store(UINT64_MAX, std::memory_order_relaxed);
+  max_.store(0, std::memory_order_relaxed);
+}
+
+uint64_t HistogramSnapshot::percentile(double q) const {
+  if (count_ == 0) {
+    return 0;
+  }
+  const uint64_t rank =
+      std::max<uint64_t>(1, std::ceil(q * static_cast<double>(count_)));
+  uint64_t seen = 0;
+  for (size_t i = 0; i < buckets_.size(); i++) {
+    seen += buckets_[i];
+    if (seen >= rank) {
+      return std::min(Histogram::bucket_upper_bound(i), max_);
+    }
+  }
+  return max_;
+}
@@ -0,0 +1,75 @@
+#ifndef HISTOGRAM_HH
+#define HISTOGRAM_HH
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/* monotonically increasing event count, safe to bump from any thread */
+class Counter {
+ public:
+  void add(uint64_t n = 1) { value_.fetch_add(n, std::memory_order_relaxed); }
+  uint64_t value() const { return value_.load(std::memory_order_relaxed); }
+  void reset() { value_.store(0, std::memory_order_relaxed); }
+
+ private:
+  std::atomic<uint64_t> value_{0};
+};
+
+/* point-in-time copy of a Histogram */
+class HistogramSnapshot {
+ public:
+  uint64_t count() const { return count_; }
+  uint64_t min() const { return count_ ? min_ : 0; }
+  uint64_t max() const { return max_; }
+  double mean() const { return count_ ? (double)sum_ / count_ : 0; }
+
+  /* q in [0, 1]; returns the upper bound of the bucket holding the rank */
+  uint64_t percentile(double q) const;
+
+ private:
+  friend class Histogram;
+  std::vector<uint64_t> buckets_{};
+  uint64_t count_{0};
+  uint64_t sum_{0};
+  uint64_t min_{0};
+  uint64_t max_{0};
+};
+
+/**
+ * @brief Lock-free HDR-style histogram of non-negative integers.
+ *
+ * Values below 2^kSubBucketBits are counted exactly; above that every
+ * power-of-two range is split into 2^kSubBucketBits linear buckets, which
+ * bounds the relative error to about 3%. record() is a few relaxed atomic
+ * adds, so it can sit on the request path of any thread.
+ */
+class Histogram {
+ public:
+  static constexpr unsigned kSubBucketBits = 5;
+  static constexpr uint64_t kSubBuckets = 1 << kSubBucketBits;
+  static constexpr size_t kNumBuckets = (64 - kSubBucketBits + 1) * kSubBuckets;
+
+  Histogram() {}
+  Histogram(const Histogram&) = delete;
+  Histogram& operator=(const Histogram&) = delete;
+
+  void record(uint64_t value);
+  HistogramSnapshot snapshot() const;
+  /* not atomic with respect to concurrent record() calls */
+  void reset();
+
+  static size_t bucket_index(uint64_t value);
+  /* largest value that maps to the bucket */
+  static uint64_t bucket_upper_bound(size_t index);
+
+ private:
+  std::atomic<uint64_t> buckets_[kNumBuckets]{};
+  std::atomic<uint64_t> count_{0};
+  std::atomic<uint64_t> sum_{0};
+  std::atomic<uint64_t> min_{UINT64_MAX};
+  std::atomic<uint64_t> max_{0};
+};
+
+#endif  // HISTOGRAM_HH
@@ -0,0 +1,121 @@
+#include "inference_transport.hh"
+
+#include <cstring>
+#include <stdexcept>
+
+using namespace std;
+
+unique_ptr<InferenceTransport> InferenceTransport::connect(
+    const string& channel, const string& target) {
+  if (channel == "unix") {
+    return make_unique<UnixTransport>(target.empty() ? "/tmp/astraea.sock"
+                                                     : target);
+  }
+  if (channel == "udp") {
+    if (target.empty()) {
+      return make_unique<UdpTransport>(Address("127.0.0.1", 8888));
+    }
+    const auto colon = target.rfind(':');
+    if (colon == string::npos) {
+      throw runtime_error("udp target must be HOST:PORT: " + target);
+    }
+    return make_unique<UdpTransport>(
+        Address(target.substr(0, colon), target.substr(colon + 1)));
+  }
+  throw runtime_error("unknown inference channel: " + channel);
+}
+
+UnixTransport::UnixTransport(const string& path) : sock_(), buffer_() {
+  sock_.connect(path);
+}
+
+void UnixTransport::send_message(const string& message) {
+  write_message(sock_, message);
+}
+
+string_view UnixTransport::recv_view() { return read_message(sock_, buffer_); }
+
+UdpTransport::UdpTransport(const Address& server) : sock_(), buffer_() {
+  sock_.connect(server);
+}
+
+void UdpTransport::send_message(const string& message) {
+  char header[2];
+  put_field(message.length(), header);
+  const iovec iov[2] = {
+      {header, 2}, {const_cast<char*>(message.data()), message.length()}};
+  sock_.sendv(iov, 2);
+}
+
+string_view UdpTransport::recv_view() {
+  char header[2];
+  const iovec iov[2] = {{header, 2}, {buffer_, sizeof(buffer_)}};
+  const size_t length = sock_.recvv(iov, 2);
+  if (length < 2 or get_uint16(header) != length - 2) {
+    throw runtime_error("incomplete message received");
+  }
+  return string_view(buffer_, length - 2);
+}
+
+/* room for a few whole frames of the largest size */
+static const size_t kInboxSize = 4 * (MUX_HEADER_SIZE + MAX_MESSAGE_SIZE);
+
+MuxTransport::MuxTransport(const string& path)
+    : sock_(), outbox_(), inbox_(kInboxSize), begin_(0), end_(0) {
+  sock_.connect(path);
+  // MessageType::MUX; the frames after it are tagged
+  write_message(sock_, "{\"type\":5}");
+}
+
+void MuxTransport::queue(const uint32_t tag, const string& message) {
+  char header[MUX_HEADER_SIZE];
+  put_mux_header(message.length(), tag, header);
+  outbox_.append(header, MUX_HEADER_SIZE);
+  outbox_.append(message);
+}
+
+void MuxTransport::flush() {
+  if (outbox_.empty()) {
+    return;
+  }
+  sock_.write(outbox_, true);
+  outbox_.clear();
+}
+
+void MuxTransport::receive() {
+  if (begin_ > 0) {
+    // keep the partial frame at the front
+    memmove(inbox_.data(), inbox_.data() + begin_, end_ - begin_);
+    end_ -= begin_;
+    begin_ = 0;
+  }
+  const size_t length = sock_.read_into(inbox_.data() + end_,
+                                        inbox_.size() - end_);
+  if (length == 0) {
+    throw runtime_error("inference service closed the connection");
+  }
+  end_ += length;
+}
+
+bool MuxTransport::next(uint32_t& tag, string_view& message) {
+  if (end_ - begin_ < MUX_HEADER_SIZE) {
+    return false;
+  }
+  const char* frame = inbox_.data() + begin_;
+  const uint16_t length = get_uint16(frame);
+  if (end_ - begin_ < MUX_HEADER_SIZE + length) {
+    return false;
+  }
+  tag = get_uint32(frame + 2);
+  message = string_view(frame + MUX_HEADER_SIZE, length);
+  begin_ += MUX_HEADER_SIZE + length;
+  return true;
+}
+
+string_view MuxTransport::recv_view(uint32_t& tag) {
+  string_view message;
+  while (not next(tag, message)) {
+    receive();
+  }
+  return message;
+}
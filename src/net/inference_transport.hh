@@ -0,0 +1,110 @@
+#ifndef INFERENCE_TRANSPORT_HH
+#define INFERENCE_TRANSPORT_HH
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ipc_socket.hh"
+#include "serialization.hh"
+#include "socket.hh"
+
+/**
+ * @brief Connection of one flow to the inference service.
+ *
+ * Messages are JSON documents framed by a 2-byte big-endian length, the
+ * same on every channel (see serialization.hh).
+ */
+class InferenceTransport {
+ public:
+  virtual ~InferenceTransport() {}
+
+  /* frame and send one message */
+  virtual void send_message(const std::string& message) = 0;
+
+  /* read one whole message; blocks until it has arrived */
+  std::string recv_message() { return std::string(recv_view()); }
+
+  /* the same without allocating; valid until the next receive */
+  virtual std::string_view recv_view() = 0;
+
+  /* for polling; readable means a whole message can be read */
+  virtual int fd_num() const = 0;
+
+  /**
+   * @brief Connect over `channel` ("unix" or "udp").
+   *
+   * `target` is the socket path for unix and HOST:PORT for udp; empty
+   * means the default endpoint of infer (/tmp/astraea.sock, 127.0.0.1:8888).
+   */
+  static std::unique_ptr<InferenceTransport> connect(
+      const std::string& channel, const std::string& target = "");
+};
+
+/* stream over a UNIX domain socket (infer --channel=unix) */
+class UnixTransport : public InferenceTransport {
+ public:
+  explicit UnixTransport(const std::string& path);
+
+  void send_message(const std::string& message) override;
+  std::string_view recv_view() override;
+  int fd_num() const override { return sock_.fd_num(); }
+
+ private:
+  IPCSocket sock_;
+  char buffer_[MAX_MESSAGE_SIZE];
+};
+
+/* one datagram per message (infer --channel=udp) */
+class UdpTransport : public InferenceTransport {
+ public:
+  explicit UdpTransport(const Address& server);
+
+  void send_message(const std::string& message) override;
+  std::string_view recv_view() override;
+  int fd_num() const override { return sock_.fd_num(); }
+
+ private:
+  UDPSocket sock_;
+  char buffer_[MAX_MESSAGE_SIZE];
+};
+
+/**
+ * @brief One unix connection to the inference service for many flows.
+ *
+ * Opens with a MUX message, after which every frame carries a tag (see
+ * put_mux_header()), so the replies of many flows are told apart without
+ * parsing them. Messages queued with queue() go out together in one write
+ * on flush(); receive() reads whatever has arrived in one read, and next()
+ * hands out its whole frames.
+ */
+class MuxTransport {
+ public:
+  explicit MuxTransport(const std::string& path);
+
+  MuxTransport(const MuxTransport&) = delete;
+  MuxTransport& operator=(const MuxTransport&) = delete;
+
+  void queue(const uint32_t tag, const std::string& message);
+  void flush();
+
+  /* one read; blocks until something has arrived */
+  void receive();
+  /* the next whole frame received; valid until the next receive() */
+  bool next(uint32_t& tag, std::string_view& message);
+  /* receive until a whole frame has arrived */
+  std::string_view recv_view(uint32_t& tag);
+
+  int fd_num() const { return sock_.fd_num(); }
+
+ private:
+  IPCSocket sock_;
+  std::string outbox_;
+  // frames received, [begin_, end_) not yet handed out
+  std::vector<char> inbox_;
+  size_t begin_;
+  size_t end_;
+};
+
+#endif  // INFERENCE_TRANSPORT_HH
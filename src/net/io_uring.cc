@@ -0,0 +1,266 @@
+#include "io_uring.hh"
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include "exception.hh"
+
+using namespace std;
+
+static int io_uring_setup(unsigned entries, io_uring_params* params) {
+  return syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int io_uring_enter(int fd, unsigned to_submit, unsigned min_complete,
+                          unsigned flags) {
+  return syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags,
+                 nullptr, 0);
+}
+
+static int io_uring_register(int fd, unsigned opcode, const void* arg,
+                             unsigned nr_args) {
+  return syscall(__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+static io_uring_params make_params(unsigned flags) {
+  io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  params.flags = flags;
+  return params;
+}
+
+/* set up the ring first: the other members are mapped from its fd */
+static int setup_ring(unsigned entries, io_uring_params& params) {
+  return SystemCall("io_uring_setup", io_uring_setup(entries, &params));
+}
+
+template <typename T>
+static T* at(const MMapRegion& region, unsigned offset) {
+  return reinterpret_cast<T*>(region.data() + offset);
+}
+
+IOUring::IOUring(const unsigned entries, const unsigned flags)
+    : params_(make_params(flags)),
+      fd_(setup_ring(entries, params_)),
+      sq_ring_(fd_.fd_num(), IORING_OFF_SQ_RING,
+               params_.sq_off.array + params_.sq_entries * sizeof(unsigned),
+               PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE),
+      cq_ring_(fd_.fd_num(), IORING_OFF_CQ_RING,
+               params_.cq_off.cqes +
+                   params_.cq_entries * sizeof(io_uring_cqe),
+               PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE),
+      sqe_region_(fd_.fd_num(), IORING_OFF_SQES,
+                  params_.sq_entries * sizeof(io_uring_sqe),
+                  PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE),
+      sq_tail_(at<unsigned>(sq_ring_, params_.sq_off.tail)),
+      sq_array_(at<unsigned>(sq_ring_, params_.sq_off.array)),
+      sq_mask_(*at<unsigned>(sq_ring_, params_.sq_off.ring_mask)),
+      sqes_(reinterpret_cast<io_uring_sqe*>(sqe_region_.data())),
+      sqe_tail_(*sq_tail_),
+      sqe_head_(*sq_tail_),
+      cq_head_(at<unsigned>(cq_ring_, params_.cq_off.head)),
+      cq_tail_(at<unsigned>(cq_ring_, params_.cq_off.tail)),
+      cq_mask_(*at<unsigned>(cq_ring_, params_.cq_off.ring_mask)),
+      cqes_(at<io_uring_cqe>(cq_ring_, params_.cq_off.cqes)) {
+  // the entries are used in order, so the index array is the identity
+  for (unsigned i = 0; i < params_.sq_entries; i++) {
+    sq_array_[i] = i;
+  }
+}
+
+bool IOUring::available() {
+  io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  const int fd = io_uring_setup(2, &params);
+  if (fd < 0) {
+    return false;
+  }
+  // io_uring_setup exists since 5.1, but most of the operations below came
+  // later: ask the ring which it supports (IORING_REGISTER_PROBE, 5.6)
+  const unsigned kProbeOps = 256;
+  vector<char> memory(sizeof(io_uring_probe) +
+                      kProbeOps * sizeof(io_uring_probe_op));
+  io_uring_probe* probe = reinterpret_cast<io_uring_probe*>(memory.data());
+  const bool probed =
+      io_uring_register(fd, IORING_REGISTER_PROBE, probe, kProbeOps) == 0;
+  ::close(fd);
+  if (not probed) {
+    return false;
+  }
+  // IORING_OP_SEND_ZC (6.0) stands for the flags that came with or before
+  // it: multishot receives (6.0), multishot accept (5.19) and
+  // IOSQE_CQE_SKIP_SUCCESS (5.17)
+  for (const uint8_t op :
+       {IORING_OP_READ, IORING_OP_SEND, IORING_OP_SENDMSG, IORING_OP_SEND_ZC,
+        IORING_OP_ACCEPT, IORING_OP_RECV, IORING_OP_RECVMSG,
+        IORING_OP_TIMEOUT, IORING_OP_ASYNC_CANCEL,
+        IORING_OP_PROVIDE_BUFFERS}) {
+    if (op >= probe->ops_len or
+        not(probe->ops[op].flags & IO_URING_OP_SUPPORTED)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+io_uring_sqe& IOUring::get_sqe() {
+  if (sqe_tail_ - sqe_head_ == params_.sq_entries) {
+    submit();
+  }
+  io_uring_sqe& sqe = sqes_[sqe_tail_ & sq_mask_];
+  memset(&sqe, 0, sizeof(sqe));
+  sqe_tail_++;
+  return sqe;
+}
+
+/* the fields every operation sets */
+static io_uring_sqe& prep(io_uring_sqe& sqe, uint8_t opcode, int fd,
+                          const void* addr, unsigned length,
+                          uint64_t user_data) {
+  sqe.opcode = opcode;
+  sqe.fd = fd;
+  sqe.addr = reinterpret_cast<uint64_t>(addr);
+  sqe.len = length;
+  sqe.user_data = user_data;
+  return sqe;
+}
+
+io_uring_sqe& IOUring::prep_read(const int fd, void* buffer,
+                                 const unsigned length,
+                                 const uint64_t user_data) {
+  return prep(get_sqe(), IORING_OP_READ, fd, buffer, length, user_data);
+}
+
+io_uring_sqe& IOUring::prep_send(const int fd, const void* data,
+                                 const size_t length,
+                                 const uint64_t user_data, const int flags) {
+  io_uring_sqe& sqe =
+      prep(get_sqe(), IORING_OP_SEND, fd, data, length, user_data);
+  sqe.msg_flags = flags;
+  return sqe;
+}
+
+io_uring_sqe& IOUring::prep_sendmsg(const int fd, const msghdr* message,
+                                    const uint64_t user_data) {
+  return prep(get_sqe(), IORING_OP_SENDMSG, fd, message, 1, user_data);
+}
+
+io_uring_sqe& IOUring::prep_send_zc(const int fd, const void* data,
+                                    const size_t length,
+                                    const uint64_t user_data,
+                                    const int buffer_index) {
+  io_uring_sqe& sqe =
+      prep(get_sqe(), IORING_OP_SEND_ZC, fd, data, length, user_data);
+  if (buffer_index >= 0) {
+    sqe.ioprio |= IORING_RECVSEND_FIXED_BUF;
+    sqe.buf_index = buffer_index;
+  }
+  return sqe;
+}
+
+io_uring_sqe& IOUring::prep_accept_multishot(const int fd,
+                                             const uint64_t user_data) {
+  io_uring_sqe& sqe =
+      prep(get_sqe(), IORING_OP_ACCEPT, fd, nullptr, 0, user_data);
+  sqe.ioprio |= IORING_ACCEPT_MULTISHOT;
+  return sqe;
+}
+
+io_uring_sqe& IOUring::prep_recv_multishot(const int fd,
+                                           const uint16_t group,
+                                           const uint64_t user_data) {
+  io_uring_sqe& sqe =
+      prep(get_sqe(), IORING_OP_RECV, fd, nullptr, 0, user_data);
+  sqe.ioprio |= IORING_RECV_MULTISHOT;
+  sqe.flags |= IOSQE_BUFFER_SELECT;
+  sqe.buf_group = group;
+  return sqe;
+}
+
+io_uring_sqe& IOUring::prep_recvmsg_multishot(const int fd,
+                                              const msghdr* message,
+                                              const uint16_t group,
+                                              const uint64_t user_data) {
+  io_uring_sqe& sqe =
+      prep(get_sqe(), IORING_OP_RECVMSG, fd, message, 1, user_data);
+  sqe.ioprio |= IORING_RECV_MULTISHOT;
+  sqe.flags |= IOSQE_BUFFER_SELECT;
+  sqe.buf_group = group;
+  return sqe;
+}
+
+io_uring_sqe& IOUring::prep_timeout(const __kernel_timespec* timeout,
+                                    const uint64_t user_data) {
+  return prep(get_sqe(), IORING_OP_TIMEOUT, -1, timeout, 1, user_data);
+}
+
+io_uring_sqe& IOUring::prep_cancel(const uint64_t target,
+                                   const uint64_t user_data) {
+  io_uring_sqe& sqe =
+      prep(get_sqe(), IORING_OP_ASYNC_CANCEL, -1, nullptr, 0, user_data);
+  sqe.addr = target;
+  sqe.cancel_flags = IORING_ASYNC_CANCEL_ALL;
+  return sqe;
+}
+
+unsigned IOUring::submit(const unsigned wait_for) {
+  const unsigned to_submit = sqe_tail_ - sqe_head_;
+  __atomic_store_n(sq_tail_, sqe_tail_, __ATOMIC_RELEASE);
+  sqe_head_ = sqe_tail_;
+  if (to_submit == 0 and wait_for == 0) {
+    return 0;
+  }
+
+  const unsigned flags = wait_for ? IORING_ENTER_GETEVENTS : 0;
+  while (true) {
+    const int ret = io_uring_enter(fd_.fd_num(), to_submit, wait_for, flags);
+    if (ret < 0 and errno == EINTR) {
+      // whatever was submitted stays submitted; only the wait is retried
+      if (wait_for == 0) {
+        return 0;
+      }
+      continue;
+    }
+    return SystemCall("io_uring_enter", ret);
+  }
+}
+
+void IOUring::register_buffers(const iovec* iov, const unsigned count) {
+  SystemCall("io_uring_register buffers",
+             io_uring_register(fd_.fd_num(), IORING_REGISTER_BUFFERS, iov,
+                               count));
+}
+
+void IOUring::register_files(const int* fds, const unsigned count) {
+  SystemCall("io_uring_register files",
+             io_uring_register(fd_.fd_num(), IORING_REGISTER_FILES, fds,
+                               count));
+}
+
+BufferGroup::BufferGroup(IOUring& ring, const uint16_t group,
+                         const unsigned count, const size_t buffer_size)
+    : ring_(ring),
+      group_(group),
+      buffer_size_(buffer_size),
+      buffers_(-1, 0, count * buffer_size, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS) {
+  if (count == 0 or count > 65536 or buffer_size == 0 or
+      buffer_size > INT32_MAX) {
+    throw runtime_error("BufferGroup: invalid size");
+  }
+  provide(0, count);
+  ring_.submit();
+}
+
+void BufferGroup::provide(const uint16_t first, const unsigned count) {
+  // a run of `count` buffers starting at `first`; the fd field is the count
+  io_uring_sqe& sqe = prep(ring_.get_sqe(), IORING_OP_PROVIDE_BUFFERS, count,
+                           buffer(first), buffer_size_, PROVIDE_TAG);
+  sqe.off = first;
+  sqe.buf_group = group_;
+  sqe.flags |= IOSQE_CQE_SKIP_SUCCESS;
+}
@@ -0,0 +1,171 @@
+#ifndef IO_URING_HH
+#define IO_URING_HH
+
+#include <linux/io_uring.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include <cstdint>
+
+#include "file_descriptor.hh"
+#include "mmap_region.hh"
+
+/**
+ * @brief One io_uring instance: a submission and a completion ring shared
+ * with the kernel.
+ *
+ * Talks to the kernel through the raw syscalls, so it needs only the
+ * kernel headers. Operations are prepared into the submission ring with
+ * the prep_*() helpers and handed over together by one submit(), which can
+ * also wait for completions in the same syscall. Completions are consumed
+ * in place by drain().
+ *
+ * Not thread-safe: one thread prepares, submits and drains.
+ */
+class IOUring {
+ public:
+  explicit IOUring(const unsigned entries, const unsigned flags = 0);
+
+  IOUring(const IOUring&) = delete;
+  IOUring& operator=(const IOUring&) = delete;
+
+  /* whether the kernel lets this process set up a ring that supports every
+   * operation prepared below */
+  static bool available();
+
+  /* a zeroed entry; submits what is prepared first if the ring is full */
+  io_uring_sqe& get_sqe();
+
+  /* the entries are returned for extra flags, e.g. IOSQE_FIXED_FILE */
+  io_uring_sqe& prep_read(const int fd, void* buffer, const unsigned length,
+                          const uint64_t user_data);
+  io_uring_sqe& prep_send(const int fd, const void* data, const size_t length,
+                          const uint64_t user_data, const int flags = 0);
+  io_uring_sqe& prep_sendmsg(const int fd, const msghdr* message,
+                             const uint64_t user_data);
+  /**
+   * Zero-copy send. It completes twice: first with the result (and
+   * IORING_CQE_F_MORE), then with IORING_CQE_F_NOTIF once the kernel no
+   * longer reads `data`. `buffer_index` names a registered buffer that
+   * holds `data`, which saves pinning the pages on every send.
+   */
+  io_uring_sqe& prep_send_zc(const int fd, const void* data,
+                             const size_t length, const uint64_t user_data,
+                             const int buffer_index = -1);
+  /* one completion per connection, the result being its fd */
+  io_uring_sqe& prep_accept_multishot(const int fd, const uint64_t user_data);
+  /* one completion per receive, into a buffer of `group` (see BufferGroup) */
+  io_uring_sqe& prep_recv_multishot(const int fd, const uint16_t group,
+                                    const uint64_t user_data);
+  /**
+   * The same for datagrams: each buffer starts with an io_uring_recvmsg_out
+   * followed by msg_namelen bytes of source address, msg_controllen bytes
+   * of control data and the payload.
+   */
+  io_uring_sqe& prep_recvmsg_multishot(const int fd, const msghdr* message,
+                                       const uint16_t group,
+                                       const uint64_t user_data);
+  /* completes with -ETIME after `timeout`, which must outlive it */
+  io_uring_sqe& prep_timeout(const __kernel_timespec* timeout,
+                             const uint64_t user_data);
+  /* cancel the operations tagged with `target` */
+  io_uring_sqe& prep_cancel(const uint64_t target, const uint64_t user_data);
+
+  /**
+   * @brief Hand every prepared entry to the kernel.
+   *
+   * With `wait_for` above zero, the same syscall also waits until that many
+   * completions are ready. Returns the number of entries submitted.
+   */
+  unsigned submit(const unsigned wait_for = 0);
+
+  /* pass every ready completion to handler(const io_uring_cqe&) */
+  template <typename Handler>
+  unsigned drain(Handler&& handler) {
+    unsigned head = *cq_head_, count = 0;
+    const unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+    while (head != tail) {
+      handler(cqes_[head & cq_mask_]);
+      head++;
+      count++;
+      // the handler may prepare entries, but the slot is freed only here
+      __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+    }
+    return count;
+  }
+
+  /* buffers for the fixed-buffer operations, e.g. prep_send_zc */
+  void register_buffers(const iovec* iov, const unsigned count);
+  /* after this, operations with IOSQE_FIXED_FILE take an index, not a fd */
+  void register_files(const int* fds, const unsigned count);
+
+  int fd_num() const { return fd_.fd_num(); }
+  /* entries prepared but not yet submitted */
+  unsigned pending() const { return sqe_tail_ - sqe_head_; }
+
+ private:
+  // filled in by io_uring_setup, which fd_ runs
+  io_uring_params params_;
+  FileDescriptor fd_;
+
+  MMapRegion sq_ring_;
+  MMapRegion cq_ring_;
+  MMapRegion sqe_region_;
+
+  unsigned* sq_tail_;
+  unsigned* sq_array_;
+  unsigned sq_mask_;
+  io_uring_sqe* sqes_;
+  // entries prepared / handed to the kernel so far
+  unsigned sqe_tail_;
+  unsigned sqe_head_;
+
+  unsigned* cq_head_;
+  unsigned* cq_tail_;
+  unsigned cq_mask_;
+  io_uring_cqe* cqes_;
+};
+
+/**
+ * @brief Buffers the kernel picks from for multishot receives.
+ *
+ * `count` buffers of `buffer_size` bytes are provided to the ring as buffer
+ * group `group`. A completion names its buffer in cqe.flags (see
+ * buffer_id()); the buffer belongs to the caller until recycle(), which
+ * prepares an entry that hands it back with the next submit(). These
+ * entries complete only if they fail, with user_data PROVIDE_TAG.
+ */
+class BufferGroup {
+ public:
+  static constexpr uint64_t PROVIDE_TAG = UINT64_MAX;
+
+  BufferGroup(IOUring& ring, const uint16_t group, const unsigned count,
+              const size_t buffer_size);
+
+  BufferGroup(const BufferGroup&) = delete;
+  BufferGroup& operator=(const BufferGroup&) = delete;
+
+  /* the buffer a completion used, if it has IORING_CQE_F_BUFFER */
+  static uint16_t buffer_id(const io_uring_cqe& cqe) {
+    return cqe.flags >> IORING_CQE_BUFFER_SHIFT;
+  }
+
+  char* buffer(const uint16_t id) const {
+    return buffers_.data() + size_t(id) * buffer_size_;
+  }
+  size_t buffer_size() const { return buffer_size_; }
+  uint16_t group() const { return group_; }
+
+  /* give a buffer back to the kernel */
+  void recycle(const uint16_t id) { provide(id, 1); }
+
+ private:
+  void provide(const uint16_t first, const unsigned count);
+
+  IOUring& ring_;
+  uint16_t group_;
+  size_t buffer_size_;
+  MMapRegion buffers_;
+};
+
+#endif  // IO_URING_HH
@@ -102,18 +102,41 @@ bool IPCSocket::check_blocking() {
 
 string::const_iterator IPCSocket::write(const std::string& buffer,
                                         const bool write_all) {
-  if (not connected_.load()) return buffer.begin();
+  return buffer.begin() + write_from(buffer.data(), buffer.size(), write_all);
+}
+
+size_t IPCSocket::write_from(const char* data, const size_t length,
+                             const bool write_all) {
+  if (not connected_.load()) return 0;
+
+  size_t done = 0;
+  do {
+    ssize_t bytes_written = ::write(fd_num(), data + done, length - done);
+    if (bytes_written <= 0 or errno == EPIPE or errno == EBADF) {
+      connected_.store(false);
+      return done;
+    }
+    register_write();
+    done += bytes_written;
+  } while (write_all and done < length);
+
+  return done;
+}
+
+size_t IPCSocket::writev(iovec* iov, int iovcnt, const bool write_all) {
+  if (not connected_.load()) return 0;
 
-  auto it = buffer.begin();
+  size_t done = 0;
   do {
-    ssize_t bytes_written = ::write(fd_num(), &*it, buffer.end() - it);
+    ssize_t bytes_written = ::writev(fd_num(), iov, iovcnt);
     if (bytes_written <= 0 or errno == EPIPE or errno == EBADF) {
       connected_.store(false);
-      return it;
+      return done;
     }
     register_write();
-    it += bytes_written;
-  } while (write_all and (it != buffer.end()));
+    done += bytes_written;
+    iovcnt = consume_iovec(iov, iovcnt, bytes_written);
+  } while (write_all and iovcnt > 0);
 
-  return it;
+  return done;
 }
\ No newline at end of file
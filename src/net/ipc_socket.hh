@@ -39,6 +39,10 @@ class IPCSocket : public FileDescriptor {
   /* override write; add sanity check*/
   virtual std::string::const_iterator write(const std::string& buffer,
                                             const bool write_all = true);
+  size_t write_from(const char* data, const size_t length,
+                    const bool write_all = true) override;
+  size_t writev(iovec* iov, const int iovcnt,
+                const bool write_all = true) override;
 
  protected:
   /* get and set socket option */
@@ -7,6 +7,8 @@
 #include <sstream>
 #include <cstdio>
 
+#include "async_logger.hh"
+
 LogMessage::LogMessage(const char* fname, int line, LogLevel severity)
     : fname_(fname), line_(line), severity_(severity) {}
 
@@ -39,14 +41,18 @@ void LogMessage::GenerateLogMessage(bool log_time) {
     stream << "[" << LOG_LEVELS[static_cast<int>(severity_)] << " " << fname_ << ":"
        << line_ << "] " << str() << std::endl;
   }
-  // dump stream.str to stdout/stderr
-  fprintf(os, stream.str().c_str());
+  // dump stream.str to stdout/stderr, or hand it to the background writer
+  const std::string line = stream.str();
+  if (not use_cout and AsyncLogger::Get()->enabled()) {
+    AsyncLogger::Get()->submit(line);
+  } else {
+    fwrite(line.data(), 1, line.size(), os);
+  }
 }
 
 LogMessage::~LogMessage() {
-  static LogLevel min_log_level = MinLogLevelFromEnv();
   static bool log_time = LogTimeFromEnv();
-  if (severity_ >= min_log_level) {
+  if (severity_ >= MinLogLevel()) {
     GenerateLogMessage(log_time);
   }
 }
@@ -56,6 +62,8 @@ LogMessageFatal::LogMessageFatal(const char* file, int line)
 
 LogMessageFatal::~LogMessageFatal() {
   static bool log_time = LogTimeFromEnv();
+  // make sure earlier messages and this one reach stderr before aborting
+  AsyncLogger::Get()->stop();
   GenerateLogMessage(log_time);
   abort();
 }
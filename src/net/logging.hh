@@ -10,6 +10,12 @@ enum class LogLevel { TRACE, DEBUG, INFO, WARNING, ERROR, FATAL };
 
 #define LOG_LEVELS "TDIWEF"
 
+/* Messages below this level are compiled out entirely, e.g.
+ * -DLOG_COMPILE_LEVEL=2 drops TRACE and DEBUG statements. */
+#ifndef LOG_COMPILE_LEVEL
+#define LOG_COMPILE_LEVEL 0
+#endif
+
 // Always-on checking
 #define CHECK(x) \
   if (!(x))      \
@@ -48,6 +54,15 @@ enum class LogLevel { TRACE, DEBUG, INFO, WARNING, ERROR, FATAL };
     CHECK(r == ncclSuccess) << "NCCL error: " << ncclGetErrorString(r); \
   }
 
+LogLevel MinLogLevelFromEnv();
+bool LogTimeFromEnv();
+
+/* runtime threshold, read once from LOG_LEVEL */
+inline LogLevel MinLogLevel() {
+  static const LogLevel min_log_level = MinLogLevelFromEnv();
+  return min_log_level;
+}
+
 class LogMessage : public std::basic_ostringstream<char> {
  public:
   LogMessage(const char* fname, int line, LogLevel severity);
@@ -77,14 +92,25 @@ class LogMessageFatal : public LogMessage {
 #define _LOG_ERROR LogMessage(__FILE__, __LINE__, LogLevel::ERROR)
 #define _LOG_FATAL LogMessageFatal(__FILE__, __LINE__)
 
-#define _LOG(severity) _LOG_##severity
+// Turns the streamed LogMessage into void so it fits the ternary in _LOG.
+// operator& binds looser than << and tighter than ?:.
+class LogMessageVoidify {
+ public:
+  void operator&(const std::ostream&) {}
+};
+
+#define LOG_IS_ON(severity)                                          \
+  (static_cast<int>(LogLevel::severity) >= LOG_COMPILE_LEVEL and     \
+   LogLevel::severity >= MinLogLevel())
+
+// A filtered message neither constructs a LogMessage nor evaluates its
+// streamed arguments.
+#define _LOG(severity) \
+  !LOG_IS_ON(severity) ? (void)0 : LogMessageVoidify() & _LOG_##severity
 
-#define _LOG_RANK(severity, rank) _LOG_##severity << "[" << rank << "]: "
+#define _LOG_RANK(severity, rank) _LOG(severity) << "[" << rank << "]: "
 
 #define GET_LOG(_1, _2, NAME, ...) NAME
 #define LOG(...) GET_LOG(__VA_ARGS__, _LOG_RANK, _LOG)(__VA_ARGS__)
 
-LogLevel MinLogLevelFromEnv();
-bool LogTimeFromEnv();
-
 #endif  // LOGGING_HH
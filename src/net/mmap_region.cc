@@ -0,0 +1,54 @@
+#include "mmap_region.hh"
+
+#include <unistd.h>
+
+#include <utility>
+
+#include "exception.hh"
+
+MMapRegion::MMapRegion(const int fd, const uint64_t offset,
+                       const size_t length, const int prot, const int flags)
+    : base_(nullptr), skew_(0), length_(length) {
+  static const uint64_t page_size = sysconf(_SC_PAGESIZE);
+  const uint64_t aligned = offset & ~(page_size - 1);
+  skew_ = offset - aligned;
+  void* addr = ::mmap(nullptr, skew_ + length_, prot, flags, fd, aligned);
+  if (addr == MAP_FAILED) {
+    throw unix_error("mmap");
+  }
+  base_ = addr;
+}
+
+MMapRegion::~MMapRegion() {
+  if (base_ != nullptr) {
+    ::munmap(base_, skew_ + length_);
+  }
+}
+
+MMapRegion::MMapRegion(MMapRegion&& other)
+    : base_(std::exchange(other.base_, nullptr)),
+      skew_(other.skew_),
+      length_(other.length_) {}
+
+MMapRegion& MMapRegion::operator=(MMapRegion&& other) {
+  if (this != &other) {
+    unmap();
+    base_ = std::exchange(other.base_, nullptr);
+    skew_ = other.skew_;
+    length_ = other.length_;
+  }
+  return *this;
+}
+
+void MMapRegion::sync_async() {
+  if (base_ != nullptr) {
+    SystemCall("msync", ::msync(base_, skew_ + length_, MS_ASYNC));
+  }
+}
+
+void MMapRegion::unmap() {
+  if (base_ != nullptr) {
+    SystemCall("munmap", ::munmap(base_, skew_ + length_));
+    base_ = nullptr;
+  }
+}
@@ -0,0 +1,38 @@
+#ifndef MMAP_REGION_HH
+#define MMAP_REGION_HH
+
+#include <sys/mman.h>
+
+#include <cstddef>
+#include <cstdint>
+
+/* memory-mapped window of a file; offset need not be page aligned */
+class MMapRegion {
+ public:
+  MMapRegion() {}
+  MMapRegion(const int fd, const uint64_t offset, const size_t length,
+             const int prot, const int flags = MAP_SHARED);
+  ~MMapRegion();
+
+  MMapRegion(MMapRegion&& other);
+  MMapRegion& operator=(MMapRegion&& other);
+
+  MMapRegion(const MMapRegion&) = delete;
+  MMapRegion& operator=(const MMapRegion&) = delete;
+
+  /* start of the requested range */
+  char* data() const { return static_cast<char*>(base_) + skew_; }
+  size_t size() const { return length_; }
+  explicit operator bool() const { return base_ != nullptr; }
+
+  /* schedule write-back of dirty pages without waiting for it */
+  void sync_async();
+  void unmap();
+
+ private:
+  void* base_{nullptr};
+  size_t skew_{0};
+  size_t length_{0};
+};
+
+#endif  // MMAP_REGION_HH
@@ -0,0 +1,139 @@
+#include "perf_log.hh"
+
+#include <fcntl.h>
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+#include "exception.hh"
+
+using namespace std;
+
+uint64_t PerfValue::cell(PerfType type) const {
+  uint64_t out = 0;
+  switch (type) {
+  case PerfType::U64: {
+    const uint64_t v = kind_ == PerfType::U64   ? u_
+                       : kind_ == PerfType::I64 ? static_cast<uint64_t>(i_)
+                                                : static_cast<uint64_t>(f_);
+    out = v;
+    break;
+  }
+  case PerfType::I64: {
+    const int64_t v = kind_ == PerfType::U64   ? static_cast<int64_t>(u_)
+                      : kind_ == PerfType::I64 ? i_
+                                               : static_cast<int64_t>(f_);
+    memcpy(&out, &v, sizeof(v));
+    break;
+  }
+  case PerfType::F64: {
+    const double v = kind_ == PerfType::U64   ? static_cast<double>(u_)
+                     : kind_ == PerfType::I64 ? static_cast<double>(i_)
+                                              : f_;
+    memcpy(&out, &v, sizeof(v));
+    break;
+  }
+  }
+  return out;
+}
+
+PerfLog::PerfLog(const string& path, const vector<PerfColumn>& columns)
+    : columns_(columns),
+      fd_(SystemCall(path, ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC,
+                                  0644))),
+      file_size_(0),
+      header_(nullptr),
+      cells_(nullptr),
+      capacity_(0),
+      rows_(0) {
+  if (columns_.empty()) {
+    throw runtime_error("PerfLog: no columns");
+  }
+  write_header();
+  start_segment(kMinSegmentRows);
+}
+
+PerfLog::~PerfLog() {
+  try {
+    close();
+  } catch (const exception& e) {
+    cerr << "PerfLog: " << e.what() << endl;
+  }
+}
+
+void PerfLog::write_header() {
+  perf_format::FileHeader header{};
+  memcpy(header.magic, perf_format::kMagic, sizeof(header.magic));
+  header.version = perf_format::kVersion;
+  header.num_columns = columns_.size();
+  string buf(reinterpret_cast<const char*>(&header), sizeof(header));
+
+  for (const auto& column : columns_) {
+    if (column.name.size() >= perf_format::kNameSize) {
+      throw runtime_error("PerfLog: column name too long: " + column.name);
+    }
+    perf_format::ColumnDesc desc{};
+    strncpy(desc.name, column.name.c_str(), perf_format::kNameSize - 1);
+    desc.type = static_cast<uint8_t>(column.type);
+    buf.append(reinterpret_cast<const char*>(&desc), sizeof(desc));
+  }
+  fd_.write(buf);
+  file_size_ = buf.size();
+}
+
+void PerfLog::start_segment(size_t capacity) {
+  if (segment_) {
+    segment_.sync_async();
+    segment_.unmap();
+  }
+
+  const uint64_t bytes = perf_format::segment_bytes(columns_.size(), capacity);
+  /* reserve the blocks now so a full disk fails here, not with SIGBUS */
+  const int err = ::posix_fallocate(fd_.fd_num(), file_size_, bytes);
+  if (err != 0) {
+    throw unix_error("posix_fallocate", err);
+  }
+  segment_ = MMapRegion(fd_.fd_num(), file_size_, bytes,
+                        PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE);
+  file_size_ += bytes;
+
+  header_ = reinterpret_cast<perf_format::SegmentHeader*>(segment_.data());
+  header_->magic = perf_format::kSegmentMagic;
+  header_->capacity = capacity;
+  perf_format::publish_rows(header_, 0);
+  cells_ = reinterpret_cast<uint64_t*>(segment_.data() +
+                                       sizeof(perf_format::SegmentHeader));
+  capacity_ = capacity;
+  rows_ = 0;
+}
+
+void PerfLog::append(initializer_list<PerfValue> row) {
+  if (row.size() != columns_.size()) {
+    throw runtime_error("PerfLog: row does not match the column count");
+  }
+  if (not segment_) {
+    return; /* already closed */
+  }
+  if (rows_ == capacity_) {
+    start_segment(min(capacity_ * 2, kMaxSegmentRows));
+  }
+
+  size_t c = 0;
+  for (const auto& value : row) {
+    cells_[c * capacity_ + rows_] = value.cell(columns_[c].type);
+    c++;
+  }
+  perf_format::publish_rows(header_, ++rows_);
+}
+
+void PerfLog::close() {
+  if (not segment_) {
+    return;
+  }
+  segment_.unmap();
+  header_ = nullptr;
+  cells_ = nullptr;
+  fd_.close();
+}
@@ -0,0 +1,157 @@
+#ifndef PERF_LOG_HH
+#define PERF_LOG_HH
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "file_descriptor.hh"
+#include "mmap_region.hh"
+
+/**
+ * Binary performance log.
+ *
+ * File layout (little endian):
+ *   FileHeader | ColumnDesc * num_columns | Segment ...
+ * Each segment is a SegmentHeader followed by one region per column holding
+ * `capacity` 8-byte cells, so every column of a segment is contiguous.
+ * Only the first `rows` cells of each region are valid.
+ *
+ * PerfLogReader (perf_log_reader.hh) and python/helpers/perf_log.py map
+ * the file and expose the columns without copying them.
+ */
+namespace perf_format {
+
+constexpr char kMagic[8] = {'A', 'S', 'T', 'R', 'P', 'E', 'R', 'F'};
+constexpr uint32_t kVersion = 1;
+constexpr size_t kNameSize = 32;
+/* "SEGM" */
+constexpr uint32_t kSegmentMagic = 0x4d474553;
+
+struct FileHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t num_columns;
+};
+
+struct ColumnDesc {
+  char name[kNameSize];
+  uint8_t type;
+  uint8_t reserved[7];
+};
+
+struct SegmentHeader {
+  uint32_t magic;
+  uint32_t reserved;
+  uint64_t capacity;
+  uint64_t rows;
+};
+
+static_assert(sizeof(FileHeader) == 16, "unexpected FileHeader layout");
+static_assert(sizeof(ColumnDesc) == 40, "unexpected ColumnDesc layout");
+static_assert(sizeof(SegmentHeader) == 24, "unexpected SegmentHeader layout");
+
+inline uint64_t segment_bytes(size_t num_columns, uint64_t capacity) {
+  return sizeof(SegmentHeader) + num_columns * capacity * sizeof(uint64_t);
+}
+
+/* `rows` is written by the logger while readers may map the file */
+inline void publish_rows(SegmentHeader* header, uint64_t rows) {
+  __atomic_store_n(&header->rows, rows, __ATOMIC_RELEASE);
+}
+
+inline uint64_t load_rows(const SegmentHeader* header) {
+  return __atomic_load_n(&header->rows, __ATOMIC_ACQUIRE);
+}
+
+}  // namespace perf_format
+
+enum class PerfType : uint8_t { U64 = 0, I64 = 1, F64 = 2 };
+
+struct PerfColumn {
+  std::string name;
+  PerfType type;
+};
+
+/* one cell of a row; converted to the column's type on append */
+class PerfValue {
+ public:
+  template <typename T,
+            typename = std::enable_if_t<std::is_arithmetic<T>::value>>
+  PerfValue(T v) : kind_(kind_of<T>()), u_(0), i_(0), f_(0) {
+    if constexpr (std::is_floating_point<T>::value) {
+      f_ = static_cast<double>(v);
+    } else if constexpr (std::is_signed<T>::value) {
+      i_ = static_cast<int64_t>(v);
+    } else {
+      u_ = static_cast<uint64_t>(v);
+    }
+  }
+
+  /* raw 8-byte cell for a column of the given type */
+  uint64_t cell(PerfType type) const;
+
+ private:
+  template <typename T>
+  static constexpr PerfType kind_of() {
+    return std::is_floating_point<T>::value
+               ? PerfType::F64
+               : (std::is_signed<T>::value ? PerfType::I64 : PerfType::U64);
+  }
+
+  PerfType kind_;
+  uint64_t u_;
+  int64_t i_;
+  double f_;
+};
+
+/**
+ * @brief Writer of the binary performance log.
+ *
+ * The file is append-only and grown one segment at a time: each segment is
+ * preallocated on disk and mapped into memory, so append() only stores the
+ * cells and bumps the segment's row count. Write-back is left to the page
+ * cache, and a reader mapping the file while it is written sees every
+ * published row. Segment capacity doubles up to kMaxSegmentRows so short
+ * runs stay small.
+ */
+class PerfLog {
+ public:
+  static constexpr size_t kMinSegmentRows = 4096;
+  static constexpr size_t kMaxSegmentRows = 1 << 18;
+
+  PerfLog(const std::string& path, const std::vector<PerfColumn>& columns);
+  ~PerfLog();
+
+  PerfLog(const PerfLog&) = delete;
+  PerfLog& operator=(const PerfLog&) = delete;
+
+  /* append one row; values must follow the column order */
+  void append(std::initializer_list<PerfValue> row);
+
+  /* unmap the current segment and close the file; not while another thread
+   * may append */
+  void close();
+
+  size_t num_columns() const { return columns_.size(); }
+
+ private:
+  void write_header();
+  void start_segment(size_t capacity);
+
+ private:
+  std::vector<PerfColumn> columns_;
+  FileDescriptor fd_;
+  uint64_t file_size_;
+
+  /* segment currently being filled */
+  MMapRegion segment_{};
+  perf_format::SegmentHeader* header_;
+  uint64_t* cells_;
+  size_t capacity_;
+  size_t rows_;
+};
+
+#endif  // PERF_LOG_HH
@@ -0,0 +1,77 @@
+#include "perf_log_reader.hh"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#include <cstring>
+
+#include "exception.hh"
+
+using namespace std;
+
+PerfLogReader::PerfLogReader(const string& path)
+    : fd_(SystemCall(path, ::open(path.c_str(), O_RDONLY))), num_rows_(0) {
+  struct stat st;
+  SystemCall("fstat", ::fstat(fd_.fd_num(), &st));
+  const uint64_t file_size = st.st_size;
+  if (file_size < sizeof(perf_format::FileHeader)) {
+    throw runtime_error(path + ": not a perf log");
+  }
+  map_ = MMapRegion(fd_.fd_num(), 0, file_size, PROT_READ);
+  const char* base = map_.data();
+
+  perf_format::FileHeader header;
+  memcpy(&header, base, sizeof(header));
+  if (memcmp(header.magic, perf_format::kMagic, sizeof(header.magic)) != 0) {
+    throw runtime_error(path + ": not a perf log");
+  }
+  if (header.version != perf_format::kVersion) {
+    throw runtime_error(path + ": unsupported perf log version " +
+                        to_string(header.version));
+  }
+
+  uint64_t offset = sizeof(header);
+  if (offset + header.num_columns * sizeof(perf_format::ColumnDesc) >
+      file_size) {
+    throw runtime_error(path + ": truncated column table");
+  }
+  for (uint32_t i = 0; i < header.num_columns; i++) {
+    perf_format::ColumnDesc desc;
+    memcpy(&desc, base + offset, sizeof(desc));
+    desc.name[perf_format::kNameSize - 1] = '\0';
+    if (desc.type > static_cast<uint8_t>(PerfType::F64)) {
+      throw runtime_error(path + ": unknown column type");
+    }
+    columns_.push_back({desc.name, static_cast<PerfType>(desc.type)});
+    offset += sizeof(desc);
+  }
+
+  /* a segment cut short (e.g. by a crash while growing) ends the log */
+  while (offset + sizeof(perf_format::SegmentHeader) <= file_size) {
+    const auto* seg =
+        reinterpret_cast<const perf_format::SegmentHeader*>(base + offset);
+    if (seg->magic != perf_format::kSegmentMagic) {
+      throw runtime_error(path + ": corrupted segment at offset " +
+                          to_string(offset));
+    }
+    const uint64_t bytes =
+        perf_format::segment_bytes(columns_.size(), seg->capacity);
+    if (offset + bytes > file_size) {
+      break;
+    }
+    const uint64_t rows = min(perf_format::load_rows(seg), seg->capacity);
+    segments_.push_back(
+        {reinterpret_cast<const uint64_t*>(seg + 1), seg->capacity, rows});
+    num_rows_ += rows;
+    offset += bytes;
+  }
+}
+
+size_t PerfLogReader::column_index(const string& name) const {
+  for (size_t i = 0; i < columns_.size(); i++) {
+    if (columns_[i].name == name) {
+      return i;
+    }
+  }
+  throw out_of_range("PerfLogReader: no column named " + name);
+}
@@ -0,0 +1,114 @@
+#ifndef PERF_LOG_READER_HH
+#define PERF_LOG_READER_HH
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "file_descriptor.hh"
+#include "mmap_region.hh"
+#include "perf_log.hh"
+
+/* contiguous run of one column inside a segment; points into the mapping */
+template <typename T>
+struct PerfSlice {
+  const T* data;
+  size_t size;
+};
+
+/**
+ * @brief Read-only view of a binary performance log.
+ *
+ * The whole file is mapped once; columns are returned as slices of the
+ * mapping, one per segment, so nothing is parsed or copied. A log that is
+ * still being written can be opened too: only rows published before the
+ * constructor ran are visible.
+ */
+class PerfLogReader {
+ public:
+  explicit PerfLogReader(const std::string& path);
+
+  const std::vector<PerfColumn>& columns() const { return columns_; }
+  size_t num_rows() const { return num_rows_; }
+  size_t num_segments() const { return segments_.size(); }
+
+  size_t segment_rows(size_t segment) const {
+    return segments_.at(segment).rows;
+  }
+
+  /* untyped 8-byte cells of a column in one segment */
+  const uint64_t* raw_cells(size_t column, size_t segment) const {
+    const auto& seg = segments_.at(segment);
+    return seg.cells + column * seg.capacity;
+  }
+
+  /* throws if there is no column of that name */
+  size_t column_index(const std::string& name) const;
+
+  /* T must match the column type: uint64_t, int64_t or double */
+  template <typename T>
+  std::vector<PerfSlice<T>> slices(size_t column) const;
+
+  /* the whole column concatenated into one vector */
+  template <typename T>
+  std::vector<T> read(const std::string& name) const;
+
+ private:
+  struct Segment {
+    const uint64_t* cells;
+    uint64_t capacity;
+    uint64_t rows;
+  };
+
+  template <typename T>
+  static constexpr PerfType type_of();
+
+  FileDescriptor fd_;
+  MMapRegion map_{};
+  std::vector<PerfColumn> columns_{};
+  std::vector<Segment> segments_{};
+  size_t num_rows_;
+};
+
+template <typename T>
+constexpr PerfType PerfLogReader::type_of() {
+  static_assert(std::is_same<T, uint64_t>::value or
+                    std::is_same<T, int64_t>::value or
+                    std::is_same<T, double>::value,
+                "perf log cells are uint64_t, int64_t or double");
+  return std::is_same<T, double>::value
+             ? PerfType::F64
+             : (std::is_same<T, int64_t>::value ? PerfType::I64
+                                                : PerfType::U64);
+}
+
+template <typename T>
+std::vector<PerfSlice<T>> PerfLogReader::slices(size_t column) const {
+  if (column >= columns_.size()) {
+    throw std::out_of_range("PerfLogReader: no such column");
+  }
+  if (columns_[column].type != type_of<T>()) {
+    throw std::runtime_error("PerfLogReader: type mismatch for column " +
+                             columns_[column].name);
+  }
+  std::vector<PerfSlice<T>> out;
+  out.reserve(segments_.size());
+  for (const auto& segment : segments_) {
+    out.push_back({reinterpret_cast<const T*>(segment.cells +
+                                              column * segment.capacity),
+                   segment.rows});
+  }
+  return out;
+}
+
+template <typename T>
+std::vector<T> PerfLogReader::read(const std::string& name) const {
+  std::vector<T> out;
+  out.reserve(num_rows_);
+  for (const auto& slice : slices<T>(column_index(name))) {
+    out.insert(out.end(), slice.data, slice.data + slice.size);
+  }
+  return out;
+}
+
+#endif  // PERF_LOG_READER_HH
@@ -1,5 +1,7 @@
 #include "serialization.hh"
 
+#include <cstring>
+
 using namespace std;
 
 string put_field( const uint16_t n){
@@ -7,7 +9,40 @@ string put_field( const uint16_t n){
   return string(reinterpret_cast<const char*>(&network_order), sizeof(network_order));
 }
 
+void put_field(const uint16_t n, char* out) {
+  const uint16_t network_order = htobe16(n);
+  memcpy(out, &network_order, sizeof(network_order));
+}
+
 uint16_t get_uint16(const char * data)
 {
   return be16toh(*reinterpret_cast<const uint16_t *>(data));
 }
+
+uint32_t get_uint32(const char* data) {
+  uint32_t network_order;
+  memcpy(&network_order, data, sizeof(network_order));
+  return be32toh(network_order);
+}
+
+void put_mux_header(const uint16_t length, const uint32_t tag, char* out) {
+  put_field(length, out);
+  const uint32_t network_order = htobe32(tag);
+  memcpy(out + 2, &network_order, sizeof(network_order));
+}
+
+void write_message(FileDescriptor& fd, const string& message) {
+  char header[2];
+  put_field(message.length(), header);
+  iovec iov[2] = {{header, 2},
+                  {const_cast<char*>(message.data()), message.length()}};
+  fd.writev(iov, 2);
+}
+
+string_view read_message(FileDescriptor& fd, char* buffer) {
+  char header[2];
+  fd.read_exactly_into(header, 2);
+  const uint16_t length = get_uint16(header);
+  fd.read_exactly_into(buffer, length);
+  return string_view(buffer, length);
+}
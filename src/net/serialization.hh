@@ -2,9 +2,31 @@
 #define SERIALIZATION_HH
 
 #include <string>
+#include <string_view>
 #include <cstdint>
 
+#include "file_descriptor.hh"
+
+/* messages are framed by a 16-bit length */
+constexpr size_t MAX_MESSAGE_SIZE = UINT16_MAX;
+
 std::string put_field(const uint16_t n);
+/* the 2-byte field into `out`, without allocating */
+void put_field(const uint16_t n, char* out);
 uint16_t get_uint16(const char * data);
+uint32_t get_uint32(const char* data);
+
+/**
+ * Multiplexed framing (after a MUX message on a stream): the 16-bit length
+ * of the message, a 32-bit tag naming the flow, then the message. Replies
+ * carry the tag of their request.
+ */
+constexpr size_t MUX_HEADER_SIZE = 6;
+void put_mux_header(const uint16_t length, const uint32_t tag, char* out);
+
+/* frame `message` and write it with one writev, without copying it */
+void write_message(FileDescriptor& fd, const std::string& message);
+/* read one framed message into `buffer` of MAX_MESSAGE_SIZE bytes */
+std::string_view read_message(FileDescriptor& fd, char* buffer);
 
 #endif /* SERIALIZATION_HH */
\ No newline at end of file
@@ -77,29 +77,107 @@ void Socket::connect(const Address& address) {
 
 /* send datagram to specified address */
 void UDPSocket::sendto(const Address& destination, const string& payload) {
+  sendto_from(destination, payload.data(), payload.size());
+}
+
+/* send datagram to connected address */
+void UDPSocket::send(const string& payload) {
+  send_from(payload.data(), payload.size());
+}
+
+void UDPSocket::sendto_from(const Address& destination, const char* data,
+                            const size_t length) {
   const ssize_t bytes_sent = SystemCall(
-      "sendto", ::sendto(fd_num(), payload.data(), payload.size(), 0,
+      "sendto", ::sendto(fd_num(), data, length, 0,
                          &destination.to_sockaddr(), destination.size()));
 
   register_write();
 
-  if (size_t(bytes_sent) != payload.size()) {
+  if (size_t(bytes_sent) != length) {
     throw runtime_error("datagram payload too big for sendto()");
   }
 }
 
-/* send datagram to connected address */
-void UDPSocket::send(const string& payload) {
+void UDPSocket::send_from(const char* data, const size_t length) {
   const ssize_t bytes_sent =
-      SystemCall("send", ::send(fd_num(), payload.data(), payload.size(), 0));
+      SystemCall("send", ::send(fd_num(), data, length, 0));
 
   register_write();
 
-  if (size_t(bytes_sent) != payload.size()) {
+  if (size_t(bytes_sent) != length) {
     throw runtime_error("datagram payload too big for send()");
   }
 }
 
+size_t UDPSocket::recv_into(char* buffer, const size_t length,
+                            Address* source) {
+  iovec iov = {buffer, length};
+  return recvv(&iov, 1, source);
+}
+
+static size_t iovec_size(const iovec* iov, const int iovcnt) {
+  size_t size = 0;
+  for (int i = 0; i < iovcnt; i++) {
+    size += iov[i].iov_len;
+  }
+  return size;
+}
+
+size_t UDPSocket::recvv(const iovec* iov, const int iovcnt, Address* source) {
+  Address::raw datagram_source_address;
+  msghdr header = {};
+  header.msg_name = &datagram_source_address;
+  header.msg_namelen = sizeof(datagram_source_address);
+  header.msg_iov = const_cast<iovec*>(iov);
+  header.msg_iovlen = iovcnt;
+
+  const ssize_t recv_len =
+      SystemCall("recvmsg", ::recvmsg(fd_num(), &header, 0));
+  if (header.msg_flags & MSG_TRUNC) {
+    throw runtime_error("recvmsg (oversized datagram)");
+  }
+
+  register_read();
+
+  if (source) {
+    *source = Address(datagram_source_address, header.msg_namelen);
+  }
+  return recv_len;
+}
+
+void UDPSocket::sendtov(const Address& destination, const iovec* iov,
+                        const int iovcnt) {
+  msghdr header = {};
+  header.msg_name = const_cast<sockaddr*>(&destination.to_sockaddr());
+  header.msg_namelen = destination.size();
+  header.msg_iov = const_cast<iovec*>(iov);
+  header.msg_iovlen = iovcnt;
+
+  const ssize_t bytes_sent =
+      SystemCall("sendmsg", ::sendmsg(fd_num(), &header, 0));
+
+  register_write();
+
+  if (size_t(bytes_sent) != iovec_size(iov, iovcnt)) {
+    throw runtime_error("datagram payload too big for sendmsg()");
+  }
+}
+
+void UDPSocket::sendv(const iovec* iov, const int iovcnt) {
+  msghdr header = {};
+  header.msg_iov = const_cast<iovec*>(iov);
+  header.msg_iovlen = iovcnt;
+
+  const ssize_t bytes_sent =
+      SystemCall("sendmsg", ::sendmsg(fd_num(), &header, 0));
+
+  register_write();
+
+  if (size_t(bytes_sent) != iovec_size(iov, iovcnt)) {
+    throw runtime_error("datagram payload too big for sendmsg()");
+  }
+}
+
 /* mark the socket as listening for incoming connections */
 void TCPSocket::listen(const int backlog) {
   SystemCall("listen", ::listen(fd_num(), backlog));
@@ -135,6 +213,10 @@ void Socket::set_reuseaddr(void) {
   setsockopt(SOL_SOCKET, SO_REUSEADDR, int(true));
 }
 
+void Socket::set_reuseport(void) {
+  setsockopt(SOL_SOCKET, SO_REUSEPORT, int(true));
+}
+
 /* turn on timestamps on receipt */
 void UDPSocket::set_timestamps(void) {
   setsockopt(SOL_SOCKET, SO_TIMESTAMPNS, int(true));
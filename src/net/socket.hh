@@ -49,6 +49,10 @@ class Socket : public FileDescriptor {
 
   /* allow local address to be reused sooner, at the cost of some robustness */
   void set_reuseaddr(void);
+
+  /* let several sockets bind the same address; the kernel spreads incoming
+   * connections over them */
+  void set_reuseport(void);
 };
 
 /* UDP socket */
@@ -65,6 +69,19 @@ class UDPSocket : public Socket {
   /* send datagram to connected address */
   void send(const std::string& payload);
 
+  /* the same without allocating: the caller owns the memory */
+  /* receive one datagram into `buffer`; throws if it does not fit */
+  size_t recv_into(char* buffer, const size_t length,
+                   Address* source = nullptr);
+  void sendto_from(const Address& peer, const char* data,
+                   const size_t length);
+  void send_from(const char* data, const size_t length);
+
+  /* one datagram scattered over or gathered from `iov` */
+  size_t recvv(const iovec* iov, const int iovcnt, Address* source = nullptr);
+  void sendtov(const Address& peer, const iovec* iov, const int iovcnt);
+  void sendv(const iovec* iov, const int iovcnt);
+
   /* turn on timestamps on receipt */
   void set_timestamps(void);
 };
@@ -0,0 +1,38 @@
+#include "step_trace.hh"
+
+#include <string>
+
+using namespace std;
+
+void trace_control_step(ChromeTrace& trace, int pid, int tid,
+                        const ControlStep& step, const json& hops) {
+  const string args = "{\"step\":" + to_string(step.step) +
+                      ",\"cwnd\":" + to_string(step.cwnd) + "}";
+  auto slice = [&](const char* name, const char* category, uint64_t begin,
+                   uint64_t end) {
+    if (begin != 0 and end >= begin) {
+      trace.complete(name, category, pid, tid, begin, end - begin, args);
+    }
+  };
+
+  slice("step", "control", step.state_us, step.done_us);
+  slice("get_state", "client", step.state_us, step.send_us);
+  if (hops.is_array() and hops.size() == 5) {
+    const uint64_t received = hops[0], enqueued = hops[1],
+                   infer_start = hops[2], infer_end = hops[3],
+                   reply = hops[4];
+    slice("to_server", "network", step.send_us, received);
+    if (enqueued != 0) {
+      slice("parse", "server", received, enqueued);
+      slice("batch_queue", "server", enqueued, infer_start);
+    } else {
+      slice("parse", "server", received, infer_start);
+    }
+    slice("inference", "server", infer_start, infer_end);
+    slice("reply", "server", infer_end, reply);
+    slice("to_client", "network", reply, step.recv_us);
+  } else {
+    slice("wait_reply", "client", step.send_us, step.recv_us);
+  }
+  slice("set_cwnd", "client", step.recv_us, step.done_us);
+}
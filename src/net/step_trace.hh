@@ -0,0 +1,36 @@
+#ifndef STEP_TRACE_HH
+#define STEP_TRACE_HH
+
+#include <cstdint>
+
+#include "chrome_trace.hh"
+#include "json.hpp"
+
+using json = nlohmann::json;
+
+/* client-side timestamps of one control step (steadyTime_microseconds) */
+struct ControlStep {
+  int step;
+  int cwnd;
+  // started reading the TCP state
+  uint64_t state_us;
+  // request written to the inference socket
+  uint64_t send_us;
+  // reply read back
+  uint64_t recv_us;
+  // cwnd applied to the socket
+  uint64_t done_us;
+};
+
+/**
+ * @brief Write one control step as nested slices on the (pid, tid) track.
+ *
+ * `hops` is the "trace" array of the inference reply: [received, enqueued,
+ * inference start, inference end, reply], where enqueued is 0 without a
+ * batch queue. Both sides use the monotonic clock, so the hops line up
+ * only when client and inference service run on the same host.
+ */
+void trace_control_step(ChromeTrace& trace, int pid, int tid,
+                        const ControlStep& step, const json& hops);
+
+#endif  // STEP_TRACE_HH
@@ -60,25 +60,11 @@ struct TCPDeepCCInfo {
     max_packets_out = 0;
     mss = 0;
   }
-  TCPDeepCCInfo& operator=(const TCPDeepCCInfo& a) {
-    this->min_rtt = a.min_rtt;
-    this->avg_urtt = a.avg_urtt;
-    this->cnt = a.cnt;
-    this->avg_thr = a.avg_thr;
-    this->thr_cnt = a.thr_cnt;
-    this->cwnd = a.cwnd;
-    this->pacing_rate = a.pacing_rate;
-    this->lost_bytes = a.lost_bytes;
-    this->srtt_us = a.srtt_us;
-    this->snd_ssthresh = a.snd_ssthresh;
-    this->packets_out = a.packets_out;
-    this->retrans_out = a.retrans_out;
-    this->max_packets_out = a.max_packets_out;
-    this->mss = a.mss;
-    return *this;
-  }
+  TCPDeepCCInfo() = default;
+  TCPDeepCCInfo(const TCPDeepCCInfo&) = default;
+  TCPDeepCCInfo& operator=(const TCPDeepCCInfo&) = default;
 
-  json to_json() {
+  json to_json() const {
     json out;
     out["min_rtt"] = min_rtt;
     out["avg_urtt"] = avg_urtt;
@@ -97,7 +83,7 @@ struct TCPDeepCCInfo {
     return out;
   }
 
-  std::string to_string() {
+  std::string to_string() const {
     json out = this->to_json();
     return out.dump();
   }
@@ -130,4 +116,18 @@ struct TCPDeepCCInfo {
   }
 };
 
+/**
+ * @brief The state of one control step as sent to the inference service:
+ * the info plus the maximal observed throughput, the loss rate in bytes per
+ * second and the time since the previous step in us.
+ */
+inline json deepcc_state_json(const TCPDeepCCInfo& info, uint64_t max_tput,
+                              uint64_t time_delta) {
+  json data = info.to_json();
+  data["max_tput"] = max_tput;
+  data["loss_ratio"] = double(info.lost_bytes * u64(1000000)) / time_delta;
+  data["time_delta"] = time_delta;
+  return data;
+}
+
 #endif  // TCP_INFO_HH
\ No newline at end of file
@@ -0,0 +1,220 @@
+#include "tcp_receiver.hh"
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#include <unordered_map>
+
+#include "current_time.hh"
+#include "exception.hh"
+#include "logging.hh"
+
+using namespace std;
+
+/* epoll token of the listening socket */
+static const uint64_t kListener = UINT64_MAX;
+
+TCPReceiver::TCPReceiver(const ReceiverConfig& config)
+    : config_(config),
+      listeners_(),
+      counters_(new FlowCounter[config.max_flows]),
+      slots_mutex_(),
+      free_slots_(),
+      totals_(new WorkerTotal[config.workers]),
+      next_flow_(0),
+      flows_refused_(0),
+      running_(true) {
+  if (config_.workers == 0 or config_.max_flows == 0 or
+      config_.buffer_size == 0) {
+    throw runtime_error("TCPReceiver: invalid configuration");
+  }
+  for (size_t slot = 0; slot < config_.max_flows; slot++) {
+    free_slots_.push_back(slot);
+  }
+  for (size_t i = 0; i < config_.workers; i++) {
+    listeners_.emplace_back();
+    TCPSocket& listener = listeners_.back();
+    listener.set_reuseaddr();
+    if (config_.workers > 1) {
+      listener.set_reuseport();
+    }
+    // accepted connections inherit it
+    listener.set_congestion_control(config_.congestion_control);
+    listener.bind(Address("0.0.0.0", config_.port));
+    listener.listen(1024);
+  }
+}
+
+TCPReceiver::~TCPReceiver() {}
+
+void TCPReceiver::run() {
+  vector<thread> workers;
+  for (size_t i = 1; i < config_.workers; i++) {
+    workers.emplace_back(&TCPReceiver::serve, this, i);
+  }
+  serve(0);
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
+
+uint64_t TCPReceiver::total_bytes() const {
+  uint64_t total = 0;
+  for (size_t i = 0; i < config_.workers; i++) {
+    total += totals_[i].bytes.load(memory_order_relaxed);
+  }
+  return total;
+}
+
+size_t TCPReceiver::take_slot() {
+  lock_guard<mutex> lock(slots_mutex_);
+  if (free_slots_.empty()) {
+    return config_.max_flows;
+  }
+  const size_t slot = free_slots_.front();
+  free_slots_.pop_front();
+  return slot;
+}
+
+void TCPReceiver::release_slot(size_t slot) {
+  lock_guard<mutex> lock(slots_mutex_);
+  free_slots_.push_back(slot);
+}
+
+/* counters have one writer, so plain load + store is enough */
+static inline void add_relaxed(atomic<uint64_t>& counter, uint64_t n) {
+  counter.store(counter.load(memory_order_relaxed) + n,
+                memory_order_relaxed);
+}
+
+void TCPReceiver::serve(size_t worker) {
+  struct Connection {
+    TCPSocket socket;
+    uint64_t flow;
+    size_t slot;
+    FlowCounter& counter;
+  };
+
+  TCPSocket& listener = listeners_[worker];
+  FileDescriptor epoll_fd(SystemCall("epoll_create1", epoll_create1(0)));
+  auto watch = [&epoll_fd](int fd, uint64_t token) {
+    epoll_event ev = {};
+    ev.events = EPOLLIN;
+    ev.data.u64 = token;
+    SystemCall("epoll_ctl",
+               epoll_ctl(epoll_fd.fd_num(), EPOLL_CTL_ADD, fd, &ev));
+  };
+  watch(listener.fd_num(), kListener);
+
+  // reads land in one buffer, or go through a pipe to /dev/null
+  vector<char> buffer(config_.splice ? 0 : config_.buffer_size);
+  unique_ptr<FileDescriptor> pipe_read, pipe_write, dev_null;
+  if (config_.splice) {
+    int pipe_fds[2];
+    SystemCall("pipe2", pipe2(pipe_fds, O_NONBLOCK));
+    pipe_read.reset(new FileDescriptor(pipe_fds[0]));
+    pipe_write.reset(new FileDescriptor(pipe_fds[1]));
+    // best effort: a bigger pipe moves more per splice
+    fcntl(pipe_fds[1], F_SETPIPE_SZ, int(config_.buffer_size));
+    dev_null.reset(new FileDescriptor(
+        SystemCall("open /dev/null", open("/dev/null", O_WRONLY))));
+  }
+
+  WorkerTotal& total = totals_[worker];
+  unordered_map<int, Connection> connections;
+
+  /* bytes moved, 0 at the end of the stream, -1 if nothing is ready */
+  auto receive = [&](int fd) -> ssize_t {
+    if (not config_.splice) {
+      const ssize_t n = ::read(fd, buffer.data(), buffer.size());
+      if (n < 0 and (errno == EAGAIN or errno == EINTR)) {
+        return -1;
+      }
+      return SystemCall("read", n);
+    }
+    const ssize_t n = splice(fd, nullptr, pipe_write->fd_num(), nullptr,
+                             config_.buffer_size,
+                             SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+    if (n < 0 and (errno == EAGAIN or errno == EINTR)) {
+      return -1;
+    }
+    SystemCall("splice", n);
+    for (ssize_t left = n; left > 0;) {
+      left -= SystemCall("splice", splice(pipe_read->fd_num(), nullptr,
+                                          dev_null->fd_num(), nullptr, left,
+                                          SPLICE_F_MOVE));
+    }
+    return n;
+  };
+
+  auto close_connection = [&](int fd) {
+    Connection& connection = connections.at(fd);
+    const uint64_t now = steadyTime_microseconds();
+    connection.counter.closed_us.store(now, memory_order_relaxed);
+    const uint64_t bytes = connection.counter.bytes.load();
+    const double seconds =
+        (now - connection.counter.opened_us.load()) / 1e6;
+    LOG(INFO) << "Flow " << connection.flow << " closed: " << bytes
+              << " bytes in " << seconds << " s ("
+              << (seconds > 0 ? bytes * 8 / seconds / 1e6 : 0) << " Mbps)";
+    release_slot(connection.slot);
+    connections.erase(fd);
+    if (config_.one_off) {
+      stop();
+    }
+  };
+
+  epoll_event events[64];
+  while (running_) {
+    const int ready = epoll_wait(epoll_fd.fd_num(), events, 64, 100);
+    if (ready < 0 and errno == EINTR) {
+      continue;
+    }
+    SystemCall("epoll_wait", ready);
+
+    for (int i = 0; i < ready; i++) {
+      if (events[i].data.u64 == kListener) {
+        TCPSocket socket = listener.accept();
+        const size_t slot = take_slot();
+        if (slot == config_.max_flows) {
+          // its bytes could not be counted; the socket closes here
+          LOG(WARNING) << "Refused a connection from "
+                       << socket.peer_address().str() << ": "
+                       << config_.max_flows << " flows open ("
+                       << ++flows_refused_ << " refused)";
+          continue;
+        }
+        socket.set_blocking(false);
+        const uint64_t flow = next_flow_++;
+        FlowCounter& counter = counters_[slot];
+        counter.bytes = 0;
+        counter.opened_us = steadyTime_microseconds();
+        counter.closed_us = 0;
+        counter.flow = flow + 1;
+        LOG(INFO) << "Flow " << flow << " from "
+                  << socket.peer_address().str() << " on worker " << worker;
+        const int fd = socket.fd_num();
+        watch(fd, fd);
+        connections.emplace(fd, Connection{move(socket), flow, slot, counter});
+        continue;
+      }
+
+      const int fd = events[i].data.u64;
+      ssize_t n;
+      try {
+        n = receive(fd);
+      } catch (const unix_error& e) {
+        LOG(WARNING) << "Flow " << connections.at(fd).flow << ": "
+                     << e.what();
+        n = 0;
+      }
+      if (n > 0) {
+        add_relaxed(connections.at(fd).counter.bytes, n);
+        add_relaxed(total.bytes, n);
+      } else if (n == 0) {
+        close_connection(fd);
+      }
+    }
+  }
+}
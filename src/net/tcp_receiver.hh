@@ -0,0 +1,92 @@
+#ifndef TCP_RECEIVER_HH
+#define TCP_RECEIVER_HH
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "socket.hh"
+
+/* bytes received by one connection; one cache line, written by one worker */
+struct alignas(64) FlowCounter {
+  // connection number + 1, 0 while the slot has never been used
+  std::atomic<uint64_t> flow{0};
+  std::atomic<uint64_t> bytes{0};
+  // steady clock, 0 while open
+  std::atomic<uint64_t> opened_us{0};
+  std::atomic<uint64_t> closed_us{0};
+};
+
+struct ReceiverConfig {
+  uint16_t port = 0;
+  // more than one: one listening socket each, bound with SO_REUSEPORT
+  size_t workers = 1;
+  // move the data to /dev/null in the kernel instead of reading it
+  bool splice = false;
+  size_t buffer_size = 256 * 1024;
+  std::string congestion_control = "cubic";
+  // counter slots, so the connections open at once; more are refused
+  size_t max_flows = 1024;
+  // stop once the first connection closes
+  bool one_off = false;
+};
+
+/**
+ * @brief Sink for the traffic of many concurrent TCP senders.
+ *
+ * Every worker thread serves its connections from one epoll set and reads
+ * into one reusable buffer (or splices to /dev/null), so nothing is
+ * allocated per read. Each connection counts its bytes in a FlowCounter,
+ * which other threads may sample at any time.
+ */
+class TCPReceiver {
+ public:
+  explicit TCPReceiver(const ReceiverConfig& config);
+  ~TCPReceiver();
+
+  TCPReceiver(const TCPReceiver&) = delete;
+  TCPReceiver& operator=(const TCPReceiver&) = delete;
+
+  /* serve until stop(), or the end of the first connection if one_off */
+  void run();
+  void stop() { running_ = false; }
+
+  /* bytes received over all connections */
+  uint64_t total_bytes() const;
+  /* connections accepted so far */
+  uint64_t flows_accepted() const { return next_flow_.load(); }
+  /* connections closed at once because every counter slot was taken */
+  uint64_t flows_refused() const { return flows_refused_.load(); }
+
+  const FlowCounter& counter(size_t slot) const { return counters_[slot]; }
+  size_t max_flows() const { return config_.max_flows; }
+
+ private:
+  struct alignas(64) WorkerTotal {
+    std::atomic<uint64_t> bytes{0};
+  };
+
+  void serve(size_t worker);
+  /* a free counter slot, or max_flows if none is */
+  size_t take_slot();
+  void release_slot(size_t slot);
+
+  ReceiverConfig config_;
+  std::vector<TCPSocket> listeners_;
+  std::unique_ptr<FlowCounter[]> counters_;
+  // slots of closed connections are reused last, so that samplers see them
+  // closed; the first ones are handed out in order
+  std::mutex slots_mutex_;
+  std::deque<size_t> free_slots_;
+  std::unique_ptr<WorkerTotal[]> totals_;
+  std::atomic<uint64_t> next_flow_;
+  std::atomic<uint64_t> flows_refused_;
+  std::atomic<bool> running_;
+};
+
+#endif  // TCP_RECEIVER_HH
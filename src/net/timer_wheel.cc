@@ -0,0 +1,75 @@
+#include "timer_wheel.hh"
+
+#include <algorithm>
+
+using namespace std;
+
+TimerWheel::TimerWheel(uint64_t tick_us)
+    : tick_us_(max<uint64_t>(tick_us, 1)), now_(0), size_(0), buckets_() {}
+
+vector<TimerWheel::Timer>& TimerWheel::bucket(int level, uint64_t tick) {
+  return buckets_[level * kSlots +
+                  ((tick >> (level * kLevelBits)) & (kSlots - 1))];
+}
+
+void TimerWheel::schedule(uint64_t id, uint64_t deadline_us) {
+  if (buckets_.empty()) {
+    buckets_.resize(kLevels * kSlots);
+  }
+  // a timer already due goes off at the next tick
+  insert({id, max((deadline_us + tick_us_ - 1) / tick_us_, now_ + 1)});
+  size_++;
+}
+
+void TimerWheel::insert(const Timer& timer) {
+  // at or after now_; a cascaded timer may be due at now_
+  uint64_t tick = timer.deadline;
+  int level = 0;
+  while (level < kLevels - 1 and
+         tick - now_ >= (kSlots << (level * kLevelBits))) {
+    level++;
+  }
+  // beyond the top level: park it in its last slot, advance() reschedules
+  const uint64_t span = kSlots << (level * kLevelBits);
+  if (tick - now_ >= span) {
+    tick = now_ + span - 1;
+  }
+  bucket(level, tick).push_back(timer);
+}
+
+void TimerWheel::advance(uint64_t now_us, vector<uint64_t>& expired) {
+  const uint64_t target = now_us / tick_us_;
+  if (size_ == 0) {
+    now_ = max(now_, target);
+    return;
+  }
+  while (now_ < target and size_ > 0) {
+    now_++;
+    // the highest level first: its timers may land in a lower slot that
+    // is also reached at this tick
+    int top = 0;
+    while (top < kLevels - 1 and
+           (now_ & ((uint64_t(1) << ((top + 1) * kLevelBits)) - 1)) == 0) {
+      top++;
+    }
+    for (int level = top; level > 0; level--) {
+      vector<Timer> cascaded;
+      cascaded.swap(bucket(level, now_));
+      for (const Timer& timer : cascaded) {
+        insert(timer);
+      }
+    }
+    vector<Timer> due;
+    due.swap(bucket(0, now_));
+    for (const Timer& timer : due) {
+      if (timer.deadline > now_) {
+        // parked beyond the top level
+        insert(timer);
+      } else {
+        expired.push_back(timer.id);
+        size_--;
+      }
+    }
+  }
+  now_ = max(now_, target);
+}
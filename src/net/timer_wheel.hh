@@ -0,0 +1,53 @@
+#ifndef TIMER_WHEEL_HH
+#define TIMER_WHEEL_HH
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Hierarchical timing wheel: many timers, O(1) to schedule.
+ *
+ * Time is cut into ticks of `tick_us`. Level 0 holds the timers due in the
+ * next kSlots ticks, one slot per tick; each level above covers kSlots
+ * times the span of the one below, and its slots are moved (cascaded) one
+ * level down when the wheel reaches them. Timers cannot be cancelled: the
+ * owner checks at expiry whether the timer still matters, and reschedules
+ * it if it was pushed back meanwhile.
+ */
+class TimerWheel {
+ public:
+  explicit TimerWheel(uint64_t tick_us);
+
+  /* `id` is returned by advance() at the first tick at or after
+   * `deadline_us` (on the steady clock of advance()), or at the next tick
+   * if that has passed */
+  void schedule(uint64_t id, uint64_t deadline_us);
+
+  /* moves the wheel to `now_us` and appends the ids that are due */
+  void advance(uint64_t now_us, std::vector<uint64_t>& expired);
+
+  size_t size() const { return size_; }
+
+ private:
+  static constexpr int kLevelBits = 6;
+  static constexpr uint64_t kSlots = 1 << kLevelBits;
+  static constexpr int kLevels = 4;
+
+  struct Timer {
+    uint64_t id;
+    // in ticks
+    uint64_t deadline;
+  };
+
+  void insert(const Timer& timer);
+  std::vector<Timer>& bucket(int level, uint64_t tick);
+
+  uint64_t tick_us_;
+  uint64_t now_;
+  size_t size_;
+  // kLevels * kSlots, allocated with the first timer
+  std::vector<std::vector<Timer>> buckets_;
+};
+
+#endif  // TIMER_WHEEL_HH
@@ -0,0 +1,63 @@
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+
+#include "exception.hh"
+#include "perf_log_reader.hh"
+
+using namespace std;
+
+static void print_cell(const PerfType type, const uint64_t cell) {
+  switch (type) {
+  case PerfType::U64:
+    cout << cell;
+    break;
+  case PerfType::I64: {
+    int64_t v;
+    memcpy(&v, &cell, sizeof(v));
+    cout << v;
+    break;
+  }
+  case PerfType::F64: {
+    double v;
+    memcpy(&v, &cell, sizeof(v));
+    cout << v;
+    break;
+  }
+  }
+}
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    cerr << "Usage: " << argv[0] << " PERF_LOG" << endl;
+    cerr << "Print a binary perf log (--perf-log) as CSV." << endl;
+    return EXIT_FAILURE;
+  }
+
+  try {
+    PerfLogReader reader(argv[1]);
+    const auto& columns = reader.columns();
+    cout << setprecision(numeric_limits<double>::max_digits10);
+
+    for (size_t c = 0; c < columns.size(); c++) {
+      cout << (c ? "," : "") << columns[c].name;
+    }
+    cout << "\n";
+
+    for (size_t s = 0; s < reader.num_segments(); s++) {
+      for (size_t r = 0; r < reader.segment_rows(s); r++) {
+        for (size_t c = 0; c < columns.size(); c++) {
+          if (c) cout << ",";
+          print_cell(columns[c].type, reader.raw_cells(c, s)[r]);
+        }
+        cout << "\n";
+      }
+    }
+  } catch (const exception& e) {
+    print_exception(argv[0], e);
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,180 @@
+/**
+ * Python bindings of the native replay buffers, used by
+ * python/helpers/buffer.py when built.
+ *
+ *   buffer = astraea_replay.PrioritizedReplayBuffer(400000, s_dim, a_dim,
+ *                                                   g_dim)
+ *   buffer.store_many(s0, g0, a, r, s1, g1, terminal)
+ *   indices, [s0, g0, a, r, s1, g1, terminal], weights = buffer.sample(192)
+ *   buffer.update_priorities(indices, abs_td_errors)
+ *
+ * Inputs may have any float dtype; every row of every field is one
+ * transition. The GIL is released while storing and sampling, so several
+ * actor threads can store at once.
+ */
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <string>
+
+#include "replay_buffer.hh"
+
+namespace py = pybind11;
+
+using FloatArray =
+    py::array_t<float, py::array::c_style | py::array::forcecast>;
+using IndexArray =
+    py::array_t<int64_t, py::array::c_style | py::array::forcecast>;
+
+/* the inputs of store_many(), kept alive while the GIL is released */
+struct StoreArgs {
+  FloatArray s0, g0, a, r, s1, g1, terminal;
+  size_t n;
+
+  StoreArgs(const TransitionStore& store, FloatArray s0_, FloatArray g0_,
+            FloatArray a_, FloatArray r_, FloatArray s1_, FloatArray g1_,
+            FloatArray terminal_)
+      : s0(s0_), g0(g0_), a(a_), r(r_), s1(s1_), g1(g1_), terminal(terminal_),
+        n(r.size()) {
+    check(s0, store.s_dim(), "s0");
+    check(g0, store.g_dim(), "g0");
+    check(a, store.a_dim(), "a");
+    check(s1, store.s_dim(), "s1");
+    check(g1, store.g_dim(), "g1");
+    check(terminal, 1, "terminal");
+  }
+
+  void check(const FloatArray& array, size_t width, const char* name) const {
+    if (size_t(array.size()) != n * width) {
+      throw py::value_error(std::string("store_many: ") + name + " has " +
+                            std::to_string(array.size()) + " values, not " +
+                            std::to_string(n) + " rows of " +
+                            std::to_string(width));
+    }
+  }
+
+  TransitionRows rows() const {
+    return {s0.data(), g0.data(), a.data(),       r.data(),
+            s1.data(), g1.data(), terminal.data()};
+  }
+};
+
+/* freshly allocated output arrays of a sample */
+struct SampleArrays {
+  FloatArray s0, g0, a, r, s1, g1, terminal;
+
+  SampleArrays(const TransitionStore& store, size_t n)
+      : s0({n, store.s_dim()}), g0({n, store.g_dim()}),
+        a({n, store.a_dim()}), r({n, size_t(1)}), s1({n, store.s_dim()}),
+        g1({n, store.g_dim()}), terminal({n, size_t(1)}) {}
+
+  TransitionBatch batch() {
+    return {s0.mutable_data(), g0.mutable_data(), a.mutable_data(),
+            r.mutable_data(),  s1.mutable_data(), g1.mutable_data(),
+            terminal.mutable_data()};
+  }
+
+  /* in the order of ReplayBuffer.sample() in buffer.py */
+  py::list columns() const {
+    py::list out;
+    for (const auto& column : {s0, g0, a, r, s1, g1, terminal}) {
+      out.append(column);
+    }
+    return out;
+  }
+};
+
+PYBIND11_MODULE(astraea_replay, m) {
+  m.doc() = "Native replay buffers of the Astraea agent";
+
+  py::class_<ReplayBuffer>(m, "ReplayBuffer")
+      .def(py::init<size_t, size_t, size_t, size_t, uint64_t>(),
+           py::arg("size"), py::arg("s_dim"), py::arg("a_dim"),
+           py::arg("g_dim"), py::arg("seed") = 1)
+      .def("__len__", &ReplayBuffer::size)
+      .def(
+          "store_many",
+          [](ReplayBuffer& buffer, FloatArray s0, FloatArray g0, FloatArray a,
+             FloatArray r, FloatArray s1, FloatArray g1,
+             FloatArray terminal) {
+            const StoreArgs args(buffer.transitions(), s0, g0, a, r, s1, g1,
+                                 terminal);
+            py::gil_scoped_release release;
+            buffer.store(args.rows(), args.n);
+          },
+          py::arg("s0"), py::arg("g0"), py::arg("a"), py::arg("r"),
+          py::arg("s1"), py::arg("g1"), py::arg("terminal"))
+      .def(
+          "sample",
+          [](ReplayBuffer& buffer, size_t n) {
+            SampleArrays out(buffer.transitions(), n);
+            const TransitionBatch batch = out.batch();
+            {
+              py::gil_scoped_release release;
+              buffer.sample(n, batch, nullptr);
+            }
+            return out.columns();
+          },
+          py::arg("n"), "[s0, g0, a, r, s1, g1, terminal] of n transitions");
+
+  py::class_<PrioritizedConfig>(m, "PrioritizedConfig")
+      .def(py::init<>())
+      .def_readwrite("epsilon", &PrioritizedConfig::epsilon)
+      .def_readwrite("alpha", &PrioritizedConfig::alpha)
+      .def_readwrite("beta", &PrioritizedConfig::beta)
+      .def_readwrite("beta_increment", &PrioritizedConfig::beta_increment)
+      .def_readwrite("abs_err_upper", &PrioritizedConfig::abs_err_upper);
+
+  py::class_<PrioritizedReplayBuffer>(m, "PrioritizedReplayBuffer")
+      .def(py::init<size_t, size_t, size_t, size_t, const PrioritizedConfig&,
+                    uint64_t>(),
+           py::arg("size"), py::arg("s_dim"), py::arg("a_dim"),
+           py::arg("g_dim"), py::arg("config") = PrioritizedConfig(),
+           py::arg("seed") = 1)
+      .def("__len__", &PrioritizedReplayBuffer::size)
+      .def_property_readonly("beta", &PrioritizedReplayBuffer::beta)
+      .def_property_readonly("total_priority",
+                             &PrioritizedReplayBuffer::total_priority)
+      .def(
+          "store_many",
+          [](PrioritizedReplayBuffer& buffer, FloatArray s0, FloatArray g0,
+             FloatArray a, FloatArray r, FloatArray s1, FloatArray g1,
+             FloatArray terminal) {
+            const StoreArgs args(buffer.transitions(), s0, g0, a, r, s1, g1,
+                                 terminal);
+            py::gil_scoped_release release;
+            buffer.store(args.rows(), args.n);
+          },
+          py::arg("s0"), py::arg("g0"), py::arg("a"), py::arg("r"),
+          py::arg("s1"), py::arg("g1"), py::arg("terminal"))
+      .def(
+          "sample",
+          [](PrioritizedReplayBuffer& buffer, size_t n) {
+            SampleArrays out(buffer.transitions(), n);
+            const TransitionBatch batch = out.batch();
+            IndexArray indices(n);
+            FloatArray weights({n, size_t(1)});
+            int64_t* index_data = indices.mutable_data();
+            float* weight_data = weights.mutable_data();
+            {
+              py::gil_scoped_release release;
+              buffer.sample(n, batch, index_data, weight_data);
+            }
+            return py::make_tuple(indices, out.columns(), weights);
+          },
+          py::arg("n"),
+          "(indices, [s0, g0, a, r, s1, g1, terminal], weights) of n "
+          "transitions")
+      .def(
+          "update_priorities",
+          [](PrioritizedReplayBuffer& buffer, IndexArray indices,
+             FloatArray errors) {
+            if (indices.size() != errors.size()) {
+              throw py::value_error(
+                  "update_priorities: one error per index expected");
+            }
+            buffer.update_priorities(indices.data(), errors.data(),
+                                     indices.size());
+          },
+          py::arg("indices"), py::arg("abs_errors"));
+}
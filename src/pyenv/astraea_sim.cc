@@ -0,0 +1,110 @@
+/**
+ * Python bindings of the simulated training environments (VecEnv).
+ *
+ *   import astraea_sim
+ *   config = astraea_sim.VecEnvConfig()
+ *   config.num_envs = 256
+ *   env = astraea_sim.VecEnv(config)
+ *   states, global_states = env.reset()
+ *   states, global_states, rewards, dones, metrics = env.step(actions)
+ *
+ * The returned arrays are read-only views of the environment's buffers, not
+ * copies: they change with the next step, so copy what must be kept.
+ */
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <vector>
+
+#include "vec_env.hh"
+
+namespace py = pybind11;
+
+/* a read-only row-major view of `data`; `owner` is kept alive with it */
+template <typename T>
+static py::array view(py::handle owner, const T* data,
+                      const std::vector<py::ssize_t>& shape,
+                      const py::dtype& dtype = py::dtype::of<T>()) {
+  std::vector<py::ssize_t> strides(shape.size(), sizeof(T));
+  for (size_t i = shape.size() - 1; i > 0; i--) {
+    strides[i - 1] = strides[i] * shape[i];
+  }
+  py::array array(dtype, shape, strides, data, owner);
+  array.attr("setflags")(false);
+  return array;
+}
+
+static py::tuple observations(py::handle self, const VecEnv& env) {
+  const py::ssize_t n = env.num_agents();
+  return py::make_tuple(
+      view(self, env.states(), {n, py::ssize_t(env.state_dim())}),
+      view(self, env.global_states(), {n, py::ssize_t(VecEnv::kGlobalDim)}));
+}
+
+PYBIND11_MODULE(astraea_sim, m) {
+  m.doc() = "Simulated Astraea training environments";
+
+  py::class_<VecEnvConfig>(m, "VecEnvConfig")
+      .def(py::init<>())
+      .def_readwrite("num_envs", &VecEnvConfig::num_envs)
+      .def_readwrite("flows_per_env", &VecEnvConfig::flows_per_env)
+      .def_readwrite("min_bandwidth_mbps", &VecEnvConfig::min_bandwidth_mbps)
+      .def_readwrite("max_bandwidth_mbps", &VecEnvConfig::max_bandwidth_mbps)
+      .def_readwrite("min_delay_ms", &VecEnvConfig::min_delay_ms)
+      .def_readwrite("max_delay_ms", &VecEnvConfig::max_delay_ms)
+      .def_readwrite("min_queue_bdp", &VecEnvConfig::min_queue_bdp)
+      .def_readwrite("max_queue_bdp", &VecEnvConfig::max_queue_bdp)
+      .def_readwrite("loss_rate", &VecEnvConfig::loss_rate)
+      .def_readwrite("interval_us", &VecEnvConfig::interval_us)
+      .def_readwrite("episode_us", &VecEnvConfig::episode_us)
+      .def_readwrite("history", &VecEnvConfig::history)
+      .def_readwrite("max_cwnd_bdp", &VecEnvConfig::max_cwnd_bdp)
+      .def_readwrite("seed", &VecEnvConfig::seed)
+      .def_readwrite("throughput_weight", &VecEnvConfig::throughput_weight)
+      .def_readwrite("delay_weight", &VecEnvConfig::delay_weight)
+      .def_readwrite("loss_weight", &VecEnvConfig::loss_weight)
+      .def_readwrite("fairness_weight", &VecEnvConfig::fairness_weight);
+
+  py::class_<VecEnv>(m, "VecEnv")
+      .def(py::init<const VecEnvConfig&>(), py::arg("config"))
+      .def_readonly_static("STATE_DIM", &VecEnv::kStateDim)
+      .def_readonly_static("GLOBAL_DIM", &VecEnv::kGlobalDim)
+      .def_readonly_static("METRIC_DIM", &VecEnv::kMetricDim)
+      .def_property_readonly("num_agents", &VecEnv::num_agents)
+      .def_property_readonly("state_dim", &VecEnv::state_dim)
+      .def(
+          "reset",
+          [](py::object self) {
+            VecEnv& env = self.cast<VecEnv&>();
+            {
+              py::gil_scoped_release release;
+              env.reset();
+            }
+            return observations(self, env);
+          },
+          "Start new episodes; returns (states, global_states)")
+      .def(
+          "step",
+          [](py::object self,
+             py::array_t<float, py::array::c_style | py::array::forcecast>
+                 actions) {
+            VecEnv& env = self.cast<VecEnv&>();
+            if (size_t(actions.size()) != env.num_agents()) {
+              throw py::value_error("step: expected one action per agent");
+            }
+            {
+              py::gil_scoped_release release;
+              env.step(actions.data());
+            }
+            const py::ssize_t n = env.num_agents();
+            py::tuple obs = observations(self, env);
+            return py::make_tuple(
+                obs[0], obs[1], view(self, env.rewards(), {n}),
+                view(self, env.dones(), {n}, py::dtype::of<bool>()),
+                view(self, env.metrics(),
+                     {n, py::ssize_t(VecEnv::kMetricDim)}));
+          },
+          py::arg("actions"),
+          "Apply one action per agent and run one control interval; returns "
+          "(states, global_states, rewards, dones, metrics)");
+}
@@ -0,0 +1,194 @@
+#include "replay_buffer.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+
+using namespace std;
+
+TransitionStore::TransitionStore(size_t capacity, size_t s_dim, size_t a_dim,
+                                 size_t g_dim)
+    : capacity_(capacity),
+      s_dim_(s_dim),
+      a_dim_(a_dim),
+      g_dim_(g_dim),
+      s0_(capacity * s_dim),
+      g0_(capacity * g_dim),
+      a_(capacity * a_dim),
+      r_(capacity),
+      s1_(capacity * s_dim),
+      g1_(capacity * g_dim),
+      terminal_(capacity),
+      next_(0),
+      published_(0) {
+  if (capacity == 0) {
+    throw runtime_error("TransitionStore: capacity must be positive");
+  }
+}
+
+size_t TransitionStore::size() const {
+  return min<uint64_t>(published_.load(memory_order_acquire), capacity_);
+}
+
+uint64_t TransitionStore::claim(size_t n) {
+  if (n > capacity_) {
+    throw runtime_error("TransitionStore: more transitions than capacity");
+  }
+  return next_.fetch_add(n, memory_order_relaxed);
+}
+
+/* copy `n` rows of `width` floats to the ring `dst` from slot `slot` on */
+static void copy_rows(vector<float>& dst, size_t capacity, size_t width,
+                      size_t slot, const float* src, size_t n) {
+  if (width == 0) {
+    return;
+  }
+  const size_t first = min(n, capacity - slot);
+  memcpy(&dst[slot * width], src, first * width * sizeof(float));
+  if (first < n) {
+    memcpy(&dst[0], src + first * width, (n - first) * width * sizeof(float));
+  }
+}
+
+void TransitionStore::write(uint64_t position, const TransitionRows& rows,
+                            size_t n) {
+  const size_t slot = position % capacity_;
+  copy_rows(s0_, capacity_, s_dim_, slot, rows.s0, n);
+  copy_rows(g0_, capacity_, g_dim_, slot, rows.g0, n);
+  copy_rows(a_, capacity_, a_dim_, slot, rows.a, n);
+  copy_rows(r_, capacity_, 1, slot, rows.r, n);
+  copy_rows(s1_, capacity_, s_dim_, slot, rows.s1, n);
+  copy_rows(g1_, capacity_, g_dim_, slot, rows.g1, n);
+  copy_rows(terminal_, capacity_, 1, slot, rows.terminal, n);
+}
+
+void TransitionStore::publish(uint64_t position, size_t n) {
+  // the claims before this one are being copied by other threads
+  while (published_.load(memory_order_acquire) != position) {
+    this_thread::yield();
+  }
+  published_.store(position + n, memory_order_release);
+}
+
+void TransitionStore::read(size_t slot, const TransitionBatch& out,
+                           size_t row) const {
+  auto copy_row = [slot, row](const vector<float>& src, size_t width,
+                              float* dst) {
+    copy_n(&src[slot * width], width, dst + row * width);
+  };
+  copy_row(s0_, s_dim_, out.s0);
+  copy_row(g0_, g_dim_, out.g0);
+  copy_row(a_, a_dim_, out.a);
+  copy_row(r_, 1, out.r);
+  copy_row(s1_, s_dim_, out.s1);
+  copy_row(g1_, g_dim_, out.g1);
+  copy_row(terminal_, 1, out.terminal);
+}
+
+ReplayBuffer::ReplayBuffer(size_t capacity, size_t s_dim, size_t a_dim,
+                           size_t g_dim, uint64_t seed)
+    : store_(capacity, s_dim, a_dim, g_dim), rng_(seed) {}
+
+void ReplayBuffer::store(const TransitionRows& rows, size_t n) {
+  const uint64_t position = store_.claim(n);
+  store_.write(position, rows, n);
+  store_.publish(position, n);
+}
+
+void ReplayBuffer::sample(size_t n, const TransitionBatch& out,
+                          int64_t* indices) {
+  const size_t size = store_.size();
+  if (size == 0) {
+    throw runtime_error("ReplayBuffer: sample from an empty buffer");
+  }
+  uniform_int_distribution<size_t> uniform(0, size - 1);
+  for (size_t i = 0; i < n; i++) {
+    const size_t slot = uniform(rng_);
+    store_.read(slot, out, i);
+    if (indices) {
+      indices[i] = slot;
+    }
+  }
+}
+
+PrioritizedReplayBuffer::PrioritizedReplayBuffer(
+    size_t capacity, size_t s_dim, size_t a_dim, size_t g_dim,
+    const PrioritizedConfig& config, uint64_t seed)
+    : config_(config),
+      beta_(config.beta),
+      store_(capacity, s_dim, a_dim, g_dim),
+      tree_(capacity),
+      tree_mutex_(),
+      rng_(seed) {}
+
+void PrioritizedReplayBuffer::store(const TransitionRows& rows, size_t n) {
+  const uint64_t position = store_.claim(n);
+  const size_t capacity = store_.capacity();
+  float priority;
+  {
+    // empty the slots first, so they are not drawn while being overwritten
+    lock_guard<mutex> lock(tree_mutex_);
+    priority = tree_.max() > 0 ? tree_.max() : config_.abs_err_upper;
+    for (size_t i = 0; i < n; i++) {
+      tree_.update((position + i) % capacity, 0);
+    }
+  }
+  store_.write(position, rows, n);
+  {
+    lock_guard<mutex> lock(tree_mutex_);
+    for (size_t i = 0; i < n; i++) {
+      tree_.update((position + i) % capacity, priority);
+    }
+  }
+  store_.publish(position, n);
+}
+
+void PrioritizedReplayBuffer::sample(size_t n, const TransitionBatch& out,
+                                     int64_t* indices, float* weights) {
+  {
+    lock_guard<mutex> lock(tree_mutex_);
+    const double total = tree_.total();
+    if (total <= 0) {
+      throw runtime_error(
+          "PrioritizedReplayBuffer: sample from an empty buffer");
+    }
+    beta_ = min(1.0, beta_ + config_.beta_increment);
+    const double segment = total / n;
+    const double min_priority = tree_.min();
+    uniform_real_distribution<double> uniform(0, 1);
+    for (size_t i = 0; i < n; i++) {
+      const size_t slot = tree_.find(segment * (i + uniform(rng_)));
+      indices[i] = slot;
+      // P(i) / min P reduces to the ratio of the priorities
+      weights[i] = pow(tree_.priority(slot) / min_priority, -beta_);
+    }
+  }
+  for (size_t i = 0; i < n; i++) {
+    store_.read(indices[i], out, i);
+  }
+}
+
+void PrioritizedReplayBuffer::update_priorities(const int64_t* indices,
+                                                const float* errors,
+                                                size_t n) {
+  lock_guard<mutex> lock(tree_mutex_);
+  for (size_t i = 0; i < n; i++) {
+    if (indices[i] < 0 or size_t(indices[i]) >= store_.capacity()) {
+      throw out_of_range("PrioritizedReplayBuffer: index out of range");
+    }
+    // an empty slot is being overwritten since it was sampled
+    if (tree_.priority(indices[i]) == 0) {
+      continue;
+    }
+    const double error =
+        min(double(abs(errors[i])) + config_.epsilon, config_.abs_err_upper);
+    tree_.update(indices[i], pow(error, config_.alpha));
+  }
+}
+
+double PrioritizedReplayBuffer::total_priority() const {
+  lock_guard<mutex> lock(tree_mutex_);
+  return tree_.total();
+}
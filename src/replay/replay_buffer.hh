@@ -0,0 +1,154 @@
+#ifndef REPLAY_BUFFER_HH
+#define REPLAY_BUFFER_HH
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <vector>
+
+#include "sum_tree.hh"
+
+/* row-major transitions to store, as the arguments of store_many() in
+ * python/helpers/buffer.py: s0 and s1 are s_dim wide, g0 and g1 g_dim, a
+ * a_dim, r and terminal 1 */
+struct TransitionRows {
+  const float* s0;
+  const float* g0;
+  const float* a;
+  const float* r;
+  const float* s1;
+  const float* g1;
+  const float* terminal;
+};
+
+/* where a sample is written, same layout */
+struct TransitionBatch {
+  float* s0;
+  float* g0;
+  float* a;
+  float* r;
+  float* s1;
+  float* g1;
+  float* terminal;
+};
+
+/**
+ * @brief Fixed-size ring of transitions, one array per field.
+ *
+ * Several threads may store at once: each claims its slots with one atomic
+ * add and copies without a lock; the stored transitions become visible to
+ * size() in claim order. Once the ring has wrapped, a sample taken while
+ * another thread stores may read a slot that is being overwritten.
+ */
+class TransitionStore {
+ public:
+  TransitionStore(size_t capacity, size_t s_dim, size_t a_dim, size_t g_dim);
+
+  TransitionStore(const TransitionStore&) = delete;
+  TransitionStore& operator=(const TransitionStore&) = delete;
+
+  size_t capacity() const { return capacity_; }
+  size_t s_dim() const { return s_dim_; }
+  size_t a_dim() const { return a_dim_; }
+  size_t g_dim() const { return g_dim_; }
+  /* transitions stored, at most capacity() */
+  size_t size() const;
+
+  /* reserve `n` consecutive positions; slot of a position is position %
+   * capacity() */
+  uint64_t claim(size_t n);
+  void write(uint64_t position, const TransitionRows& rows, size_t n);
+  /* make positions up to position + n visible, after the earlier claims */
+  void publish(uint64_t position, size_t n);
+
+  /* copy slot `slot` into row `row` of `out` */
+  void read(size_t slot, const TransitionBatch& out, size_t row) const;
+
+ private:
+  size_t capacity_, s_dim_, a_dim_, g_dim_;
+  std::vector<float> s0_, g0_, a_, r_, s1_, g1_, terminal_;
+  std::atomic<uint64_t> next_;
+  std::atomic<uint64_t> published_;
+};
+
+/**
+ * @brief Uniform replay buffer, ReplayBuffer in python/helpers/buffer.py.
+ *
+ * store() may be called from several threads; sample() from one.
+ */
+class ReplayBuffer {
+ public:
+  ReplayBuffer(size_t capacity, size_t s_dim, size_t a_dim, size_t g_dim,
+               uint64_t seed = 1);
+
+  void store(const TransitionRows& rows, size_t n);
+
+  /* draw `n` transitions with replacement; `indices` may be null */
+  void sample(size_t n, const TransitionBatch& out, int64_t* indices);
+
+  const TransitionStore& transitions() const { return store_; }
+  size_t size() const { return store_.size(); }
+
+ private:
+  TransitionStore store_;
+  std::mt19937_64 rng_;
+};
+
+/* the class attributes of Prioritized_ReplayBuffer */
+struct PrioritizedConfig {
+  // small amount to avoid zero priority
+  double epsilon = 0.01;
+  // how much the TD error counts in the priority
+  double alpha = 0.6;
+  // importance-sampling exponent, raised by beta_increment every sample
+  double beta = 0.4;
+  double beta_increment = 0.001;
+  // clipped absolute error
+  double abs_err_upper = 1.0;
+};
+
+/**
+ * @brief Prioritized replay buffer, Prioritized_ReplayBuffer in
+ * python/helpers/buffer.py.
+ *
+ * New transitions get the highest priority in the tree. sample() draws one
+ * transition from each of `n` equal slices of the total priority and
+ * weights it by (P(i) / min P)^-beta, the minimum taken over the stored
+ * transitions. store() may be called from several threads; the sum tree is
+ * only locked to mark the claimed slots, not while copying.
+ */
+class PrioritizedReplayBuffer {
+ public:
+  PrioritizedReplayBuffer(size_t capacity, size_t s_dim, size_t a_dim,
+                          size_t g_dim,
+                          const PrioritizedConfig& config = PrioritizedConfig(),
+                          uint64_t seed = 1);
+
+  void store(const TransitionRows& rows, size_t n);
+
+  /* draw `n` transitions into `out`, their slots into `indices` and their
+   * importance weights into `weights` */
+  void sample(size_t n, const TransitionBatch& out, int64_t* indices,
+              float* weights);
+
+  /* set the priorities of sampled slots from their absolute TD errors */
+  void update_priorities(const int64_t* indices, const float* errors,
+                         size_t n);
+
+  const TransitionStore& transitions() const { return store_; }
+  size_t size() const { return store_.size(); }
+  const PrioritizedConfig& config() const { return config_; }
+  double beta() const { return beta_; }
+  double total_priority() const;
+
+ private:
+  PrioritizedConfig config_;
+  double beta_;
+  TransitionStore store_;
+  SumTree tree_;
+  mutable std::mutex tree_mutex_;
+  std::mt19937_64 rng_;
+};
+
+#endif  // REPLAY_BUFFER_HH
@@ -0,0 +1,86 @@
+#include "sum_tree.hh"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+using namespace std;
+
+const SumTree::Node SumTree::kEmpty = {
+    0, numeric_limits<float>::infinity(), 0};
+
+SumTree::SumTree(size_t capacity)
+    : capacity_(capacity), level_offset_(), nodes_() {
+  if (capacity == 0) {
+    throw runtime_error("SumTree: capacity must be positive");
+  }
+  // level sizes from the leaves up, each padded to whole groups of children
+  vector<size_t> sizes;
+  size_t width = capacity;
+  while (true) {
+    const size_t padded = (width + kFanout - 1) / kFanout * kFanout;
+    sizes.push_back(padded);
+    width = padded / kFanout;
+    if (width == 1) {
+      sizes.push_back(1);
+      break;
+    }
+  }
+  reverse(sizes.begin(), sizes.end());
+  size_t offset = 0;
+  for (size_t size : sizes) {
+    level_offset_.push_back(offset);
+    offset += size;
+  }
+  nodes_.assign(offset, kEmpty);
+}
+
+void SumTree::update(size_t index, float priority) {
+  if (index >= capacity_) {
+    throw out_of_range("SumTree: leaf index out of range");
+  }
+  if (not(priority >= 0)) {
+    throw invalid_argument("SumTree: priority must be non-negative");
+  }
+  Node& leaf = nodes_[level_offset_.back() + index];
+  leaf.sum = priority;
+  leaf.min = priority > 0 ? priority : numeric_limits<float>::infinity();
+  leaf.max = priority;
+
+  // recompute the ancestors from their children rather than adding the
+  // difference, so rounding errors do not pile up over millions of updates
+  for (size_t level = level_offset_.size() - 1; level > 0; level--) {
+    index /= kFanout;
+    const Node* child = &nodes_[level_offset_[level] + index * kFanout];
+    Node parent = kEmpty;
+    for (size_t i = 0; i < kFanout; i++) {
+      parent.sum += child[i].sum;
+      parent.min = std::min(parent.min, child[i].min);
+      parent.max = std::max(parent.max, child[i].max);
+    }
+    nodes_[level_offset_[level - 1] + index] = parent;
+  }
+}
+
+size_t SumTree::find(double value) const {
+  size_t index = 0;
+  for (size_t level = 1; level < level_offset_.size(); level++) {
+    const size_t first = index * kFanout;
+    const Node* child = &nodes_[level_offset_[level] + first];
+    // the first non-empty child whose interval holds the value; rounding
+    // may leave a value past the last one, which then takes it
+    size_t chosen = first;
+    for (size_t i = 0; i < kFanout; i++) {
+      if (child[i].sum <= 0) {
+        continue;
+      }
+      chosen = first + i;
+      if (value < child[i].sum) {
+        break;
+      }
+      value -= child[i].sum;
+    }
+    index = chosen;
+  }
+  return index;
+}
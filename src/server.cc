@@ -4,7 +4,6 @@
 
 #include <atomic>
 #include <chrono>
-#include <fstream>
 #include <iostream>
 #include <mutex>
 #include <string>
@@ -12,42 +11,43 @@
 
 #include "address.hh"
 #include "common.hh"
+#include "current_time.hh"
+#include "flow_stats.hh"
 #include "logging.hh"
-#include "socket.hh"
-
-#define BUFFER 1024
+#include "perf_log.hh"
+#include "tcp_receiver.hh"
 
 using namespace std;
 using clock_type = std::chrono::high_resolution_clock;
 
 std::chrono::_V2::system_clock::time_point ts_now = clock_type::now();
-std::unique_ptr<std::ofstream> perf_log;
+std::unique_ptr<PerfLog> perf_log;
+/* per-flow goodput, fairness and convergence; see FlowSampler */
+std::unique_ptr<PerfLog> flow_log, fairness_log, convergence_log;
 std::atomic<bool> recv_traffic(true);
-std::atomic<size_t> recv_cnt = 0;
 static size_t last_observed_recv_cnt = 0;
 bool terminal_out = false;
 void signal_handler(int sig) {
   if (sig == SIGINT or sig == SIGKILL or sig == SIGTERM) {
     // terminate pyhelper
     recv_traffic = false;
-    // close iperf
-    if (perf_log) {
-      perf_log->close();
-    }
+    // no close: other threads may still append, and the rows of a shared
+    // mapping reach the file without one
     // IPC socket will be closed later
     std::this_thread::sleep_for(std::chrono::microseconds(100));
     exit(1);
   }
 }
 
-void perf_log_thread(const std::chrono::milliseconds interval) {
+void perf_log_thread(const TCPReceiver& receiver,
+                     const std::chrono::milliseconds interval) {
   // start regular congestion control pattern
   auto when_started = clock_type::now();
   auto target_time = when_started + interval;
   size_t tmp = 0;
   while (recv_traffic.load()) {
     // log the current throughput in Mbps
-    tmp = recv_cnt;  // use this to avoid read/write competing
+    tmp = receiver.total_bytes();
     double current_thr = (double)(tmp - last_observed_recv_cnt) * 8 / (double)interval.count() * 1000 / 1000000;
     last_observed_recv_cnt = tmp;
     if (perf_log) {
@@ -55,7 +55,7 @@ void perf_log_thread(const std::chrono::milliseconds interval) {
           auto millis_since_epoch = std::chrono::duration_cast<std::chrono::milliseconds>(
               std::chrono::system_clock::now().time_since_epoch()
           ).count();
-          *perf_log << millis_since_epoch << "," << current_thr << "\n";
+          perf_log->append({millis_since_epoch, current_thr});
           
     }
 
@@ -69,14 +69,53 @@ void perf_log_thread(const std::chrono::milliseconds interval) {
   }
 }
 
+/* one row per open flow and one fairness row per sample */
+void write_flow_sample(const FlowSampler& sampler, uint64_t steady_us) {
+  const uint64_t now_ms = currentTime_milliseconds();
+  for (const FlowSample& sample : sampler.samples()) {
+    flow_log->append({now_ms, sample.flow, sample.goodput_mbps});
+  }
+  fairness_log->append({now_ms, uint64_t(sampler.samples().size()),
+                        sampler.total_mbps(), sampler.jain_index()});
+  for (const ConvergenceEvent& event : sampler.converged()) {
+    // the event happened before this sample
+    const uint64_t event_ms = now_ms - (steady_us - event.time_us) / 1000;
+    convergence_log->append({event_ms, event.flow, uint64_t(event.kind),
+                             event.flows, event.convergence_ms});
+    LOG(INFO) << "Flow " << event.flow
+              << (event.kind == ConvergenceEvent::JOIN ? " joined" : " left")
+              << ", " << event.flows << " flow(s) converged in "
+              << event.convergence_ms << " ms";
+  }
+}
+
+void flow_log_thread(FlowSampler& sampler,
+                     const std::chrono::microseconds interval) {
+  auto target_time = std::chrono::steady_clock::now() + interval;
+  while (recv_traffic.load()) {
+    std::this_thread::sleep_until(target_time);
+    target_time += interval;
+    const uint64_t now_us = steadyTime_microseconds();
+    sampler.sample(now_us);
+    write_flow_sample(sampler, now_us);
+  }
+}
+
 void usage_error(const string& program_name) {
   cerr << "Usage: " << program_name << " [OPTION]... [COMMAND]" << "\n";
   cerr << "\n";
   cerr << "Options = --ip=IP_ADDR --port=PORT --cong=ALGORITHM (default: "
           "CUBIC) --perf-log=PATH(default is None) --perf-interval=MS "
-          "--one-off"
+          "--one-off --workers=N --splice --flow-log=PATH "
+          "--flow-interval=MS"
        << "\n"
-       << "If perf_log is specified, the default log interval is 500ms" << "\n";
+       << "If perf_log is specified, the default log interval is 500ms" << "\n"
+       << "Flows are served concurrently; --workers=N serves them from N "
+          "threads with SO_REUSEPORT, --splice discards the data in the "
+          "kernel" << "\n"
+       << "--flow-log writes the goodput of every flow (default every "
+          "10ms) to PATH, Jain's index to PATH.fairness and convergence "
+          "times to PATH.convergence" << "\n";
   cerr << "\n";
 
   throw runtime_error("invalid arguments");
@@ -97,9 +136,15 @@ int main(int argc, char** argv) {
       {"perf-interval", optional_argument, nullptr, 'i'},
       {"terminal-out", no_argument, nullptr, 't'},
       {"one-off", no_argument, nullptr, 'o'},
+      {"workers", required_argument, nullptr, 'w'},
+      {"splice", no_argument, nullptr, 's'},
+      {"flow-log", required_argument, nullptr, 'f'},
+      {"flow-interval", required_argument, nullptr, 'g'},
       {0, 0, nullptr, 0}};
 
-  string service, cong_ctl, interval, perf_log_path;
+  string service, cong_ctl, interval, perf_log_path, flow_log_path;
+  ReceiverConfig config;
+  FlowSamplerConfig sampler_config;
   while (true) {
     const int opt = getopt_long(argc, argv, "", command_line_options, nullptr);
     if (opt == -1) { /* end of options */
@@ -124,6 +169,18 @@ int main(int argc, char** argv) {
     case 'o':
       one_off = true;
       break;
+    case 'w':
+      config.workers = stoul(optarg);
+      break;
+    case 's':
+      config.splice = true;
+      break;
+    case 'f':
+      flow_log_path = optarg;
+      break;
+    case 'g':
+      sampler_config.interval_us = stod(optarg) * 1000;
+      break;
     case '?':
       usage_error(argv[0]);
       break;
@@ -145,28 +202,42 @@ int main(int argc, char** argv) {
   // init perf log file
   std::chrono::milliseconds log_interval(500ms);
   if (!perf_log_path.empty()) {
-    perf_log.reset(new std::ofstream(perf_log_path));
-    if (!perf_log->good()) {
-      throw runtime_error(perf_log_path + ": error opening for writing");
-    }
+    perf_log.reset(new PerfLog(perf_log_path, {{"time", PerfType::U64},
+                                               {"goodput", PerfType::F64}}));
+  }
+
+  if (!flow_log_path.empty()) {
+    flow_log.reset(new PerfLog(flow_log_path, {{"time", PerfType::U64},
+                                               {"flow", PerfType::U64},
+                                               {"goodput", PerfType::F64}}));
+    fairness_log.reset(new PerfLog(flow_log_path + ".fairness",
+                                   {{"time", PerfType::U64},
+                                    {"flows", PerfType::U64},
+                                    {"goodput", PerfType::F64},
+                                    {"jain_index", PerfType::F64}}));
+    // event: 1 join, 0 leave; convergence -1 if the next event came first or
+    // the last flow left
+    convergence_log.reset(new PerfLog(flow_log_path + ".convergence",
+                                      {{"time", PerfType::U64},
+                                       {"flow", PerfType::U64},
+                                       {"event", PerfType::U64},
+                                       {"flows", PerfType::U64},
+                                       {"convergence_ms", PerfType::F64}}));
   }
 
   if (!interval.empty()) {
     log_interval = std::chrono::milliseconds(stoi(interval));
   }
-  int port = stoi(service);
-  // init server addr
-  Address address("0.0.0.0", port);
-  TCPSocket server;
-  /* set reuse_addr */
-  server.set_reuseaddr();
-  server.bind(address);
-  server.listen();
-  LOG(INFO) << "Server listen at " << port;
+  config.port = stoi(service);
+  config.congestion_control = cong_ctl;
+  config.one_off = one_off;
+  TCPReceiver receiver(config);
+  LOG(INFO) << "Server listen at " << config.port << " with "
+            << config.workers << " worker(s)";
 
   // Accept exactly one client if --one-off is set, otherwise loop
   if (one_off) {
-    LOG(INFO) << "One-off mode: will accept a single connection and then exit.";
+    LOG(INFO) << "One-off mode: will exit when the first connection ends.";
   } else {
     LOG(INFO) << "Normal mode: will accept connections continuously.";
   }
@@ -175,51 +246,40 @@ int main(int argc, char** argv) {
   thread log_thread;
   if (perf_log || terminal_out) {
     cerr << "Server start with perf logger" << (one_off ? " one-off mode is enabled.\n" : "\n");
-    log_thread = std::move(std::thread(perf_log_thread, log_interval));
-    if (perf_log) {
-      *perf_log << "time,goodput" << "\n";
-    }
+    log_thread = std::move(
+        std::thread(perf_log_thread, std::cref(receiver), log_interval));
+  }
+  unique_ptr<FlowSampler> sampler;
+  thread flow_thread;
+  if (flow_log) {
+    sampler.reset(new FlowSampler(receiver, sampler_config));
+    flow_thread = std::thread(
+        flow_log_thread, std::ref(*sampler),
+        std::chrono::microseconds(sampler_config.interval_us));
   }
   if (terminal_out){
     cout << "----START----" << "\n";
     //cout << "time,goodput" << "\n";
   }
-  while (true) {
-    // For multiple connections, we'd normally do this in a loop
-    // but for simplicity, let's do it once if one_off is true
-    TCPSocket client = server.accept();
-    struct timeval timeout = {10, 0};  // 10-second timeout
-    setsockopt(client.fd_num(), SOL_SOCKET, SO_RCVTIMEO, (char *)&timeout,
-               sizeof(timeout));
-    setsockopt(client.fd_num(), SOL_SOCKET, SO_SNDTIMEO, (char *)&timeout,
-               sizeof(timeout));
-    client.set_congestion_control(cong_ctl);
-    LOG(DEBUG) << "Congestion control algorithm: " << cong_ctl;
-
-    // Now read data until the connection is closed or an error
-    while (true) {
-      string data = client.read(BUFFER);
-      if (data.empty()) {
-        LOG(INFO) << "Connection closed by client";
-        break;
-      }
-      recv_cnt += data.size();
+  // serves every connection until the one-off connection ends
+  receiver.run();
+  if (one_off) {
+    LOG(INFO) << "One-off connection ended, exiting with code 0";
+    // Signal the logging thread to end
+    recv_traffic = false;
+    if (log_thread.joinable()) {
+      log_thread.join();
     }
-
-    if (one_off) {
-      // Exit with 0 after the single connection is finished
-      LOG(INFO) << "One-off connection ended, exiting with code 0";
-      // Signal the logging thread to end
-      recv_traffic = false;
-      if (log_thread.joinable()) {
-        log_thread.join();
-      }
-      cout << "----END----" << "\n";
-
-      return 0;
+    if (flow_thread.joinable()) {
+      flow_thread.join();
+      // the end of the one-off flow
+      const uint64_t now_us = steadyTime_microseconds();
+      sampler->sample(now_us);
+      write_flow_sample(*sampler, now_us);
     }
+    cout << "----END----" << "\n";
 
-    // If not one-off, we go back and accept the next connection
+    return 0;
   }
 
   // If we ever exit the loop in non--one-off mode, close logging and exit
@@ -227,5 +287,8 @@ int main(int argc, char** argv) {
   if (log_thread.joinable()) {
     log_thread.join();
   }
+  if (flow_thread.joinable()) {
+    flow_thread.join();
+  }
   return 0;
 }
@@ -0,0 +1,50 @@
+#include "bottleneck.hh"
+
+#include <algorithm>
+
+Bottleneck::Bottleneck(Simulator& sim, const DeliveryTrace& trace,
+                       size_t queue_packets, double loss_rate, uint64_t seed)
+    : sim_(sim),
+      trace_(trace),
+      capacity_(queue_packets),
+      loss_rate_(loss_rate),
+      rng_(seed),
+      next_opportunity_(0),
+      scheduled_(false),
+      delivered_(0),
+      dropped_(0) {}
+
+bool Bottleneck::enqueue(const SimPacket& packet) {
+  if (queue_.size() >= capacity_ or
+      (loss_rate_ > 0 and uniform_(rng_) < loss_rate_)) {
+    dropped_++;
+    return false;
+  }
+  queue_.push_back(packet);
+  if (not scheduled_) {
+    schedule_delivery();
+  }
+  return true;
+}
+
+void Bottleneck::schedule_delivery() {
+  // opportunities that passed while the queue was empty are gone
+  next_opportunity_ =
+      std::max(next_opportunity_, trace_.first_opportunity_at(sim_.now()));
+  scheduled_ = true;
+  sim_.at(trace_.opportunity_us(next_opportunity_), [this] { deliver(); });
+}
+
+void Bottleneck::deliver() {
+  scheduled_ = false;
+  next_opportunity_++;
+  const SimPacket packet = queue_.front();
+  queue_.pop_front();
+  delivered_++;
+  if (not queue_.empty()) {
+    schedule_delivery();
+  }
+  if (receiver_) {
+    receiver_(packet);
+  }
+}
@@ -0,0 +1,67 @@
+#ifndef BOTTLENECK_HH
+#define BOTTLENECK_HH
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <random>
+
+#include "delivery_trace.hh"
+#include "simulator.hh"
+
+/* a data packet in the simulator; all packets are MSS-sized */
+struct SimPacket {
+  uint32_t flow;
+  uint64_t id;
+};
+
+/**
+ * @brief Trace-driven bottleneck link with a drop-tail queue, like
+ * mm-link with --uplink-queue=droptail --uplink-queue-args=packets=N.
+ *
+ * Each delivery opportunity of the trace carries one queued packet;
+ * opportunities that find the queue empty are lost. An optional random
+ * loss (mm-loss) is applied on arrival.
+ */
+class Bottleneck {
+ public:
+  using Receiver = std::function<void(const SimPacket&)>;
+
+  Bottleneck(Simulator& sim, const DeliveryTrace& trace, size_t queue_packets,
+             double loss_rate = 0, uint64_t seed = 1);
+
+  Bottleneck(const Bottleneck&) = delete;
+  Bottleneck& operator=(const Bottleneck&) = delete;
+
+  /* called for every packet that leaves the link */
+  void set_receiver(Receiver receiver) { receiver_ = std::move(receiver); }
+
+  /* returns false if the packet was dropped */
+  bool enqueue(const SimPacket& packet);
+
+  size_t queue_length() const { return queue_.size(); }
+  uint64_t delivered() const { return delivered_; }
+  uint64_t dropped() const { return dropped_; }
+  const DeliveryTrace& trace() const { return trace_; }
+
+ private:
+  void schedule_delivery();
+  void deliver();
+
+  Simulator& sim_;
+  const DeliveryTrace& trace_;
+  size_t capacity_;
+  double loss_rate_;
+  std::mt19937_64 rng_;
+  std::uniform_real_distribution<double> uniform_{0.0, 1.0};
+  Receiver receiver_{};
+  std::deque<SimPacket> queue_{};
+  // next unused delivery opportunity
+  uint64_t next_opportunity_;
+  // a delivery event is pending
+  bool scheduled_;
+  uint64_t delivered_;
+  uint64_t dropped_;
+};
+
+#endif  // BOTTLENECK_HH
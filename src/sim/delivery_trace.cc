@@ -0,0 +1,74 @@
+#include "delivery_trace.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+
+using namespace std;
+
+DeliveryTrace::DeliveryTrace(vector<uint64_t>&& timestamps_ms,
+                             uint64_t period_ms)
+    : timestamps_ms_(move(timestamps_ms)), period_ms_(period_ms) {}
+
+DeliveryTrace::DeliveryTrace(const string& path)
+    : timestamps_ms_(), period_ms_(0) {
+  ifstream in(path);
+  if (not in.good()) {
+    throw runtime_error(path + ": error opening trace");
+  }
+  string line;
+  while (getline(in, line)) {
+    if (line.empty()) {
+      continue;
+    }
+    size_t pos = 0;
+    const unsigned long long ms = stoull(line, &pos);
+    if (pos != line.size() and line.find_first_not_of(" \t\r", pos) !=
+                                   string::npos) {
+      throw runtime_error(path + ": malformed line \"" + line + "\"");
+    }
+    if (not timestamps_ms_.empty() and ms < timestamps_ms_.back()) {
+      throw runtime_error(path + ": timestamps must be non-decreasing");
+    }
+    timestamps_ms_.push_back(ms);
+  }
+  if (timestamps_ms_.empty() or timestamps_ms_.back() == 0) {
+    throw runtime_error(path + ": trace must last at least 1 ms");
+  }
+  period_ms_ = timestamps_ms_.back();
+}
+
+DeliveryTrace DeliveryTrace::constant(double mbps) {
+  if (mbps <= 0) {
+    throw runtime_error("DeliveryTrace: bandwidth must be positive");
+  }
+  // one second of opportunities, spread evenly over the milliseconds
+  const uint64_t period_ms = 1000;
+  const uint64_t packets =
+      max<uint64_t>(1, llround(mbps * 1e6 / (kTraceMTU * 8)));
+  vector<uint64_t> timestamps(packets);
+  for (uint64_t i = 0; i < packets; i++) {
+    timestamps[i] = i * period_ms / packets;
+  }
+  return DeliveryTrace(move(timestamps), period_ms);
+}
+
+uint64_t DeliveryTrace::opportunity_us(uint64_t index) const {
+  const uint64_t n = timestamps_ms_.size();
+  return (index / n * period_ms_ + timestamps_ms_[index % n]) * 1000;
+}
+
+uint64_t DeliveryTrace::first_opportunity_at(uint64_t time_us) const {
+  const uint64_t n = timestamps_ms_.size();
+  const uint64_t time_ms = (time_us + 999) / 1000;
+  const uint64_t period = time_ms / period_ms_;
+  const uint64_t offset = time_ms - period * period_ms_;
+  const auto it =
+      lower_bound(timestamps_ms_.begin(), timestamps_ms_.end(), offset);
+  return period * n + (it - timestamps_ms_.begin());
+}
+
+double DeliveryTrace::average_mbps() const {
+  return double(timestamps_ms_.size()) * kTraceMTU * 8 / period_ms_ / 1e3;
+}
@@ -0,0 +1,44 @@
+#ifndef DELIVERY_TRACE_HH
+#define DELIVERY_TRACE_HH
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/* mahimahi delivery opportunities are for one MTU */
+const uint32_t kTraceMTU = 1500;
+
+/**
+ * @brief A mahimahi packet delivery trace.
+ *
+ * Each line of a trace file is the millisecond at which the link may
+ * deliver one MTU-sized packet; several lines may share a millisecond.
+ * Like mm-link, the trace repeats with the period of its last timestamp.
+ * Opportunities are numbered from 0 over all repetitions.
+ */
+class DeliveryTrace {
+ public:
+  /* throws runtime_error on a missing or malformed file */
+  explicit DeliveryTrace(const std::string& path);
+
+  /* constant rate, as written by python/helpers/generate_trace.py */
+  static DeliveryTrace constant(double mbps);
+
+  /* time of opportunity `index` */
+  uint64_t opportunity_us(uint64_t index) const;
+
+  /* first opportunity at or after `time_us` */
+  uint64_t first_opportunity_at(uint64_t time_us) const;
+
+  /* long-term average capacity */
+  double average_mbps() const;
+
+ private:
+  DeliveryTrace(std::vector<uint64_t>&& timestamps_ms, uint64_t period_ms);
+
+  // sorted, in ms since the start of a period
+  std::vector<uint64_t> timestamps_ms_;
+  uint64_t period_ms_;
+};
+
+#endif  // DELIVERY_TRACE_HH
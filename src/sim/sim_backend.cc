@@ -0,0 +1,70 @@
+#include "sim_backend.hh"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+
+SimDeepCCBackend::SimDeepCCBackend(const DeliveryTrace& trace,
+                                   uint64_t base_rtt_us, size_t queue_packets,
+                                   uint64_t step_us, double loss_rate,
+                                   uint64_t seed)
+    : network_(trace, queue_packets, loss_rate, seed),
+      flow_(network_.add_flow(base_rtt_us)),
+      step_us_(step_us),
+      now_us_(0) {
+  if (step_us == 0) {
+    throw runtime_error("SimDeepCCBackend: step must be positive");
+  }
+}
+
+TCPDeepCCInfo SimDeepCCBackend::get_info() {
+  now_us_ += step_us_;
+  network_.run_until(now_us_);
+  return flow_.get_info();
+}
+
+void SimDeepCCBackend::set_cwnd(int cwnd) {
+  // cwnd_min of tcp_astraea
+  flow_.set_cwnd(max(cwnd, 1));
+}
+
+unique_ptr<DeepCCBackend> make_deepcc_backend(const string& spec, int fd,
+                                              uint64_t step_us) {
+  vector<string> fields;
+  stringstream ss(spec);
+  for (string field; getline(ss, field, ':');) {
+    fields.push_back(field);
+  }
+  const string kind = fields.empty() ? "kernel" : fields[0];
+  auto invalid = [&spec]() {
+    return runtime_error("invalid DeepCC backend: " + spec);
+  };
+
+  if (kind == "kernel" and fields.size() <= 1) {
+    return unique_ptr<DeepCCBackend>(new KernelDeepCCBackend(fd));
+  }
+  if (kind == "replay" and fields.size() == 2) {
+    return unique_ptr<DeepCCBackend>(new ReplayDeepCCBackend(
+        read_recorded_deepcc_info(fields[1]), step_us));
+  }
+  if ((kind == "link" or kind == "trace") and
+      (fields.size() == 3 or fields.size() == 4)) {
+    try {
+      const double rtt_ms = stod(fields[2]);
+      const size_t queue = fields.size() == 4 ? stoul(fields[3]) : 100;
+      const DeliveryTrace trace = kind == "link"
+                                      ? DeliveryTrace::constant(stod(fields[1]))
+                                      : DeliveryTrace(fields[1]);
+      return unique_ptr<DeepCCBackend>(
+          new SimDeepCCBackend(trace, rtt_ms * 1000, queue, step_us));
+    } catch (const invalid_argument&) {
+      throw invalid();
+    } catch (const out_of_range&) {
+      throw invalid();
+    }
+  }
+  throw invalid();
+}
@@ -0,0 +1,51 @@
+#ifndef SIM_BACKEND_HH
+#define SIM_BACKEND_HH
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "deepcc_backend.hh"
+#include "sim_network.hh"
+
+/**
+ * A simulated flow over a trace-driven bottleneck in place of the patched
+ * kernel: get_info() runs the simulation for `step_us` and returns what
+ * deepcc_get_info() would, and set_cwnd() sets the window of the simulated
+ * flow. Simulated time only moves in get_info(), so the same windows give
+ * the same statistics every run, whatever the machine.
+ */
+class SimDeepCCBackend : public DeepCCBackend {
+ public:
+  SimDeepCCBackend(const DeliveryTrace& trace, uint64_t base_rtt_us,
+                   size_t queue_packets, uint64_t step_us,
+                   double loss_rate = 0, uint64_t seed = 1);
+
+  void enable(int) override {}
+  TCPDeepCCInfo get_info() override;
+  void set_cwnd(int cwnd) override;
+  uint64_t now_us() override { return now_us_; }
+
+  const SimFlow& flow() const { return flow_; }
+
+ private:
+  SimNetwork network_;
+  SimFlow& flow_;
+  uint64_t step_us_;
+  uint64_t now_us_;
+};
+
+/**
+ * The backend named by a --deepcc-backend option, `step_us` being the
+ * control interval:
+ *   kernel                          the socket `fd` (default)
+ *   link:MBPS:RTT_MS[:QUEUE]        constant-rate bottleneck
+ *   trace:MAHIMAHI_TRACE:RTT_MS[:QUEUE]
+ *                                   trace-driven bottleneck, as mm-link
+ *   replay:PERF_LOG                 the rows of a client --perf-log
+ * QUEUE is the drop-tail queue in packets, 100 by default.
+ */
+std::unique_ptr<DeepCCBackend> make_deepcc_backend(const std::string& spec,
+                                                   int fd, uint64_t step_us);
+
+#endif  // SIM_BACKEND_HH
@@ -0,0 +1,274 @@
+#include "sim_flow.hh"
+
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+
+/* THR_SCALE_DEEPCC */
+const int kThrScale = 24;
+/* tp->cwnd_min */
+const uint32_t kCwndMin = 1;
+/* TCP_INFINITE_SSTHRESH */
+const uint32_t kInfiniteSsthresh = 0x7fffffff;
+/* tcp_mss_to_mtu(): IPv4 and TCP headers with timestamps */
+const uint32_t kHeaderBytes = 52;
+/* packets acked after a packet before it is considered lost */
+const uint64_t kReorderingThreshold = 3;
+const uint64_t kInitialRtoUs = 1000000;
+const uint64_t kMinRtoUs = 200000;
+const uint64_t kMaxRtoUs = 60000000;
+
+SimFlow::SimFlow(Simulator& sim, Bottleneck& link, uint32_t id,
+                 uint64_t base_rtt_us, uint32_t mss, uint32_t initial_cwnd)
+    : sim_(sim),
+      link_(link),
+      id_(id),
+      base_rtt_us_(base_rtt_us),
+      mss_(mss),
+      cwnd_(max(initial_cwnd, kCwndMin)),
+      running_(false),
+      window_base_(0),
+      next_id_(0),
+      loss_scan_(0),
+      in_flight_(0),
+      retrans_out_(0),
+      pending_retransmits_(0),
+      delivered_(0),
+      delivered_us_(0),
+      first_tx_us_(0),
+      srtt_us_(0),
+      rttvar_us_(0),
+      rto_us_(kInitialRtoUs),
+      rto_deadline_(0),
+      rto_scheduled_(false),
+      lost_(0),
+      snd_ssthresh_(kInfiniteSsthresh),
+      recovery_end_id_(0),
+      max_packets_out_(0),
+      max_packets_out_round_(0),
+      min_urtt_(0),
+      avg_urtt_(0),
+      cnt_(0),
+      avg_thr_(0),
+      thr_cnt_(0),
+      pre_lost_(0) {}
+
+void SimFlow::start() {
+  running_ = true;
+  send_packets();
+}
+
+void SimFlow::stop() { running_ = false; }
+
+void SimFlow::set_cwnd(uint32_t cwnd) {
+  cwnd_ = max(cwnd, kCwndMin);
+  send_packets();
+}
+
+TCPDeepCCInfo SimFlow::get_info() {
+  TCPDeepCCInfo info;
+  info.init();
+  info.min_rtt = min_urtt_;
+  info.avg_urtt = avg_urtt_;
+  info.cnt = cnt_;
+  info.avg_thr = avg_thr_ * mss_ * 1000000 >> kThrScale;
+  info.thr_cnt = thr_cnt_;
+  info.cwnd = cwnd_;
+  // astraea_update_pacing_rate()
+  uint64_t rate = uint64_t(mss_ + kHeaderBytes) * 1000000 *
+                  max(cwnd_, packets_out());
+  if (srtt_us_ >> 3) {
+    rate /= srtt_us_ >> 3;
+  }
+  info.pacing_rate = min<uint64_t>(rate, numeric_limits<u32>::max());
+  info.lost_bytes = (lost_ - pre_lost_) * mss_;
+  info.srtt_us = srtt_us_;
+  info.snd_ssthresh = snd_ssthresh_;
+  info.packets_out = packets_out();
+  info.retrans_out = retrans_out_;
+  info.max_packets_out = max_packets_out_;
+  info.mss = mss_;
+
+  // the samples are per monitor interval
+  cnt_ = 0;
+  avg_urtt_ = 0;
+  thr_cnt_ = 0;
+  avg_thr_ = 0;
+  pre_lost_ = lost_;
+  return info;
+}
+
+void SimFlow::on_delivered(const SimPacket& packet) {
+  const uint64_t packet_id = packet.id;
+  sim_.after(base_rtt_us_, [this, packet_id] { on_ack(packet_id); });
+}
+
+void SimFlow::send_packets() {
+  while (running_ and in_flight_ < cwnd_) {
+    transmit();
+  }
+}
+
+void SimFlow::transmit() {
+  const uint64_t now = sim_.now();
+  // tcp_rate_skb_sent(): restart the sampling after an idle period
+  if (packets_out() == 0) {
+    first_tx_us_ = now;
+    delivered_us_ = now;
+  }
+  const bool retransmit = pending_retransmits_ > 0;
+  if (retransmit) {
+    pending_retransmits_--;
+    retrans_out_++;
+    totals_.retransmitted++;
+  }
+  window_.push_back({now, delivered_, delivered_us_, first_tx_us_, retransmit,
+                     PacketState::IN_FLIGHT});
+  const uint64_t packet_id = next_id_++;
+  in_flight_++;
+  totals_.sent++;
+  max_packets_out_ = max(max_packets_out_, packets_out());
+  if (in_flight_ == 1) {
+    arm_rto();
+  }
+  link_.enqueue({id_, packet_id});
+}
+
+void SimFlow::on_ack(uint64_t packet_id) {
+  if (packet_id < window_base_) {
+    return;
+  }
+  Transmission& packet = window_[packet_id - window_base_];
+  if (packet.state != PacketState::IN_FLIGHT) {
+    // already declared lost and retransmitted
+    return;
+  }
+  packet.state = PacketState::ACKED;
+  in_flight_--;
+  if (packet.retransmit) {
+    retrans_out_--;
+  }
+  delivered_++;
+  delivered_us_ = sim_.now();
+  totals_.acked++;
+
+  // Karn: no RTT samples from retransmissions
+  if (not packet.retransmit) {
+    sample_rtt(sim_.now() - packet.sent_us);
+  }
+  sample_rate(packet);
+  detect_losses(packet_id);
+
+  // max_packets_out covers the current round trip
+  if (packet_id >= max_packets_out_round_) {
+    max_packets_out_ = packets_out();
+    max_packets_out_round_ = next_id_;
+  }
+  while (not window_.empty() and
+         window_.front().state != PacketState::IN_FLIGHT) {
+    window_.pop_front();
+    window_base_++;
+  }
+  if (in_flight_ > 0) {
+    arm_rto();
+  }
+  send_packets();
+}
+
+void SimFlow::sample_rtt(uint64_t rtt_us) {
+  const uint32_t rtt = min<uint64_t>(rtt_us, numeric_limits<u32>::max());
+  // deepcc_pkts_acked()
+  if (min_urtt_ == 0 or min_urtt_ > rtt) {
+    min_urtt_ = rtt;
+  }
+  if (rtt > 0) {
+    avg_urtt_ = (uint64_t(cnt_) * avg_urtt_ + rtt) / (cnt_ + 1);
+    cnt_++;
+  }
+  // tcp_rtt_estimator(), RFC 6298
+  if (srtt_us_ == 0) {
+    srtt_us_ = rtt << 3;
+    rttvar_us_ = rtt / 2;
+  } else {
+    const uint32_t srtt = srtt_us_ >> 3;
+    const uint32_t err = rtt > srtt ? rtt - srtt : srtt - rtt;
+    srtt_us_ = srtt_us_ - srtt + rtt;
+    rttvar_us_ = rttvar_us_ - rttvar_us_ / 4 + err / 4;
+  }
+  rto_us_ = max(kMinRtoUs, uint64_t(srtt_us_ >> 3) + 4 * rttvar_us_);
+  totals_.rtt_sum_us += rtt;
+  totals_.rtt_samples++;
+}
+
+void SimFlow::sample_rate(const Transmission& packet) {
+  // tcp_rate_skb_delivered() and tcp_rate_gen()
+  const uint64_t send_elapsed = packet.sent_us - packet.first_tx_us;
+  const uint64_t ack_elapsed = sim_.now() - packet.delivered_us;
+  first_tx_us_ = max(first_tx_us_, packet.sent_us);
+  const uint64_t interval_us = max(send_elapsed, ack_elapsed);
+  const uint64_t delivered = delivered_ - packet.delivered;
+  if (interval_us == 0 or interval_us < min_urtt_) {
+    return;
+  }
+  // deepcc_get_rate_sample()
+  const uint64_t bw = (delivered << kThrScale) / interval_us;
+  avg_thr_ = (avg_thr_ * thr_cnt_ + bw) / (thr_cnt_ + 1);
+  thr_cnt_++;
+}
+
+void SimFlow::detect_losses(uint64_t acked_id) {
+  loss_scan_ = max(loss_scan_, window_base_);
+  while (loss_scan_ + kReorderingThreshold <= acked_id) {
+    if (window_[loss_scan_ - window_base_].state == PacketState::IN_FLIGHT) {
+      mark_lost(loss_scan_);
+    }
+    loss_scan_++;
+  }
+}
+
+void SimFlow::mark_lost(uint64_t packet_id) {
+  Transmission& packet = window_[packet_id - window_base_];
+  packet.state = PacketState::LOST;
+  in_flight_--;
+  if (packet.retransmit) {
+    retrans_out_--;
+  }
+  lost_++;
+  totals_.lost++;
+  pending_retransmits_++;
+  // astraea_ssthresh(): once per loss episode
+  if (packet_id >= recovery_end_id_) {
+    snd_ssthresh_ = max(cwnd_, 10U);
+    recovery_end_id_ = next_id_;
+  }
+}
+
+void SimFlow::arm_rto() {
+  rto_deadline_ = sim_.now() + rto_us_;
+  if (not rto_scheduled_) {
+    rto_scheduled_ = true;
+    sim_.at(rto_deadline_, [this] { on_rto(); });
+  }
+}
+
+void SimFlow::on_rto() {
+  rto_scheduled_ = false;
+  if (in_flight_ == 0) {
+    return;
+  }
+  // acks moved the deadline since this event was scheduled
+  if (sim_.now() < rto_deadline_) {
+    rto_scheduled_ = true;
+    sim_.at(rto_deadline_, [this] { on_rto(); });
+    return;
+  }
+  totals_.timeouts++;
+  for (uint64_t id = window_base_; id < next_id_; id++) {
+    if (window_[id - window_base_].state == PacketState::IN_FLIGHT) {
+      mark_lost(id);
+    }
+  }
+  rto_us_ = min(rto_us_ * 2, kMaxRtoUs);
+  send_packets();
+}
@@ -0,0 +1,131 @@
+#ifndef SIM_FLOW_HH
+#define SIM_FLOW_HH
+
+#include <cstdint>
+#include <deque>
+
+#include "bottleneck.hh"
+#include "simulator.hh"
+#include "tcp_info.hh"
+
+/* lifetime totals of a simulated flow, for reports */
+struct SimFlowTotals {
+  uint64_t sent = 0;
+  uint64_t acked = 0;
+  uint64_t lost = 0;
+  uint64_t retransmitted = 0;
+  uint64_t timeouts = 0;
+  uint64_t rtt_sum_us = 0;
+  uint64_t rtt_samples = 0;
+};
+
+/**
+ * @brief A backlogged TCP sender behind the Astraea congestion control.
+ *
+ * The window is whatever was last set with set_cwnd(): like tcp_astraea,
+ * losses are repaired but do not shrink it. get_info() returns the same
+ * statistics as TCP_DEEPCC_INFO, sampled the way deepcc_pkts_acked() and
+ * deepcc_get_rate_sample() do in the kernel patch, and resets the
+ * per-monitor-interval ones like deepcc_get_info().
+ *
+ * Every transmission, including a retransmission, is a packet with a new
+ * id. The receiver acknowledges each packet once, one base RTT after it
+ * left the bottleneck. A packet is lost once three packets sent after it
+ * are acknowledged, or on a retransmission timeout.
+ */
+class SimFlow {
+ public:
+  SimFlow(Simulator& sim, Bottleneck& link, uint32_t id, uint64_t base_rtt_us,
+          uint32_t mss = 1448, uint32_t initial_cwnd = 10);
+
+  SimFlow(const SimFlow&) = delete;
+  SimFlow& operator=(const SimFlow&) = delete;
+
+  /* start or stop sending new data */
+  void start();
+  void stop();
+  bool running() const { return running_; }
+
+  /* TCP_CWND */
+  void set_cwnd(uint32_t cwnd);
+  uint32_t cwnd() const { return cwnd_; }
+
+  /* TCP_DEEPCC_INFO */
+  TCPDeepCCInfo get_info();
+
+  /* a packet of this flow left the bottleneck */
+  void on_delivered(const SimPacket& packet);
+
+  uint32_t id() const { return id_; }
+  uint32_t mss() const { return mss_; }
+  uint64_t base_rtt_us() const { return base_rtt_us_; }
+  const SimFlowTotals& totals() const { return totals_; }
+
+ private:
+  enum class PacketState : uint8_t { IN_FLIGHT, ACKED, LOST };
+  /* per packet copy of the rate sampling state (tcp_rate_skb_sent) */
+  struct Transmission {
+    uint64_t sent_us;
+    uint64_t delivered;
+    uint64_t delivered_us;
+    uint64_t first_tx_us;
+    bool retransmit;
+    PacketState state;
+  };
+
+  void send_packets();
+  void transmit();
+  void on_ack(uint64_t packet_id);
+  void sample_rtt(uint64_t rtt_us);
+  void sample_rate(const Transmission& packet);
+  void mark_lost(uint64_t packet_id);
+  void detect_losses(uint64_t acked_id);
+  void arm_rto();
+  void on_rto();
+  uint32_t packets_out() const { return in_flight_ + pending_retransmits_; }
+
+  Simulator& sim_;
+  Bottleneck& link_;
+  uint32_t id_;
+  uint64_t base_rtt_us_;
+  uint32_t mss_;
+  uint32_t cwnd_;
+  bool running_;
+
+  // transmissions from window_base_ to next_id_ - 1
+  std::deque<Transmission> window_{};
+  uint64_t window_base_;
+  uint64_t next_id_;
+  // losses below this id have been looked for
+  uint64_t loss_scan_;
+  uint32_t in_flight_;
+  uint32_t retrans_out_;
+  uint32_t pending_retransmits_;
+
+  // tcp_sock state
+  uint64_t delivered_;
+  uint64_t delivered_us_;
+  uint64_t first_tx_us_;
+  uint32_t srtt_us_;  // << 3, as tp->srtt_us
+  uint32_t rttvar_us_;
+  uint64_t rto_us_;
+  uint64_t rto_deadline_;
+  bool rto_scheduled_;
+  uint32_t lost_;  // tp->lost
+  uint32_t snd_ssthresh_;
+  uint64_t recovery_end_id_;
+  uint32_t max_packets_out_;
+  uint64_t max_packets_out_round_;
+
+  // tp->deepcc_api
+  uint32_t min_urtt_;
+  uint32_t avg_urtt_;
+  uint32_t cnt_;
+  uint64_t avg_thr_;
+  uint32_t thr_cnt_;
+  uint32_t pre_lost_;
+
+  SimFlowTotals totals_{};
+};
+
+#endif  // SIM_FLOW_HH
@@ -0,0 +1,101 @@
+#include "sim_network.hh"
+
+#include <algorithm>
+#include <limits>
+
+#include "tcp_info.hh"
+
+using namespace std;
+
+SimNetwork::SimNetwork(const DeliveryTrace& trace, size_t queue_packets,
+                       double loss_rate, uint64_t seed)
+    : sim_(),
+      trace_(trace),
+      link_(sim_, trace_, queue_packets, loss_rate, seed),
+      flows_(),
+      start_us_() {
+  link_.set_receiver([this](const SimPacket& packet) {
+    flows_[packet.flow]->on_delivered(packet);
+  });
+}
+
+SimFlow& SimNetwork::add_flow(uint64_t base_rtt_us, uint64_t start_us,
+                              uint32_t initial_cwnd) {
+  flows_.emplace_back(new SimFlow(sim_, link_, flows_.size(), base_rtt_us,
+                                  1448, initial_cwnd));
+  start_us_.push_back(start_us);
+  SimFlow* flow = flows_.back().get();
+  sim_.at(start_us, [flow] { flow->start(); });
+  return *flow;
+}
+
+SimControlLoop::SimControlLoop(SimNetwork& network,
+                               const ControlInterval& interval,
+                               SimPolicy policy)
+    : network_(network),
+      interval_(interval),
+      policy_(move(policy)),
+      steps_(0) {}
+
+void SimControlLoop::run_until(uint64_t time_us) {
+  const auto& flows = network_.flows();
+  // the first step of a flow is one interval after it started
+  for (size_t i = control_.size(); i < flows.size(); i++) {
+    const uint64_t start_us = network_.flow_start_us(i);
+    control_.push_back({start_us + interval_.fixed_us(), start_us, 0});
+  }
+
+  vector<SimStep> batch;
+  while (true) {
+    uint64_t next_us = numeric_limits<uint64_t>::max();
+    for (const auto& control : control_) {
+      next_us = min(next_us, control.next_step_us);
+    }
+    if (next_us > time_us) {
+      break;
+    }
+    network_.run_until(next_us);
+
+    batch.clear();
+    for (size_t i = 0; i < control_.size(); i++) {
+      if (control_[i].next_step_us != next_us) {
+        continue;
+      }
+      if (not flows[i]->running()) {
+        control_[i].next_step_us += interval_.fixed_us();
+        continue;
+      }
+      json state = request_state(i);
+      control_[i].next_step_us =
+          next_step(next_us, ControlInterval::srtt_us(state));
+      batch.push_back({flows[i].get(), move(state), flows[i]->cwnd()});
+    }
+    if (not batch.empty()) {
+      policy_(batch);
+      for (auto& step : batch) {
+        step.flow->set_cwnd(step.cwnd);
+      }
+      steps_ += batch.size();
+    }
+  }
+  network_.run_until(time_us);
+}
+
+uint64_t SimControlLoop::next_step(uint64_t now_us, uint64_t srtt_us) const {
+  const uint64_t next_us = now_us + interval_.next_us(srtt_us);
+  if (not interval_.adaptive()) {
+    return next_us;
+  }
+  const uint64_t grid_us = interval_.min_us();
+  return (next_us + grid_us - 1) / grid_us * grid_us;
+}
+
+json SimControlLoop::request_state(size_t index) {
+  FlowControl& control = control_[index];
+  const uint64_t now = network_.sim().now();
+  const uint64_t time_delta = max<uint64_t>(now - control.last_request_us, 1);
+  control.last_request_us = now;
+  const TCPDeepCCInfo info = network_.flows()[index]->get_info();
+  control.max_tput = max(control.max_tput, info.avg_thr);
+  return deepcc_state_json(info, control.max_tput, time_delta);
+}
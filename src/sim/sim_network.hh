@@ -0,0 +1,104 @@
+#ifndef SIM_NETWORK_HH
+#define SIM_NETWORK_HH
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "bottleneck.hh"
+#include "control_interval.hh"
+#include "delivery_trace.hh"
+#include "json.hpp"
+#include "sim_flow.hh"
+#include "simulator.hh"
+
+using json = nlohmann::json;
+
+/**
+ * @brief A dumbbell: flows with their own base RTTs sharing one
+ * trace-driven bottleneck, e.g. mm-delay + mm-link with several clients.
+ */
+class SimNetwork {
+ public:
+  SimNetwork(const DeliveryTrace& trace, size_t queue_packets,
+             double loss_rate = 0, uint64_t seed = 1);
+
+  SimNetwork(const SimNetwork&) = delete;
+  SimNetwork& operator=(const SimNetwork&) = delete;
+
+  /* a flow that starts sending at `start_us` */
+  SimFlow& add_flow(uint64_t base_rtt_us, uint64_t start_us = 0,
+                    uint32_t initial_cwnd = 10);
+
+  void run_until(uint64_t time_us) { sim_.run_until(time_us); }
+
+  uint64_t flow_start_us(size_t index) const { return start_us_.at(index); }
+
+  Simulator& sim() { return sim_; }
+  const Simulator& sim() const { return sim_; }
+  const Bottleneck& link() const { return link_; }
+  const std::vector<std::unique_ptr<SimFlow>>& flows() const {
+    return flows_;
+  }
+
+ private:
+  Simulator sim_;
+  DeliveryTrace trace_;
+  Bottleneck link_;
+  std::vector<std::unique_ptr<SimFlow>> flows_;
+  std::vector<uint64_t> start_us_;
+};
+
+/* one decision of the control loop */
+struct SimStep {
+  SimFlow* flow;
+  // the message state, as get_tcp_deepcc_info_json() builds it
+  json state;
+  // the policy sets the new window; left alone, the window is kept
+  uint32_t cwnd;
+};
+
+/* decides the windows of all steps due at the same simulated time */
+typedef std::function<void(std::vector<SimStep>& steps)> SimPolicy;
+
+/**
+ * @brief Runs the Astraea control loop on the flows of a SimNetwork.
+ *
+ * Every interval after it starts, each flow reads its TCP info like the
+ * clients do with REQUEST_ACTION and gets a new window from the policy.
+ * Steps due at the same time reach the policy together, so a policy backed
+ * by the batch inference service sees whole batches. An adaptive interval
+ * differs per flow, so its steps are put on a grid of its minimum to keep
+ * the batches. The simulated clock stands still while the policy runs.
+ */
+class SimControlLoop {
+ public:
+  SimControlLoop(SimNetwork& network, const ControlInterval& interval,
+                 SimPolicy policy);
+
+  /* run the network and the control loop up to `time_us` */
+  void run_until(uint64_t time_us);
+
+  uint64_t steps() const { return steps_; }
+
+ private:
+  /* client side state of a DeepCCSocket */
+  struct FlowControl {
+    uint64_t next_step_us;
+    uint64_t last_request_us;
+    uint64_t max_tput;
+  };
+
+  json request_state(size_t index);
+  /* when a step taken at `now_us` is next due */
+  uint64_t next_step(uint64_t now_us, uint64_t srtt_us) const;
+
+  SimNetwork& network_;
+  ControlInterval interval_;
+  SimPolicy policy_;
+  std::vector<FlowControl> control_{};
+  uint64_t steps_;
+};
+
+#endif  // SIM_NETWORK_HH
@@ -0,0 +1,20 @@
+#include "simulator.hh"
+
+#include <algorithm>
+
+void Simulator::at(uint64_t time_us, Callback callback) {
+  events_.push_back({std::max(time_us, now_), next_seq_++, std::move(callback)});
+  std::push_heap(events_.begin(), events_.end(), later);
+}
+
+void Simulator::run_until(uint64_t time_us) {
+  while (not events_.empty() and events_.front().time <= time_us) {
+    std::pop_heap(events_.begin(), events_.end(), later);
+    Event event = std::move(events_.back());
+    events_.pop_back();
+    now_ = event.time;
+    processed_++;
+    event.callback();
+  }
+  now_ = std::max(now_, time_us);
+}
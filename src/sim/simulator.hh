@@ -0,0 +1,55 @@
+#ifndef SIMULATOR_HH
+#define SIMULATOR_HH
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief Discrete-event scheduler of the network simulator.
+ *
+ * Time is simulated, in microseconds from 0. Events due at the same time
+ * run in the order they were scheduled.
+ */
+class Simulator {
+ public:
+  using Callback = std::function<void()>;
+
+  Simulator() : events_(), now_(0), next_seq_(0), processed_(0) {}
+
+  Simulator(const Simulator&) = delete;
+  Simulator& operator=(const Simulator&) = delete;
+
+  uint64_t now() const { return now_; }
+
+  /* run `callback` at `time_us`; times in the past mean now */
+  void at(uint64_t time_us, Callback callback);
+  void after(uint64_t delay_us, Callback callback) {
+    at(now_ + delay_us, std::move(callback));
+  }
+
+  /* run every event due up to and including `time_us`, then advance the
+   * clock to it */
+  void run_until(uint64_t time_us);
+
+  bool idle() const { return events_.empty(); }
+  uint64_t events_processed() const { return processed_; }
+
+ private:
+  struct Event {
+    uint64_t time;
+    uint64_t seq;
+    Callback callback;
+  };
+  /* min-heap order for std::push_heap / std::pop_heap */
+  static bool later(const Event& a, const Event& b) {
+    return a.time != b.time ? a.time > b.time : a.seq > b.seq;
+  }
+
+  std::vector<Event> events_;
+  uint64_t now_;
+  uint64_t next_seq_;
+  uint64_t processed_;
+};
+
+#endif  // SIMULATOR_HH
@@ -0,0 +1,244 @@
+#include "vec_env.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+using namespace std;
+
+/* the window update of map_action() in the inference service */
+static uint32_t apply_action(float action, uint32_t cwnd) {
+  action = max(-1.0f, min(1.0f, action));
+  if (action >= 0) {
+    return ceil((1 + 0.025 * action) * cwnd);
+  }
+  return floor(cwnd / (1 - 0.025 * action));
+}
+
+/* state_dict_2_array() in python/agent/definitions.py */
+static void transform_state(const TCPDeepCCInfo& info, double max_tput,
+                            double loss_ratio, float* out) {
+  const double min_rtt = info.min_rtt;
+  const double cwnd = max(info.cwnd, 1U);
+  if (info.avg_thr == 0) {
+    out[0] = 0.5;
+  } else {
+    out[0] = max_tput > 0 ? info.avg_thr / max_tput : 0;
+  }
+  if (info.avg_urtt == 0) {
+    out[1] = 2;
+  } else {
+    out[1] = min_rtt == 0 ? 0 : info.avg_urtt / min_rtt;
+  }
+  if (info.srtt_us == 0) {
+    out[2] = 2;
+  } else {
+    out[2] = min_rtt == 0 ? 0 : info.srtt_us / 8.0 / min_rtt;
+  }
+  if (min_rtt == 0 or max_tput == 0) {
+    out[3] = 0;
+  } else {
+    out[3] = cwnd * 1460 * 8 / (min_rtt / 1e6) / max_tput / 10;
+  }
+  out[4] = max_tput / 1e7;
+  out[5] = min_rtt / 5e5;
+  out[6] = max_tput > 0 ? loss_ratio / max_tput : 0;
+  out[7] = info.packets_out / cwnd;
+  out[8] = max_tput > 0 ? info.pacing_rate / max_tput : 0;
+  out[9] = info.retrans_out / cwnd;
+  for (size_t i : {1, 2, 3, 8}) {
+    out[i] = min(out[i], 2.0f);
+  }
+}
+
+static double jain_index(const vector<double>& values) {
+  double sum = 0, sum_squares = 0;
+  for (double v : values) {
+    sum += v;
+    sum_squares += v * v;
+  }
+  return sum_squares > 0 ? sum * sum / (values.size() * sum_squares) : 1;
+}
+
+VecEnv::VecEnv(const VecEnvConfig& config)
+    : config_(config),
+      rng_(config.seed),
+      envs_(config.num_envs),
+      states_(),
+      global_states_(),
+      rewards_(),
+      dones_(),
+      metrics_() {
+  if (config_.num_envs == 0 or config_.flows_per_env == 0 or
+      config_.history == 0 or config_.interval_us == 0 or
+      config_.min_bandwidth_mbps <= 0 or
+      config_.max_bandwidth_mbps < config_.min_bandwidth_mbps or
+      config_.max_delay_ms < config_.min_delay_ms or
+      config_.max_queue_bdp < config_.min_queue_bdp) {
+    throw runtime_error("VecEnv: invalid configuration");
+  }
+  states_.resize(num_agents() * state_dim());
+  global_states_.resize(num_agents() * kGlobalDim);
+  rewards_.resize(num_agents());
+  dones_.resize(num_agents());
+  metrics_.resize(num_agents() * kMetricDim);
+  reset();
+}
+
+void VecEnv::reset() {
+  for (size_t i = 0; i < envs_.size(); i++) {
+    reset_env(i);
+  }
+  fill(dones_.begin(), dones_.end(), 0);
+}
+
+void VecEnv::step(const float* actions) {
+  for (size_t e = 0; e < envs_.size(); e++) {
+    Env& env = envs_[e];
+    const auto& flows = env.network->flows();
+    for (size_t f = 0; f < flows.size(); f++) {
+      const uint32_t cwnd =
+          apply_action(actions[agent(e, f)], flows[f]->cwnd());
+      flows[f]->set_cwnd(min(cwnd, env.max_cwnd));
+    }
+    advance(e);
+
+    const bool done = env.now_us >= config_.episode_us;
+    if (done) {
+      // the last reward stays with the episode it belongs to
+      const size_t first = agent(e, 0), n = config_.flows_per_env;
+      vector<float> rewards(&rewards_[first], &rewards_[first + n]);
+      vector<float> metrics(&metrics_[first * kMetricDim],
+                            &metrics_[(first + n) * kMetricDim]);
+      reset_env(e);
+      copy(rewards.begin(), rewards.end(), &rewards_[first]);
+      copy(metrics.begin(), metrics.end(), &metrics_[first * kMetricDim]);
+    }
+    // `flows` is gone if the environment was reset
+    for (size_t f = 0; f < config_.flows_per_env; f++) {
+      dones_[agent(e, f)] = done;
+    }
+  }
+}
+
+void VecEnv::reset_env(size_t index) {
+  Env& env = envs_[index];
+  uniform_real_distribution<double> uniform(0, 1);
+  auto draw = [&](double low, double high) {
+    return low + (high - low) * uniform(rng_);
+  };
+  env.bandwidth_mbps =
+      draw(config_.min_bandwidth_mbps, config_.max_bandwidth_mbps);
+  env.one_way_delay_ms = draw(config_.min_delay_ms, config_.max_delay_ms);
+  env.bdp_mbit = env.bandwidth_mbps * 2 * env.one_way_delay_ms / 1e3;
+  const double bdp_packets = env.bdp_mbit * 1e6 / (kTraceMTU * 8);
+  const size_t queue = max<long long>(
+      1, llround(bdp_packets *
+                 draw(config_.min_queue_bdp, config_.max_queue_bdp)));
+  env.max_cwnd = max<uint32_t>(10, config_.max_cwnd_bdp * bdp_packets);
+
+  env.network.reset(
+      new SimNetwork(DeliveryTrace::constant(env.bandwidth_mbps), queue,
+                     config_.loss_rate, rng_()));
+  env.flows.assign(config_.flows_per_env, FlowTrack{0, SimFlowTotals()});
+  for (size_t f = 0; f < config_.flows_per_env; f++) {
+    env.network->add_flow(env.one_way_delay_ms * 2000);
+    float* row = &states_[agent(index, f) * state_dim()];
+    fill(row, row + state_dim(), 0.0f);
+  }
+  env.now_us = 0;
+  // the first state is taken one interval after the flows start
+  advance(index);
+}
+
+void VecEnv::advance(size_t index) {
+  Env& env = envs_[index];
+  env.now_us += config_.interval_us;
+  env.network->run_until(env.now_us);
+
+  const auto& flows = env.network->flows();
+  const size_t n = flows.size();
+  const double interval_s = config_.interval_us / 1e6;
+  vector<double> throughputs(n);
+  double delivered_mbps = 0, queueing_delay = 0;
+  uint64_t lost = 0, sent = 0;
+  double thr_sum = 0, lat_sum = 0, window_sum = 0, loss_sum = 0;
+  double thr_min = numeric_limits<double>::max(), thr_max = 0;
+  double window_min = numeric_limits<double>::max(), window_max = 0;
+
+  for (size_t f = 0; f < n; f++) {
+    SimFlow& flow = *flows[f];
+    FlowTrack& track = env.flows[f];
+    const size_t a = agent(index, f);
+
+    // what the client sends with REQUEST_ACTION
+    const TCPDeepCCInfo info = flow.get_info();
+    track.max_tput = max(track.max_tput, info.avg_thr);
+    const double loss_ratio = info.lost_bytes * 1e6 / config_.interval_us;
+    float* row = &states_[a * state_dim()];
+    memmove(row, row + kStateDim, (state_dim() - kStateDim) * sizeof(float));
+    transform_state(info, track.max_tput, loss_ratio,
+                    row + state_dim() - kStateDim);
+
+    // what happened during the interval
+    const SimFlowTotals& totals = flow.totals();
+    const uint64_t acked = totals.acked - track.last.acked;
+    const uint64_t flow_sent = totals.sent - track.last.sent;
+    const uint64_t flow_lost = totals.lost - track.last.lost;
+    const uint64_t samples = totals.rtt_samples - track.last.rtt_samples;
+    const uint64_t rtt_sum = totals.rtt_sum_us - track.last.rtt_sum_us;
+    track.last = totals;
+
+    const double mbps = acked * flow.mss() * 8 / interval_s / 1e6;
+    const double rtt_us = samples ? double(rtt_sum) / samples : 0;
+    float* metrics = &metrics_[a * kMetricDim];
+    metrics[0] = mbps;
+    metrics[1] = rtt_us / 1e3;
+    metrics[2] = flow_sent ? double(flow_lost) / flow_sent : 0;
+
+    throughputs[f] = mbps;
+    delivered_mbps += mbps;
+    if (samples) {
+      const double base = flow.base_rtt_us();
+      queueing_delay += max(0.0, rtt_us - base) / max(base, 1.0);
+    }
+    lost += flow_lost;
+    sent += flow_sent;
+
+    const double thr = info.avg_thr / 5e7, window = info.cwnd / 1000.0;
+    thr_sum += thr;
+    thr_min = min(thr_min, thr);
+    thr_max = max(thr_max, thr);
+    lat_sum += info.avg_urtt / 5e5;
+    window_sum += window;
+    window_min = min(window_min, window);
+    window_max = max(window_max, window);
+    loss_sum += loss_ratio / 1e6;
+  }
+
+  const float global[kGlobalDim] = {
+      float(thr_sum),
+      float(thr_min),
+      float(thr_max),
+      float(lat_sum / n),
+      float(window_min),
+      float(window_max),
+      float(window_sum / n),
+      float(loss_sum / n),
+      float(n / 10.0),
+      float(env.one_way_delay_ms / 500.0),
+      float(env.bdp_mbit / 10),
+      float(env.bandwidth_mbps / 500)};
+  const double reward =
+      config_.throughput_weight * delivered_mbps / env.bandwidth_mbps -
+      config_.delay_weight * queueing_delay / n -
+      config_.loss_weight * (sent ? double(lost) / sent : 0) -
+      config_.fairness_weight * (1 - jain_index(throughputs));
+  for (size_t f = 0; f < n; f++) {
+    const size_t a = agent(index, f);
+    copy(global, global + kGlobalDim, &global_states_[a * kGlobalDim]);
+    rewards_[a] = reward;
+  }
+}
@@ -0,0 +1,123 @@
+#ifndef VEC_ENV_HH
+#define VEC_ENV_HH
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "sim_network.hh"
+
+/* scenario ranges and reward weights of a VecEnv */
+struct VecEnvConfig {
+  size_t num_envs = 16;
+  // more than one: the flows of an environment share its bottleneck
+  size_t flows_per_env = 1;
+  // each episode draws its bandwidth, one-way delay and queue size
+  double min_bandwidth_mbps = 10;
+  double max_bandwidth_mbps = 100;
+  double min_delay_ms = 5;
+  double max_delay_ms = 50;
+  // drop-tail queue in bandwidth-delay products
+  double min_queue_bdp = 0.5;
+  double max_queue_bdp = 4;
+  double loss_rate = 0;
+  uint64_t interval_us = 20000;
+  uint64_t episode_us = 30000000;
+  // steps stacked in a state (state_history in astraea.json)
+  size_t history = 5;
+  // the window is at most this many BDPs, as max_action() in the agent
+  double max_cwnd_bdp = 1.5;
+  uint64_t seed = 1;
+
+  // reward = throughput * utilization - delay * queueing delay / base RTT
+  //          - loss * loss ratio - fairness * (1 - Jain's index)
+  double throughput_weight = 1.0;
+  double delay_weight = 0.5;
+  double loss_weight = 1.0;
+  double fairness_weight = 0.5;
+};
+
+/**
+ * @brief Many simulated training environments stepped in lockstep.
+ *
+ * Every flow is one agent. A step applies one action per agent (mapped to
+ * a window like map_action() does), runs every environment for one
+ * control interval of simulated time and leaves the results in contiguous
+ * row-major buffers, one row per agent:
+ *   states         num_agents x (history * kStateDim), oldest step first
+ *   global_states  num_agents x kGlobalDim
+ *   rewards        num_agents, the global reward of the agent's environment
+ *   dones          num_agents
+ *   metrics        num_agents x kMetricDim: throughput (Mbps), average RTT
+ *                  (ms) and loss ratio of the last interval
+ * The features are those of transform_state() in python/agent/
+ * definitions.py; the bdp of the global state is in Mbit. An environment
+ * whose episode ended is reset in the same step: its agents report done
+ * and the first state of the next episode.
+ *
+ * The buffers are overwritten by every step.
+ */
+class VecEnv {
+ public:
+  static constexpr size_t kStateDim = 10;
+  static constexpr size_t kGlobalDim = 12;
+  static constexpr size_t kMetricDim = 3;
+
+  explicit VecEnv(const VecEnvConfig& config);
+
+  VecEnv(const VecEnv&) = delete;
+  VecEnv& operator=(const VecEnv&) = delete;
+
+  /* start a new episode in every environment */
+  void reset();
+
+  /* `actions` holds num_agents() values in [-1, 1] */
+  void step(const float* actions);
+
+  size_t num_agents() const {
+    return config_.num_envs * config_.flows_per_env;
+  }
+  size_t state_dim() const { return config_.history * kStateDim; }
+  const VecEnvConfig& config() const { return config_; }
+
+  const float* states() const { return states_.data(); }
+  const float* global_states() const { return global_states_.data(); }
+  const float* rewards() const { return rewards_.data(); }
+  const uint8_t* dones() const { return dones_.data(); }
+  const float* metrics() const { return metrics_.data(); }
+
+ private:
+  /* what the client keeps between steps, per flow */
+  struct FlowTrack {
+    uint64_t max_tput;
+    SimFlowTotals last;
+  };
+  struct Env {
+    std::unique_ptr<SimNetwork> network{};
+    std::vector<FlowTrack> flows{};
+    double bandwidth_mbps = 0;
+    double one_way_delay_ms = 0;
+    double bdp_mbit = 0;
+    uint32_t max_cwnd = 0;
+    uint64_t now_us = 0;
+  };
+
+  void reset_env(size_t index);
+  /* run one interval and fill the buffers of the environment's agents */
+  void advance(size_t index);
+  size_t agent(size_t env, size_t flow) const {
+    return env * config_.flows_per_env + flow;
+  }
+
+  VecEnvConfig config_;
+  std::mt19937_64 rng_;
+  std::vector<Env> envs_;
+  std::vector<float> states_;
+  std::vector<float> global_states_;
+  std::vector<float> rewards_;
+  std::vector<uint8_t> dones_;
+  std::vector<float> metrics_;
+};
+
+#endif  // VEC_ENV_HH
@@ -0,0 +1,398 @@
+#include <getopt.h>
+#include <poll.h>
+#include <signal.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "context.hh"
+#include "delivery_trace.hh"
+#include "distilled_actor.hh"
+#include "exception.hh"
+#include "inference_transport.hh"
+#include "json.hpp"
+#include "logging.hh"
+#include "sim_network.hh"
+
+using namespace std;
+using json = nlohmann::json;
+
+/* define message type */
+enum class MessageType { INIT = 0, START = 1, END = 2, ALIVE = 3, OBSERVE = 4 };
+
+template <typename E>
+constexpr typename std::underlying_type<E>::type to_underlying(E e) noexcept {
+  return static_cast<typename std::underlying_type<E>::type>(e);
+}
+
+/**
+ * Gets every window from a running infer service, one connection per
+ * simulated flow. A step whose reply does not come within the timeout
+ * keeps its window, as in the clients.
+ */
+class InferencePolicy {
+ public:
+  InferencePolicy(const string& channel, const string& target,
+                  size_t num_flows, int timeout_ms)
+      : transports_(), flow_ids_(), timeout_ms_(timeout_ms), step_(0),
+        timeouts_(0) {
+    for (size_t i = 0; i < num_flows; i++) {
+      transports_.push_back(InferenceTransport::connect(channel, target));
+      json start;
+      start["type"] = to_underlying(MessageType::START);
+      start["flow_id"] = static_cast<int>(i);
+      transports_.back()->send_message(start.dump());
+      flow_ids_.push_back(
+          json::parse(transports_.back()->recv_message()).at("flow_id"));
+    }
+  }
+
+  ~InferencePolicy() {
+    for (size_t i = 0; i < transports_.size(); i++) {
+      json end;
+      end["type"] = to_underlying(MessageType::END);
+      end["flow_id"] = flow_ids_[i];
+      try {
+        transports_[i]->send_message(end.dump());
+      } catch (const exception&) {
+        // the service may be gone already
+      }
+    }
+  }
+
+  InferencePolicy(const InferencePolicy&) = delete;
+  InferencePolicy& operator=(const InferencePolicy&) = delete;
+
+  /* send the whole batch first, so a batching service can batch it */
+  void decide(vector<SimStep>& steps) {
+    step_++;
+    for (const auto& step : steps) {
+      json message;
+      message["type"] = to_underlying(MessageType::ALIVE);
+      message["flow_id"] = flow_ids_[step.flow->id()];
+      message["step"] = step_;
+      message["state"] = step.state;
+      transports_[step.flow->id()]->send_message(message.dump());
+    }
+    for (auto& step : steps) {
+      if (not recv_action(*transports_[step.flow->id()], step.cwnd)) {
+        timeouts_++;
+      }
+    }
+  }
+
+  uint64_t timeouts() const { return timeouts_; }
+
+ private:
+  bool recv_action(InferenceTransport& transport, uint32_t& cwnd) {
+    const auto deadline =
+        chrono::steady_clock::now() + chrono::milliseconds(timeout_ms_);
+    while (true) {
+      const int remaining_ms = chrono::duration_cast<chrono::milliseconds>(
+                                   deadline - chrono::steady_clock::now())
+                                   .count();
+      pollfd pfd = {transport.fd_num(), POLLIN, 0};
+      if (remaining_ms <= 0 or
+          SystemCall("poll", poll(&pfd, 1, remaining_ms)) == 0) {
+        return false;
+      }
+      const string_view message = transport.recv_view();
+      const json reply = json::parse(message.begin(), message.end());
+      // replies to steps that timed out earlier are stale
+      if (reply.value("step", step_) == step_) {
+        cwnd = max(1, reply.at("cwnd").get<int>());
+        return true;
+      }
+    }
+  }
+
+  vector<unique_ptr<InferenceTransport>> transports_;
+  vector<int> flow_ids_;
+  int timeout_ms_;
+  int step_;
+  uint64_t timeouts_;
+};
+
+/**
+ * Decides every window in process with the distilled actor, keeping the
+ * state history of each flow as the infer service does.
+ */
+class TreePolicy {
+ public:
+  explicit TreePolicy(size_t num_flows) : contexts_() {
+    for (size_t i = 0; i < num_flows; i++) {
+      contexts_.emplace_back(i);
+    }
+  }
+
+  void decide(vector<SimStep>& steps) {
+    for (auto& step : steps) {
+      const auto state =
+          contexts_[step.flow->id()].format_state(step.state);
+      step.cwnd = max(1, map_action(DistilledActor::act(state.data()),
+                                    step.state["cwnd"].get<float>()));
+    }
+  }
+
+ private:
+  vector<FlowContext> contexts_;
+};
+
+/* Jain's fairness index */
+double jain_index(const vector<double>& values) {
+  double sum = 0, sum_squares = 0;
+  for (double v : values) {
+    sum += v;
+    sum_squares += v * v;
+  }
+  return sum_squares > 0 ? sum * sum / (values.size() * sum_squares) : 0;
+}
+
+json report(const SimNetwork& network, const SimControlLoop& control,
+            uint64_t duration_us, double wall_seconds) {
+  const Bottleneck& link = network.link();
+  const uint64_t opportunities =
+      link.trace().first_opportunity_at(duration_us);
+  json out;
+  out["duration_s"] = duration_us / 1e6;
+  out["wall_s"] = wall_seconds;
+  out["speedup"] = duration_us / 1e6 / max(wall_seconds, 1e-9);
+  out["events"] = network.sim().events_processed();
+  out["steps"] = control.steps();
+  out["capacity_mbps"] = link.trace().average_mbps();
+  out["utilization"] =
+      opportunities ? double(link.delivered()) / opportunities : 0.0;
+  out["drops"] = link.dropped();
+
+  vector<double> throughputs;
+  for (size_t i = 0; i < network.flows().size(); i++) {
+    const SimFlow& flow = *network.flows()[i];
+    const SimFlowTotals& totals = flow.totals();
+    const uint64_t start_us = network.flow_start_us(i);
+    const double active_s =
+        duration_us > start_us ? (duration_us - start_us) / 1e6 : 0;
+    const double mbps =
+        active_s > 0 ? totals.acked * flow.mss() * 8 / active_s / 1e6 : 0;
+    throughputs.push_back(mbps);
+    json f;
+    f["start_s"] = start_us / 1e6;
+    f["base_rtt_ms"] = flow.base_rtt_us() / 1e3;
+    f["throughput_mbps"] = mbps;
+    f["avg_rtt_ms"] = totals.rtt_samples
+                          ? totals.rtt_sum_us / 1e3 / totals.rtt_samples
+                          : 0.0;
+    f["loss"] = totals.sent ? double(totals.lost) / totals.sent : 0.0;
+    f["retransmitted"] = totals.retransmitted;
+    f["timeouts"] = totals.timeouts;
+    out["flows"].push_back(f);
+  }
+  out["jain_index"] = jain_index(throughputs);
+  return out;
+}
+
+void print_report(const json& out) {
+  cout << fixed << setprecision(2);
+  cout << "simulated:   " << out["duration_s"].get<double>() << " s in "
+       << out["wall_s"].get<double>() << " s ("
+       << out["speedup"].get<double>() << "x real time, "
+       << out["events"].get<uint64_t>() << " events, "
+       << out["steps"].get<uint64_t>() << " steps)" << endl;
+  cout << "bottleneck:  " << out["capacity_mbps"].get<double>()
+       << " Mbps, utilization " << out["utilization"].get<double>() * 100
+       << "%, " << out["drops"].get<uint64_t>() << " drops" << endl;
+  cout << "flow   start(s)  tput(Mbps)  avg rtt(ms)  loss(%)  rto" << endl;
+  for (size_t i = 0; i < out["flows"].size(); i++) {
+    const json& f = out["flows"][i];
+    cout << setw(4) << i << setw(11) << f["start_s"].get<double>()
+         << setw(12) << f["throughput_mbps"].get<double>() << setw(13)
+         << f["avg_rtt_ms"].get<double>() << setw(9)
+         << f["loss"].get<double>() * 100 << setw(5)
+         << f["timeouts"].get<uint64_t>() << endl;
+  }
+  cout << "jain index:  " << out["jain_index"].get<double>() << endl;
+}
+
+void usage_error(const string& program_name) {
+  cerr << "Usage: " << program_name << " [OPTION]..." << endl;
+  cerr << endl;
+  cerr << "Options = --trace=MAHIMAHI_TRACE | --bandwidth=MBPS --delay=MS "
+          "--queue=PACKETS --loss=RATE --flows=N --stagger=SECONDS "
+          "--duration=SECONDS --interval=MS --policy=astraea|tree|fixed "
+          "--cwnd=PACKETS --channel=unix|udp --target=PATH|HOST:PORT "
+          "--timeout=MS --seed=N --json "
+          "--adaptive-interval=MULTIPLIER[:MIN_MS:MAX_MS]"
+       << endl;
+  cerr << endl;
+  cerr << "Simulates N flows over a trace-driven bottleneck, like mm-delay "
+          "DELAY mm-link TRACE TRACE." << endl
+       << "Default is 12 Mbps, 10ms one-way delay, a 100 packet drop-tail "
+          "queue, 1 flow for 30s; " << endl
+       << "Windows come from a running infer service (policy astraea), the "
+          "distilled actor built in (policy tree) or stay at --cwnd (policy "
+          "fixed); "
+       << endl
+       << "--adaptive-interval steps each flow every MULTIPLIER smoothed "
+          "RTTs, within [MIN_MS, MAX_MS] (default 5 and 200); "
+       << endl;
+
+  throw runtime_error("invalid arguments");
+}
+
+int main(int argc, char** argv) {
+  signal(SIGPIPE, SIG_IGN);
+
+  const option command_line_options[] = {
+      {"trace", required_argument, nullptr, 'T'},
+      {"bandwidth", required_argument, nullptr, 'b'},
+      {"delay", required_argument, nullptr, 'D'},
+      {"queue", required_argument, nullptr, 'q'},
+      {"loss", required_argument, nullptr, 'l'},
+      {"flows", required_argument, nullptr, 'n'},
+      {"stagger", required_argument, nullptr, 'g'},
+      {"duration", required_argument, nullptr, 'd'},
+      {"interval", required_argument, nullptr, 't'},
+      {"policy", required_argument, nullptr, 'p'},
+      {"cwnd", required_argument, nullptr, 'w'},
+      {"channel", required_argument, nullptr, 'h'},
+      {"target", required_argument, nullptr, 'a'},
+      {"timeout", required_argument, nullptr, 'o'},
+      {"seed", required_argument, nullptr, 's'},
+      {"json", no_argument, nullptr, 'j'},
+      {"adaptive-interval", required_argument, nullptr, 'v'},
+      {0, 0, nullptr, 0}};
+
+  string trace_path, policy_name = "astraea", channel = "unix", target,
+      adaptive_interval;
+  double bandwidth = 12, delay_ms = 10, loss = 0, stagger = 0, duration = 30;
+  size_t queue = 100, num_flows = 1;
+  uint64_t interval_us = 20000, seed = 1;
+  uint32_t fixed_cwnd = 10;
+  int timeout_ms = 1000;
+  bool print_json = false;
+  while (true) {
+    const int opt = getopt_long(argc, argv, "", command_line_options, nullptr);
+    if (opt == -1) { /* end of options */
+      break;
+    }
+    switch (opt) {
+    case 'T':
+      trace_path = optarg;
+      break;
+    case 'b':
+      bandwidth = stod(optarg);
+      break;
+    case 'D':
+      delay_ms = stod(optarg);
+      break;
+    case 'q':
+      queue = stoul(optarg);
+      break;
+    case 'l':
+      loss = stod(optarg);
+      break;
+    case 'n':
+      num_flows = stoul(optarg);
+      break;
+    case 'g':
+      stagger = stod(optarg);
+      break;
+    case 'd':
+      duration = stod(optarg);
+      break;
+    case 't':
+      interval_us = stod(optarg) * 1000;
+      break;
+    case 'p':
+      policy_name = optarg;
+      break;
+    case 'w':
+      fixed_cwnd = stoul(optarg);
+      break;
+    case 'h':
+      channel = optarg;
+      break;
+    case 'a':
+      target = optarg;
+      break;
+    case 'o':
+      timeout_ms = stoi(optarg);
+      break;
+    case 's':
+      seed = stoull(optarg);
+      break;
+    case 'j':
+      print_json = true;
+      break;
+    case 'v':
+      adaptive_interval = optarg;
+      break;
+    default:
+      usage_error(argv[0]);
+    }
+  }
+  if (num_flows == 0 or interval_us == 0 or
+      (policy_name != "astraea" and policy_name != "tree" and
+       policy_name != "fixed")) {
+    usage_error(argv[0]);
+  }
+
+  const DeliveryTrace trace = trace_path.empty()
+                                  ? DeliveryTrace::constant(bandwidth)
+                                  : DeliveryTrace(trace_path);
+  SimNetwork network(trace, queue, loss, seed);
+  for (size_t i = 0; i < num_flows; i++) {
+    network.add_flow(delay_ms * 2000, i * stagger * 1e6);
+  }
+
+  unique_ptr<InferencePolicy> inference;
+  SimPolicy policy;
+  if (policy_name == "astraea") {
+    inference.reset(
+        new InferencePolicy(channel, target, num_flows, timeout_ms));
+    policy = [&inference](vector<SimStep>& steps) {
+      inference->decide(steps);
+    };
+  } else if (policy_name == "tree") {
+    if (not DistilledActor::available()) {
+      throw runtime_error(
+          "no distilled actor compiled in: run python/distill_actor.py and "
+          "rebuild");
+    }
+    auto tree = make_shared<TreePolicy>(num_flows);
+    policy = [tree](vector<SimStep>& steps) { tree->decide(steps); };
+  } else {
+    policy = [fixed_cwnd](vector<SimStep>& steps) {
+      for (auto& step : steps) {
+        step.cwnd = fixed_cwnd;
+      }
+    };
+  }
+  ControlInterval intervals(interval_us);
+  if (not adaptive_interval.empty()) {
+    intervals.set_adaptive(adaptive_interval);
+  }
+  SimControlLoop control(network, intervals, policy);
+
+  const uint64_t duration_us = duration * 1e6;
+  const auto wall_start = chrono::steady_clock::now();
+  control.run_until(duration_us);
+  const double wall_seconds =
+      chrono::duration<double>(chrono::steady_clock::now() - wall_start)
+          .count();
+  if (inference and inference->timeouts() > 0) {
+    LOG(WARNING) << inference->timeouts() << " steps got no action in time";
+  }
+
+  const json out = report(network, control, duration_us, wall_seconds);
+  if (print_json) {
+    cout << out.dump(2) << endl;
+  } else {
+    print_report(out);
+  }
+  return 0;
+}